@@ -0,0 +1,27 @@
+/*
+ * board_cache.h
+ *
+ * River rank cache: with the five community cards fixed, every two card holding
+ * from the 47 remaining cards is ranked once and stored by hole combo index.
+ * Any later showdown or equity query on that board is a single table read.
+ */ 
+
+#ifndef BOARD_CACHE_H
+#define BOARD_CACHE_H
+
+#include <stdint.h>
+#include "card.h"
+
+#define BOARD_CACHE_CARDS 47 //52 - 5 board cards
+#define BOARD_CACHE_COMBOS 1081 //47 choose 2
+
+typedef struct{
+	uint8_t pos[52]; //Position of each card among the 47 remaining, 0xFF if it is on the board
+	uint16_t strength[BOARD_CACHE_COMBOS]; //hand_strength() of board + hole combo
+} BoardCache;
+
+void board_cache_build(BoardCache *bc, const Card board[5]); //Rank all 1081 holdings on this board
+uint16_t board_cache_combo(const BoardCache *bc, Card a, Card b); //Combo index 0..1080, or BOARD_CACHE_COMBOS if a card is on the board or a == b
+uint16_t board_cache_lookup(const BoardCache *bc, Card a, Card b); //Strength of the holding, 0 if it is not possible on this board
+
+#endif
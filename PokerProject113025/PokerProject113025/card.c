@@ -9,17 +9,19 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include "uart.h"
+#include "eval_tables.h"
+#include "rank_tables.h" //Flash tables, plus RANK_TABLE for the constant time evaluator
 
-static Card deck[52];
+static PackedCard deck[52]; //52 bytes, a Card array would be 156 on avr-gcc
 static uint8_t deckIndex = 0;
+static CardSet dealt = 0; //Cards draw_card() has handed out since the last shuffle
 
 void card_init(){
 	uint8_t k = 0;
 	
 	for (uint8_t s = 0; s < 4; s++){
 		for(uint8_t r=1; r<=13; r++){
-			deck[k].rank= r;
-			deck[k].suit = s;
+			deck[k] = CARD_PACK(r, s);
 			k++;
 		}
 	}
@@ -28,21 +30,63 @@ void card_init(){
 void card_shuffle(uint16_t seed){
 	srand(seed); //This will be from the ticks or preset number
 	deckIndex = 0; //Ensures we start at top
+	dealt = 0;
 	//Utilize the fisher-yates shuffle
 	for(int i=51; i > 0; i--){
 		//Pick random index from 0 to i
 		uint8_t j = rand() % (i+1);
 		
 		//Swap deck[i] and deck[j]
-		Card temp = deck[i];
+		PackedCard temp = deck[i];
 		deck[i] = deck[j];
 		deck[j] = temp;
 	}
 }
 
 Card get_card(uint8_t index){
+	return card_unpack(deck[index]);
+}
+PackedCard get_packed(uint8_t index){
 	return deck[index];
 }
+uint8_t card_index(Card c){
+	return (uint8_t)(c.suit * 13 + c.rank - 1);
+}
+Card card_from_index(uint8_t index){
+	Card c;
+	c.rank = (uint8_t)(index % 13 + 1);
+	c.suit = (Suit)(index / 13);
+	return c;
+}
+PackedCard card_pack(Card c){
+	return CARD_PACK(c.rank, c.suit);
+}
+Card card_unpack(PackedCard p){
+	Card c;
+	c.rank = PACKED_RANK(p);
+	c.suit = PACKED_SUIT(p);
+	return c;
+}
+uint8_t card_set_count(CardSet s){
+	//Per byte Kernighan count, a 64 bit loop is much slower on the AVR
+	uint8_t n = 0;
+	for(uint8_t i = 0; i < 8; i++){
+		uint8_t b = (uint8_t)s;
+		while(b){
+			b &= (uint8_t)(b - 1);
+			n++;
+		}
+		s >>= 8;
+	}
+	return n;
+}
+CardSet card_set_of(const Card *cards, uint8_t n){
+	CardSet s = 0;
+	for(uint8_t i = 0; i < n; i++){
+		card_set_add(&s, card_pack(cards[i]));
+	}
+	return s;
+}
 void player_init(Player *p, uint16_t startingMoney){
 	p->money = startingMoney;
 	p->currentBet = 0;
@@ -55,22 +99,42 @@ void card_toString(Card c, char *buf, uint8_t bufSize)
 
 	snprintf(buf, bufSize, "%s%s", ranks[c.rank], suits[c.suit]);
 }
+void card_toString_packed(PackedCard p, char *buf, uint8_t bufSize){
+	card_toString(card_unpack(p), buf, bufSize);
+}
 
 
-Card draw_card(){
+PackedCard draw_packed(){
 	if (deckIndex >= 52){
 		deckIndex = 0;
 		card_shuffle(12345);
 	}
+	card_set_add(&dealt, deck[deckIndex]);
 	return deck[deckIndex++]; //Get the topmost card and move onto the next 1
 }
 
+Card draw_card(){
+	return card_unpack(draw_packed());
+}
+
+CardSet cards_dealt(void){
+	return dealt;
+}
+
 void deal_player_cards(Game *g){
 	g->p1.card1 = draw_card();
 	g->p1.card2 = draw_card();
+#ifdef GAME_OMAHA
+	g->p1.card3 = draw_card();
+	g->p1.card4 = draw_card();
+#endif
 	
 	g->p2.card1 = draw_card();
 	g->p2.card2 = draw_card();
+#ifdef GAME_OMAHA
+	g->p2.card3 = draw_card();
+	g->p2.card4 = draw_card();
+#endif
 }
 
 void game_init(Game *g){
@@ -94,14 +158,6 @@ void deal_community(Game *g, uint8_t count){
 	}
 }
 
-static uint8_t rank_value(uint8_t rank){
-	//A should be 14, others can be normal e.g 2 = 2, J=11
-	if (rank == 1){
-		return 14;
-	}
-	return rank;
-}
-
 static uint8_t find_high_card_of_straight(const uint8_t rankPresent[15]){
 	//returns high card of straight (5-14) or 0 if no straight exists
 	//rankPresent is if that rank exists within the 5 card combination
@@ -126,10 +182,9 @@ static uint8_t find_high_card_of_straight(const uint8_t rankPresent[15]){
 	return 0;
 }
 
-HandValue evaluate_best_hand(Card cards[7]){
-	
-	HandValue hv;
-	hv.type = HAND_HIGH_CARD; //Default
+HandValue evaluate_best_hand_counting(Card cards[7]){
+	//Reference evaluator using per-rank/per-suit counting arrays, kept for cross-checking
+	HandValue hv = {HAND_HIGH_CARD, {0}}; //Default, unused tie breakers stay 0
 	
 	uint8_t rankCount[15] = {0}; //Count how many times rank appears 
 	uint8_t suitCount[4] = {0}; //0,1,2,3 = suits, count how many times suits appears
@@ -137,7 +192,7 @@ HandValue evaluate_best_hand(Card cards[7]){
 	
 	//Getting the counts
 	for(int i = 0; i < 7; i++){
-		uint8_t rank = rank_value(cards[i].rank);
+		uint8_t rank = card_rank_value(cards[i].rank);
 		rankCount[rank]++;
 		rankPresent[rank] = 1;
 		
@@ -183,7 +238,7 @@ HandValue evaluate_best_hand(Card cards[7]){
 		//Get the ranks of that suit only
 		for(int i = 0; i < 7; i++){
 			if(cards[i].suit == flushSuit){
-				uint8_t v = rank_value(cards[i].rank);
+				uint8_t v = card_rank_value(cards[i].rank);
 				flushRankPresent[v] = 1;
 				
 			}
@@ -240,7 +295,7 @@ HandValue evaluate_best_hand(Card cards[7]){
 		//Collect all cards in flush suit in descending order
 		for(int v = 14; v>=2; v--){
 			for(int i = 0; i < 7; i++){
-				if(cards[i].suit == flushSuit && rank_value(cards[i].rank) == v){
+				if(cards[i].suit == flushSuit && card_rank_value(cards[i].rank) == v){
 					flushRanks[flushCount++] = (uint8_t)v;
 					break;
 				}
@@ -284,7 +339,7 @@ HandValue evaluate_best_hand(Card cards[7]){
 		hv.ranks[1] = pairRank[1]; //second pair
 		
 		//Kicker
-		for(int v = 14; v>=2; v++){
+		for(int v = 14; v>=2; v--){
 			if(v == pairRank[0] || v == pairRank[1]) continue;
 			if(rankCount[v] > 0){
 				hv.ranks[2] = (uint8_t)v;
@@ -319,7 +374,492 @@ HandValue evaluate_best_hand(Card cards[7]){
 		}
 	}
 	return hv;
-	
+
+}
+
+/*
+ * Bitmask evaluator
+ * Each suit is a 13 bit rank mask, bit 0 = 2 ... bit 12 = Ace.
+ * Pairs, trips and quads come from AND/OR of the four suit masks and straights
+ * from shifting the mask onto itself, so there are no counting arrays to clear or rescan.
+ */
+
+static uint8_t mask_top_ranks(uint16_t m, uint8_t *out, uint8_t n){
+	//Write up to n highest ranks (14..2) of the mask into out in descending order, returns how many
+	uint8_t k = 0;
+	uint16_t bit = RANK_BIT(14);
+	for(uint8_t v = 14; v >= 2 && k < n; v--){
+		if(m & bit){
+			out[k++] = v;
+		}
+		bit >>= 1;
+	}
+	return k;
+}
+
+static uint8_t mask_straight_high(uint16_t m){
+	//returns high card of straight (5-14) or 0 if no straight exists
+	//Bit 0 of ext is the Ace played low, so the wheel A-2-3-4-5 needs no special case
+	uint16_t ext = (uint16_t)(m << 1) | ((m >> 12) & 1);
+	uint16_t run = ext & (ext >> 1) & (ext >> 2) & (ext >> 3) & (ext >> 4);
+	if(run == 0){
+		return 0;
+	}
+	uint8_t high = 5; //Run bit i covers ext bits i..i+4, high card = i + 5
+	while(run >>= 1){
+		high++;
+	}
+	return high;
+}
+
+#if EVAL_BACKEND != EVAL_CONSTANT
+//Helpers of the mask evaluator in hand_acc_best(), EVAL_CONSTANT builds use hand_masks_best_const()
+static uint8_t mask_high_rank(uint16_t m){
+	//Highest rank in the mask, 0 if empty
+	uint8_t v = 0;
+	mask_top_ranks(m, &v, 1);
+	return v;
+}
+
+static uint8_t straight_high(uint16_t m){
+#if EVAL_BACKEND == EVAL_TABLES
+	return RANK_INFO_STRAIGHT(rank_table_word(&rankMaskInfo[m]));
+#else
+	return mask_straight_high(m);
+#endif
+}
+
+static void top_five_ranks(uint16_t m, uint8_t out[5]){
+	//Five highest ranks of a mask holding at least 5 ranks whose top five are not a straight
+#if EVAL_BACKEND == EVAL_TABLES
+	uint16_t five = RANK_INFO_FIVE(rank_table_word(&rankMaskInfo[m]));
+	if(five == RANK_FIVE_NONE){ //Fewer than 5 cards added to an accumulator
+		mask_top_ranks(m, out, 5);
+		return;
+	}
+	const uint8_t *src = fiveRankTable[five];
+	for(uint8_t i = 0; i < 5; i++){
+		out[i] = rank_table_byte(&src[i]);
+	}
+#else
+	mask_top_ranks(m, out, 5);
+#endif
+}
+#endif
+
+void hand_acc_init(HandAccumulator *acc){
+	acc->suitMask[0] = acc->suitMask[1] = acc->suitMask[2] = acc->suitMask[3] = 0;
+	acc->count = 0;
+}
+
+void hand_acc_add(HandAccumulator *acc, Card c){
+	acc->suitMask[c.suit] |= RANK_BIT(card_rank_value(c.rank));
+	acc->count++;
+}
+
+void hand_acc_add_packed(HandAccumulator *acc, PackedCard p){
+	acc->suitMask[PACKED_SUIT(p)] |= RANK_BIT(card_rank_value(PACKED_RANK(p)));
+	acc->count++;
+}
+
+HandValue hand_acc_best(const HandAccumulator *acc){
+#if EVAL_BACKEND == EVAL_CONSTANT
+	return hand_masks_best_const(acc->suitMask); //Same instructions whatever the cards
+#else
+	HandValue hv = {HAND_HIGH_CARD, {0}}; //Default, unused tie breakers stay 0
+	const uint16_t *suitMask = acc->suitMask;
+	uint16_t h = suitMask[0], d = suitMask[1], c = suitMask[2], s = suitMask[3];
+
+	//Rank multiplicities straight from the suit masks
+	uint16_t any = h | d | c | s; //At least 1 copy
+	uint16_t atLeast2 = (h & (d | c | s)) | (d & (c | s)) | (c & s);
+	uint16_t atLeast3 = (h & d & (c | s)) | (c & s & (h | d));
+	uint16_t quads = h & d & c & s;
+	uint16_t trips = atLeast3 & (uint16_t)~quads;
+	uint16_t pairs = atLeast2 & (uint16_t)~atLeast3;
+
+	//With 7 cards or fewer at most one suit can hold 5 or more
+	uint16_t flushMask = 0;
+	for(uint8_t su = 0; su < 4; su++){
+		if(rank_mask_count(suitMask[su]) >= 5){
+			flushMask = suitMask[su];
+			break;
+		}
+	}
+
+	//Straight Flush/Royal Flush
+	if(flushMask){
+		uint8_t straightFlushHigh = straight_high(flushMask);
+		if(straightFlushHigh != 0){
+			hv.type = (straightFlushHigh == 14) ? HAND_ROYAL_FLUSH : HAND_STRAIGHT_FLUSH;
+			hv.ranks[0] = straightFlushHigh;
+			return hv;
+		}
+	}
+
+	//Four of a kind, kicker is the highest other rank
+	if(quads){
+		hv.type = HAND_FOUR_OF_A_KIND;
+		hv.ranks[0] = mask_high_rank(quads);
+		hv.ranks[1] = mask_high_rank(any & (uint16_t)~RANK_BIT(hv.ranks[0]));
+		return hv;
+	}
+
+	//Full house, a second triple can act as the pair
+	if(trips){
+		uint8_t triple = mask_high_rank(trips);
+		uint16_t rest = (trips | pairs) & (uint16_t)~RANK_BIT(triple);
+		if(rest){
+			hv.type = HAND_FULL_HOUSE;
+			hv.ranks[0] = triple;
+			hv.ranks[1] = mask_high_rank(rest);
+			return hv;
+		}
+	}
+
+	//Flush no straight, top 5 of the suit
+	if(flushMask){
+		hv.type = HAND_FLUSH;
+		top_five_ranks(flushMask, hv.ranks);
+		return hv;
+	}
+
+	//Straight no flush
+	uint8_t straightHigh = straight_high(any);
+	if(straightHigh != 0){
+		hv.type = HAND_STRAIGHT;
+		hv.ranks[0] = straightHigh;
+		return hv;
+	}
+
+	//Three of a kind, 2 kickers
+	if(trips){
+		hv.type = HAND_THREE_OF_A_KIND;
+		hv.ranks[0] = mask_high_rank(trips);
+		mask_top_ranks(any & (uint16_t)~trips, &hv.ranks[1], 2);
+		return hv;
+	}
+
+	//Two Pair, the kicker may come from a third pair
+	if(rank_mask_count(pairs) >= 2){
+		hv.type = HAND_TWO_PAIR;
+		mask_top_ranks(pairs, hv.ranks, 2);
+		hv.ranks[2] = mask_high_rank(any & (uint16_t)~(RANK_BIT(hv.ranks[0]) | RANK_BIT(hv.ranks[1])));
+		return hv;
+	}
+
+	//One pair, 3 kickers
+	if(pairs){
+		hv.type = HAND_ONE_PAIR;
+		hv.ranks[0] = mask_high_rank(pairs);
+		mask_top_ranks(any & (uint16_t)~pairs, &hv.ranks[1], 3);
+		return hv;
+	}
+
+	//High Card
+	top_five_ranks(any, hv.ranks);
+	return hv;
+#endif
+}
+
+/*
+ * Tiny evaluator
+ * Same rules, written for code size: every category picks its group ranks (quads, trips,
+ * pairs) and then fills the kickers with the one shared loop below.
+ */
+static void fill_kickers(HandValue *hv, uint8_t start, uint8_t total, uint16_t m){
+	//Add the highest ranks of m that are not already in ranks[0..start-1]
+	for(uint8_t i = 0; i < start; i++){
+		m &= (uint16_t)~RANK_BIT(hv->ranks[i]);
+	}
+	mask_top_ranks(m, &hv->ranks[start], total - start);
+}
+
+HandValue evaluate_best_hand_tiny(Card cards[7]){
+	HandValue hv = {HAND_HIGH_CARD, {0}};
+	uint8_t rankCount[15] = {0};
+	uint16_t suitMask[4] = {0};
+	uint16_t any = 0, flushMask = 0;
+
+	for(uint8_t i = 0; i < 7; i++){
+		uint8_t v = card_rank_value(cards[i].rank);
+		rankCount[v]++;
+		suitMask[cards[i].suit] |= RANK_BIT(v);
+		any |= RANK_BIT(v);
+	}
+	for(uint8_t su = 0; su < 4; su++){
+		if(rank_mask_count(suitMask[su]) >= 5) flushMask = suitMask[su];
+	}
+
+	//Group ranks: most copies first, then highest rank
+	uint8_t groups[3] = {0}, groupCount[3] = {0}, n = 0;
+	for(uint8_t c = 4; c >= 2; c--){
+		for(uint8_t v = 14; v >= 2; v--){
+			if(rankCount[v] == c && n < 3){
+				groups[n] = v;
+				groupCount[n++] = c;
+			}
+		}
+	}
+
+	uint8_t high = flushMask ? mask_straight_high(flushMask) : 0;
+	uint8_t keep = 0, total = 5; //Group ranks kept, tie breakers in total
+	uint16_t from = any;
+	if(high){
+		hv.type = (high == 14) ? HAND_ROYAL_FLUSH : HAND_STRAIGHT_FLUSH;
+		hv.ranks[0] = high;
+		return hv;
+	}
+	else if(groupCount[0] == 4){
+		hv.type = HAND_FOUR_OF_A_KIND; keep = 1; total = 2;
+	}
+	else if(groupCount[0] == 3 && groupCount[1] >= 2){
+		hv.type = HAND_FULL_HOUSE; keep = 2; total = 2;
+	}
+	else if(flushMask){
+		hv.type = HAND_FLUSH; from = flushMask;
+	}
+	else if((high = mask_straight_high(any)) != 0){
+		hv.type = HAND_STRAIGHT;
+		hv.ranks[0] = high;
+		return hv;
+	}
+	else if(groupCount[0] == 3){
+		hv.type = HAND_THREE_OF_A_KIND; keep = 1; total = 3;
+	}
+	else if(groupCount[1] == 2){
+		hv.type = HAND_TWO_PAIR; keep = 2; total = 3;
+	}
+	else if(groupCount[0] == 2){
+		hv.type = HAND_ONE_PAIR; keep = 1; total = 4;
+	}
+	for(uint8_t i = 0; i < keep; i++){
+		hv.ranks[i] = groups[i];
+	}
+	fill_kickers(&hv, keep, total, from);
+	return hv;
+}
+
+/*
+ * Constant time evaluator
+ * Every hand runs the same instructions: all categories are tested with mask arithmetic,
+ * the strongest one found selects (branch free) which masks feed the rank picking, and
+ * rank picking always walks all 13 ranks. No early returns, no loops that stop on the data,
+ * no variable shifts (AVR shifts by a register are loops), so the cycle count only moves
+ * by the odd skipped instruction the compiler emits for a compare.
+ */
+static const uint16_t constRankBit[14] RANK_TABLE = { //Card rank 1-13 (A = 1) to rank mask bit
+	0, RANK_BIT(14), RANK_BIT(2), RANK_BIT(3), RANK_BIT(4), RANK_BIT(5), RANK_BIT(6),
+	RANK_BIT(7), RANK_BIT(8), RANK_BIT(9), RANK_BIT(10), RANK_BIT(11), RANK_BIT(12), RANK_BIT(13)
+};
+
+static uint8_t nonzero_ct(uint16_t x){
+	//1 if x != 0, without a branch
+	return (uint8_t)((x | (uint16_t)-x) >> 15);
+}
+
+static uint8_t count_ct(uint16_t m){
+	//Bits set, SWAR instead of a loop
+	m = m - ((m >> 1) & 0x5555);
+	m = (m & 0x3333) + ((m >> 2) & 0x3333);
+	m = (m + (m >> 4)) & 0x0F0F;
+	return (uint8_t)(m + (m >> 8)) & 0x1F;
+}
+
+static uint16_t sel16_ct(uint8_t c, uint16_t a, uint16_t b){
+	//c ? a : b for c = 0 or 1
+	return b ^ ((a ^ b) & (uint16_t)-c);
+}
+
+static uint8_t sel8_ct(uint8_t c, uint8_t a, uint8_t b){
+	return b ^ ((a ^ b) & (uint8_t)-c);
+}
+
+static uint16_t straight_run_ct(uint16_t m){
+	//Bit i set if ranks i+1..i+5 are all present (Ace also low), i + 3 is the high card's mask bit
+	uint16_t ext = (uint16_t)(m << 1) | ((m >> 12) & 1);
+	return ext & (ext >> 1) & (ext >> 2) & (ext >> 3) & (ext >> 4);
+}
+
+static uint8_t top_rank_ct(uint16_t m, uint16_t *bit){
+	//Highest rank (2-14) in m and its mask bit, 0 and 0 if m is empty. Always 13 steps
+	uint8_t r = 0;
+	uint16_t b = 0, cur = 1;
+	for(uint8_t v = 2; v <= 14; v++){
+		uint8_t t = (uint8_t)(m & 1);
+		r = sel8_ct(t, v, r);
+		b = sel16_ct(t, cur, b);
+		m >>= 1;
+		cur <<= 1;
+	}
+	*bit = b;
+	return r;
+}
+
+HandValue evaluate_best_hand_const(Card cards[7]){
+	uint16_t suitMask[4] = {0, 0, 0, 0};
+	for(uint8_t i = 0; i < 7; i++){
+		suitMask[cards[i].suit & 3] |= rank_table_word(&constRankBit[cards[i].rank]);
+	}
+	return hand_masks_best_const(suitMask);
+}
+
+HandValue hand_masks_best_const(const uint16_t suitMask[4]){
+	HandValue hv = {HAND_HIGH_CARD, {0}};
+	uint16_t h = suitMask[0], d = suitMask[1], c = suitMask[2], s = suitMask[3];
+	uint16_t any = h | d | c | s;
+	uint16_t atLeast2 = (h & (d | c | s)) | (d & (c | s)) | (c & s);
+	uint16_t atLeast3 = (h & d & (c | s)) | (c & s & (h | d));
+	uint16_t quads = h & d & c & s;
+	uint16_t trips = atLeast3 & (uint16_t)~quads;
+	uint16_t pairs = atLeast2 & (uint16_t)~atLeast3;
+
+	uint16_t flushMask = 0;
+	for(uint8_t su = 0; su < 4; su++){
+		//(count + 3) >> 3 is 1 for 5-7 cards in the suit, 0 below
+		flushMask |= suitMask[su] & (uint16_t)-(uint16_t)((count_ct(suitMask[su]) + 3) >> 3);
+	}
+	uint16_t run = straight_run_ct(any);
+	uint16_t flushRun = straight_run_ct(flushMask);
+
+	//Weakest category first, every stronger one that holds overrides what it picks:
+	//g1 and g2 give one rank each (quads, trips, pairs, straight high), pool the kickers
+	uint8_t type = HAND_HIGH_CARD, kick = 5, k;
+	uint16_t g1 = 0, g2 = 0, pool = any;
+	k = nonzero_ct(pairs);
+	type = sel8_ct(k, HAND_ONE_PAIR, type); g1 = sel16_ct(k, pairs, g1); kick = sel8_ct(k, 3, kick);
+	k = nonzero_ct(pairs & (uint16_t)(pairs - 1));
+	type = sel8_ct(k, HAND_TWO_PAIR, type); g2 = sel16_ct(k, pairs, g2); kick = sel8_ct(k, 1, kick);
+	k = nonzero_ct(trips);
+	type = sel8_ct(k, HAND_THREE_OF_A_KIND, type); g1 = sel16_ct(k, trips, g1); g2 = sel16_ct(k, 0, g2); kick = sel8_ct(k, 2, kick);
+	k = nonzero_ct(run);
+	type = sel8_ct(k, HAND_STRAIGHT, type); g1 = sel16_ct(k, run << 3, g1); g2 = sel16_ct(k, 0, g2); kick = sel8_ct(k, 0, kick);
+	k = nonzero_ct(flushMask);
+	type = sel8_ct(k, HAND_FLUSH, type); g1 = sel16_ct(k, 0, g1); g2 = sel16_ct(k, 0, g2); pool = sel16_ct(k, flushMask, pool); kick = sel8_ct(k, 5, kick);
+	k = nonzero_ct(trips) & (nonzero_ct(trips & (uint16_t)(trips - 1)) | nonzero_ct(pairs));
+	type = sel8_ct(k, HAND_FULL_HOUSE, type); g1 = sel16_ct(k, trips, g1); g2 = sel16_ct(k, trips | pairs, g2); kick = sel8_ct(k, 0, kick);
+	k = nonzero_ct(quads);
+	type = sel8_ct(k, HAND_FOUR_OF_A_KIND, type); g1 = sel16_ct(k, quads, g1); g2 = sel16_ct(k, 0, g2); pool = sel16_ct(k, any, pool); kick = sel8_ct(k, 1, kick);
+	k = nonzero_ct(flushRun);
+	type = sel8_ct(k, HAND_STRAIGHT_FLUSH + ((flushRun >> 9) & 1), type); //Run bit 9 is the Ace high straight
+	g1 = sel16_ct(k, flushRun << 3, g1); g2 = sel16_ct(k, 0, g2); kick = sel8_ct(k, 0, kick);
+
+	//Group ranks, then kickers, written at a moving slot so unused slots end up 0
+	uint8_t out[8] = {0};
+	uint16_t b0, b1;
+	out[0] = top_rank_ct(g1, &b0);
+	k = nonzero_ct(g1);
+	g2 &= (uint16_t)~b0;
+	out[k] = top_rank_ct(g2, &b1);
+	k += nonzero_ct(g2);
+	pool &= (uint16_t)~(b0 | b1);
+	for(uint8_t v = 14; v >= 2; v--){
+		uint8_t take = (uint8_t)(pool >> 12) & 1 & (uint8_t)((uint8_t)-kick >> 7); //Bit set and kickers left
+		out[k] = v & (uint8_t)-take;
+		k += take;
+		kick -= take;
+		pool <<= 1;
+	}
+	hv.type = (HandRankType)type;
+	for(uint8_t i = 0; i < 5; i++){
+		hv.ranks[i] = out[i];
+	}
+	return hv;
+}
+
+HandValue evaluate_best_hand(Card cards[7]){
+#if EVAL_BACKEND == EVAL_COUNTING
+	return evaluate_best_hand_counting(cards);
+#elif EVAL_BACKEND == EVAL_TINY
+	return evaluate_best_hand_tiny(cards);
+#elif EVAL_BACKEND == EVAL_CONSTANT
+	return evaluate_best_hand_const(cards);
+#else
+	HandAccumulator acc;
+	hand_acc_init(&acc);
+	for(uint8_t i = 0; i < 7; i++){
+		hand_acc_add(&acc, cards[i]);
+	}
+	return hand_acc_best(&acc);
+#endif
+}
+
+uint8_t hand_best_cards(const HandValue *hv, const Card *cards, uint8_t n){
+	//How many cards of each rank the hand uses, then one pass over the cards claims them
+	uint8_t need[15] = {0};
+	const uint8_t *r = hv->ranks;
+	int8_t suit = -1; //Flushes must take their cards from the flush suit
+	switch(hv->type){
+		case HAND_STRAIGHT_FLUSH:
+		case HAND_ROYAL_FLUSH:
+		case HAND_STRAIGHT:
+			for(uint8_t k = 0; k < 5; k++){
+				uint8_t v = r[0] - k;
+				need[card_rank_value(v)] = 1; //Wheel: 5-4-3-2-A
+			}
+			break;
+		case HAND_FOUR_OF_A_KIND:
+			need[r[0]] = 4; need[r[1]] = 1;
+			break;
+		case HAND_FULL_HOUSE:
+			need[r[0]] = 3; need[r[1]] = 2;
+			break;
+		case HAND_THREE_OF_A_KIND:
+			need[r[0]] = 3; need[r[1]] = 1; need[r[2]] = 1;
+			break;
+		case HAND_TWO_PAIR:
+			need[r[0]] = 2; need[r[1]] = 2; need[r[2]] = 1;
+			break;
+		case HAND_ONE_PAIR:
+			need[r[0]] = 2; need[r[1]] = 1; need[r[2]] = 1; need[r[3]] = 1;
+			break;
+		default: //High card, flush
+			for(uint8_t k = 0; k < 5; k++){
+				need[r[k]] = 1;
+			}
+			break;
+	}
+	need[0] = 0; //Slots a short hand left empty
+
+	if(hv->type == HAND_FLUSH || hv->type == HAND_STRAIGHT_FLUSH || hv->type == HAND_ROYAL_FLUSH){
+		uint8_t suitCount[4] = {0};
+		for(uint8_t i = 0; i < n; i++){
+			if(++suitCount[cards[i].suit] >= 5) suit = cards[i].suit;
+		}
+	}
+
+	uint8_t used = 0;
+	for(uint8_t i = 0; i < n; i++){
+		uint8_t v = card_rank_value(cards[i].rank);
+		if(need[v] && (suit < 0 || cards[i].suit == (Suit)suit)){
+			need[v]--;
+			used |= (uint8_t)(1 << i);
+		}
+	}
+	return used;
+}
+
+HandValue evaluate_best_hand_packed(const PackedCard cards[7]){
+	//Unpacked into a 21 byte scratch array so every backend sees plain Cards
+	Card c[7];
+	for(uint8_t i = 0; i < 7; i++){
+		c[i] = card_unpack(cards[i]);
+	}
+	return evaluate_best_hand(c);
+}
+
+const char* eval_backend_name(void){
+#if EVAL_BACKEND == EVAL_COUNTING
+	return "counting";
+#elif EVAL_BACKEND == EVAL_BITMASK
+	return "bitmask";
+#elif EVAL_BACKEND == EVAL_TABLES
+	return "tables";
+#elif EVAL_BACKEND == EVAL_CONSTANT
+	return "constant";
+#else
+	return "tiny";
+#endif
 }
 
 int compare_hands(const HandValue *a , const HandValue *b){
@@ -335,6 +875,80 @@ int compare_hands(const HandValue *a , const HandValue *b){
 	return 0; //Tie
 }
 
+/*
+ * Hand strength
+ * Every 5 card hand falls in one of 7462 equivalence classes. Each category owns a
+ * contiguous block of values and inside a block the tie breakers are ranked with
+ * colex ordering, which compares the highest rank first exactly like compare_hands().
+ * strengthBase, binom and straightColex are generated into eval_tables.h by tools/gen_tables.cpp.
+ */
+
+static uint16_t colex_index(const uint8_t *desc, uint8_t k, uint16_t skipMask){
+	//desc: k distinct rank values in descending order. Ranks in skipMask are removed from the
+	//rank line first, so kickers are numbered among the ranks they can actually take
+	uint16_t idx = 0;
+	for(uint8_t i = 0; i < k; i++){
+		uint8_t r = desc[i] - 2;
+		r -= rank_mask_count(skipMask & (uint16_t)(RANK_BIT(desc[i]) - 1));
+		idx += rank_table_word(&binom[r][k - i]);
+	}
+	return idx;
+}
+
+static uint16_t five_rank_class(const uint8_t r[5]){
+	//0..1276 for 5 distinct ranks that are not a straight, weakest first
+#if EVAL_BACKEND == EVAL_TABLES
+	uint16_t m = RANK_BIT(r[0]) | RANK_BIT(r[1]) | RANK_BIT(r[2]) | RANK_BIT(r[3]) | RANK_BIT(r[4]);
+	return RANK_INFO_FIVE(rank_table_word(&rankMaskInfo[m]));
+#else
+	uint16_t idx = colex_index(r, 5, 0);
+	uint16_t below = 0;
+	for(uint8_t i = 0; i < 10; i++){
+		if(rank_table_word(&straightColex[i]) < idx) below++;
+	}
+	return idx - below;
+#endif
+}
+
+uint16_t hand_strength(const HandValue *hv){
+	const uint8_t *r = hv->ranks;
+	uint16_t base = rank_table_word(&strengthBase[hv->type]);
+	switch(hv->type){
+		case HAND_HIGH_CARD:
+		case HAND_FLUSH:
+			return base + five_rank_class(r);
+		case HAND_ONE_PAIR:
+			return base + (r[0] - 2) * 220 + colex_index(&r[1], 3, RANK_BIT(r[0]));
+		case HAND_TWO_PAIR:
+			return base + colex_index(r, 2, 0) * 11 + colex_index(&r[2], 1, RANK_BIT(r[0]) | RANK_BIT(r[1]));
+		case HAND_THREE_OF_A_KIND:
+			return base + (r[0] - 2) * 66 + colex_index(&r[1], 2, RANK_BIT(r[0]));
+		case HAND_FULL_HOUSE:
+		case HAND_FOUR_OF_A_KIND:
+			return base + (r[0] - 2) * 12 + colex_index(&r[1], 1, RANK_BIT(r[0]));
+		case HAND_STRAIGHT:
+		case HAND_STRAIGHT_FLUSH:
+		case HAND_ROYAL_FLUSH:
+			return rank_table_word(&strengthBase[hv->type == HAND_STRAIGHT ? HAND_STRAIGHT : HAND_STRAIGHT_FLUSH]) + r[0] - 5;
+		default:
+			return 0;
+	}
+}
+
+uint16_t evaluate_hand_strength(Card cards[7]){
+	HandValue hv = evaluate_best_hand(cards);
+	return hand_strength(&hv);
+}
+
+HandRankType strength_to_type(uint16_t strength){
+	for(int8_t t = HAND_ROYAL_FLUSH; t > HAND_HIGH_CARD; t--){
+		if(strength >= rank_table_word(&strengthBase[t])){
+			return (HandRankType)t;
+		}
+	}
+	return HAND_HIGH_CARD;
+}
+
 const char* hand_type_to_string(HandRankType t)
 {
 	switch (t) {
@@ -0,0 +1,92 @@
+/*
+ * colex.c
+ *
+ * Colex rank of an ascending subset c0 < c1 < ... < c(k-1) is the sum of C(ci, i + 1).
+ * Sets are ordered by their highest card first, so all subsets of the first n cards come
+ * before any subset that uses card n, and the rank of a 2 card set is j * (j - 1) / 2 + i
+ * like the board cache combo index.
+ */ 
+
+#include "colex.h"
+
+uint32_t colex_count(uint8_t k){
+	//C(52, k) = C(51, k) + C(51, k - 1)
+	if(k == 0){
+		return 1;
+	}
+	return colex_binom(51, k) + colex_binom(51, k - 1);
+}
+
+uint32_t colex_rank(const uint8_t *idx, uint8_t k){
+	uint32_t r = 0;
+	for(uint8_t i = 0; i < k; i++){
+		r += colex_binom(idx[i], i + 1);
+	}
+	return r;
+}
+
+void colex_unrank(uint32_t rank, uint8_t k, uint8_t *idx){
+	//Largest c with C(c, i) <= rank, for i = k down to 1; c only ever moves down, so at most 52 steps in total
+	uint8_t c = 52;
+	for(uint8_t i = k; i > 0; i--){
+		uint32_t b;
+		do{
+			c--;
+			b = colex_binom(c, i);
+		}while(b > rank);
+		rank -= b;
+		idx[i - 1] = c;
+	}
+}
+
+uint8_t colex_next(uint8_t *idx, uint8_t k){
+	//Bump the lowest card that has room, reset the ones below it to 0, 1, 2...
+	for(uint8_t i = 0; i < k; i++){
+		uint8_t limit = (i + 1 < k) ? idx[i + 1] : 52;
+		if(idx[i] + 1 < limit){
+			idx[i]++;
+			for(uint8_t j = 0; j < i; j++){
+				idx[j] = j;
+			}
+			return 1;
+		}
+	}
+	return 0;
+}
+
+uint32_t colex_rank_cards(const Card *cards, uint8_t k){
+#if defined(__AVR__)
+	//Insertion sort, k is at most 7; a 64 bit mask would cost a shift loop per card here
+	uint8_t idx[COLEX_MAX_K];
+	for(uint8_t i = 0; i < k; i++){
+		uint8_t x = card_index(cards[i]);
+		uint8_t j = i;
+		while(j > 0 && idx[j - 1] > x){
+			idx[j] = idx[j - 1];
+			j--;
+		}
+		idx[j] = x;
+	}
+	return colex_rank(idx, k);
+#else
+	//Deck mask, then walk its bits low to high, no data dependent branches
+	uint64_t m = 0;
+	uint32_t r = 0;
+	for(uint8_t i = 0; i < k; i++){
+		m |= 1ull << card_index(cards[i]);
+	}
+	for(uint8_t i = 1; i <= k; i++){
+		r += colex_binom(__builtin_ctzll(m), i);
+		m &= m - 1;
+	}
+	return r;
+#endif
+}
+
+void colex_unrank_cards(uint32_t rank, uint8_t k, Card *cards){
+	uint8_t idx[COLEX_MAX_K];
+	colex_unrank(rank, k, idx);
+	for(uint8_t i = 0; i < k; i++){
+		cards[i] = card_from_index(idx[i]);
+	}
+}
@@ -0,0 +1,88 @@
+/*
+ * draws.c
+ *
+ * Straight outs come from five shifted copies of the rank mask (Ace also below the 2):
+ * a 5 rank window with exactly one rank missing is a draw to that rank, found for all
+ * ten windows at once. The same is done on the board ranks alone and removed, so only
+ * draws the hole cards take part in are reported. Flush draws are a 4 count in one suit.
+ * No loops over the deck or the windows, a few dozen 16 bit operations per call.
+ */ 
+
+#include "draws.h"
+
+#define RANK_MASK_ALL 0x1FFF
+
+static uint16_t straight_outs(uint16_t m){
+	//Ranks not in m that make a straight with it, 0 if m already holds one
+	uint16_t a0 = (uint16_t)(m << 1) | ((m >> 12) & 1); //Bit 0 is the Ace played low
+	uint16_t a1 = a0 >> 1, a2 = a0 >> 2, a3 = a0 >> 3, a4 = a0 >> 4;
+	uint16_t a01 = a0 & a1, a34 = a3 & a4;
+	if(a01 & a2 & a34){
+		return 0;
+	}
+	//Bit i of each term: window i..i+4 has every rank except offset k, shifted onto that rank
+	uint16_t ext = (~a0 & a1 & a2 & a34)
+		| ((a0 & ~a1 & a2 & a34) << 1)
+		| ((a01 & ~a2 & a34) << 2)
+		| ((a01 & a2 & ~a3 & a4) << 3)
+		| ((a01 & a2 & a3 & ~a4) << 4);
+	ext &= 0x3FFF;
+	return (ext >> 1) | ((ext & 1) << 12);
+}
+
+void draw_classify(const HandAccumulator *board, Card hole1, Card hole2, DrawInfo *di){
+	di->flags = 0;
+	di->overcards = 0;
+	di->outs = 0;
+	di->straightRanks = 0;
+	for(uint8_t s = 0; s < 4; s++){
+		di->outMask[s] = 0;
+	}
+	if(board->count < 3 || board->count > 4){
+		return;
+	}
+
+	HandAccumulator acc = *board;
+	hand_acc_add(&acc, hole1);
+	hand_acc_add(&acc, hole2);
+	const uint16_t *all = acc.suitMask;
+	const uint16_t *brd = board->suitMask;
+	uint16_t ranks = all[0] | all[1] | all[2] | all[3];
+	uint16_t boardRanks = brd[0] | brd[1] | brd[2] | brd[3];
+
+	//With at most 6 cards only one suit can hold 4
+	for(uint8_t s = 0; s < 4; s++){
+		if(rank_mask_count(all[s]) == 4 && rank_mask_count(brd[s]) < 4){
+			di->outMask[s] = RANK_MASK_ALL & ~all[s];
+			di->flags |= DRAW_FLUSH;
+		}
+	}
+
+	uint16_t sr = straight_outs(ranks) & ~straight_outs(boardRanks);
+	if(sr){
+		di->straightRanks = sr;
+		di->flags |= (sr & (sr - 1)) ? DRAW_OPEN_ENDED : DRAW_GUTSHOT;
+	}
+
+	//Overcards only for unpaired hole cards, a pocket pair above the board is an overpair
+	uint16_t over = 0;
+	uint16_t b1 = card_rank_bit(hole1), b2 = card_rank_bit(hole2);
+	if(b1 != b2){
+		if(b1 > boardRanks){
+			over |= b1;
+			di->overcards++;
+		}
+		if(b2 > boardRanks){
+			over |= b2;
+			di->overcards++;
+		}
+	}
+	if(over){
+		di->flags |= DRAW_OVERCARDS;
+	}
+
+	for(uint8_t s = 0; s < 4; s++){
+		di->outMask[s] |= (sr | over) & ~all[s];
+		di->outs += rank_mask_count(di->outMask[s]);
+	}
+}
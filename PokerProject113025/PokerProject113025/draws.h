@@ -0,0 +1,33 @@
+/*
+ * draws.h
+ *
+ * Drawing hands on the flop and turn: flush draw, open-ended and gutshot straight draws,
+ * overcards, and every unseen card that completes one of them. Works on the same per suit
+ * rank masks as HandAccumulator, so the board accumulator built while dealing is reused
+ * and the remaining deck is never enumerated.
+ */ 
+
+#ifndef DRAWS_H
+#define DRAWS_H
+
+#include <stdint.h>
+#include "card.h"
+
+#define DRAW_FLUSH 0x01 //4 to a flush, at least one of them a hole card
+#define DRAW_OPEN_ENDED 0x02 //Two ranks complete a straight (open-ended or double gutshot)
+#define DRAW_GUTSHOT 0x04 //One rank completes a straight
+#define DRAW_OVERCARDS 0x08 //Unpaired hole card(s) above every board card, see overcards
+
+typedef struct{
+	uint8_t flags; //DRAW_* bits
+	uint8_t overcards; //0-2 hole cards above the board
+	uint8_t outs; //Cards set in outMask
+	uint16_t straightRanks; //Ranks that complete the straight draw, bit 0 = 2 ... bit 12 = Ace
+	uint16_t outMask[4]; //52 bit set of unseen outs, one rank mask per suit as in HandAccumulator
+} DrawInfo;
+
+//board holds the 3 or 4 board cards (5 gives no draws). Hole cards only count when they take
+//part: a board that is 4 to a straight or flush on its own is everyone's draw, not the player's
+void draw_classify(const HandAccumulator *board, Card hole1, Card hole2, DrawInfo *di);
+
+#endif
@@ -0,0 +1,24 @@
+/*
+ * eval_bench.h
+ *
+ * On-target cycle benchmark for the hand evaluators.
+ * Build with EVAL_BENCH defined and main() prints the report over USART3 before the game starts.
+ * With GAME_OMAHA as well it adds omaha_best() against the 60 combo brute force.
+ */ 
+
+#ifndef EVAL_BENCH_H
+#define EVAL_BENCH_H
+
+#include <stdint.h>
+#include "card.h"
+
+typedef HandValue (*EvalFn)(Card cards[7]);
+
+typedef struct{
+	const char *name;
+	EvalFn eval;
+} EvalBackend;
+
+void eval_bench_run(void); //Time every backend over the fixed corpus and print min/avg/max cycles
+
+#endif
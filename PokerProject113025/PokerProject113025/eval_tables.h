@@ -0,0 +1,26 @@
+/*
+ * eval_tables.h
+ *
+ * Generated by tools/gen_tables.cpp, do not edit.
+ */ 
+
+#ifndef EVAL_TABLES_H
+#define EVAL_TABLES_H
+
+#include "rank_tables.h" //RANK_TABLE, read with rank_table_word()
+
+//First strength value of each HandRankType, high card up to royal flush
+static const uint16_t strengthBase[10] RANK_TABLE = {1, 1278, 4138, 4996, 5854, 5864, 7141, 7297, 7453, 7462};
+
+static const uint16_t binom[13][6] RANK_TABLE = { //C(n,k) for n < 13, k <= 5
+	{1,0,0,0,0,0},{1,1,0,0,0,0},{1,2,1,0,0,0},{1,3,3,1,0,0},{1,4,6,4,1,0},
+	{1,5,10,10,5,1},{1,6,15,20,15,6},{1,7,21,35,35,21},{1,8,28,56,70,56},{1,9,36,84,126,126},
+	{1,10,45,120,210,252},{1,11,55,165,330,462},{1,12,66,220,495,792}
+};
+
+#if EVAL_BACKEND != EVAL_TABLES
+//Colex index of the 5 card straights (high 5..14), these are skipped when ranking 5 distinct ranks
+static const uint16_t straightColex[10] RANK_TABLE = {792, 0, 5, 20, 55, 125, 251, 461, 791, 1286};
+#endif
+
+#endif
@@ -0,0 +1,67 @@
+/*
+ * flop_texture.c
+ *
+ * Cards are taken highest rank first. An unpaired flop's ranks i > j > k (0 = 2 ... 12 = Ace)
+ * get the colex rank k + j(j - 1)/2 + i(i - 1)(i - 2)/6, and its suits are monotone, rainbow,
+ * or two-tone with the highest, middle or lowest card the odd one out.
+ */ 
+
+#include "flop_texture.h"
+
+uint16_t flop_canonical(const Card flop[3]){
+	//Sort the three cards by rank, highest first
+	Card a = flop[0], b = flop[1], c = flop[2], t;
+	if(card_rank_index(b.rank) > card_rank_index(a.rank)){
+		t = a; a = b; b = t;
+	}
+	if(card_rank_index(c.rank) > card_rank_index(b.rank)){
+		t = b; b = c; c = t;
+	}
+	if(card_rank_index(b.rank) > card_rank_index(a.rank)){
+		t = a; a = b; b = t;
+	}
+	uint8_t i = card_rank_index(a.rank), j = card_rank_index(b.rank), k = card_rank_index(c.rank);
+
+	if(i == k){
+		return FLOP_TRIPS_BASE + i;
+	}
+	if(i == j || j == k){
+		//Pair, the kicker's suit either matches one of the pair's or it does not
+		uint8_t pair = j;
+		Card kicker = (i == j) ? c : a;
+		uint8_t kick = card_rank_index(kicker.rank);
+		uint8_t match = (i == j) ? (c.suit == a.suit || c.suit == b.suit) : (a.suit == b.suit || a.suit == c.suit);
+		return FLOP_PAIRED_BASE + (pair * 12 + ((kick < pair) ? kick : kick - 1)) * 2 + match;
+	}
+	uint16_t set = k + j * (j - 1) / 2 + (uint16_t)i * (i - 1) * (i - 2) / 6;
+	uint8_t pattern;
+	if(a.suit == b.suit && b.suit == c.suit){
+		pattern = 0;
+	}
+	else if(a.suit != b.suit && b.suit != c.suit && a.suit != c.suit){
+		pattern = 1;
+	}
+	else if(b.suit == c.suit){
+		pattern = 2;
+	}
+	else if(a.suit == c.suit){
+		pattern = 3;
+	}
+	else{
+		pattern = 4;
+	}
+	return set * 5 + pattern;
+}
+
+uint16_t flop_texture(const Card flop[3]){
+	return flash_table_word(&flopTexture[flop_canonical(flop)]);
+}
+
+const char* flop_suits_to_string(uint8_t suits){
+	switch(suits){
+		case FLOP_RAINBOW: return "rainbow";
+		case FLOP_TWO_TONE: return "two-tone";
+		case FLOP_MONOTONE: return "monotone";
+		default: return "?";
+	}
+}
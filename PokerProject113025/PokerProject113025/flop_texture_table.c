@@ -0,0 +1,157 @@
+/*
+ * flop_texture_table.c
+ *
+ * Generated by tools/gen_flop_texture.c, do not edit.
+ */ 
+
+#include "flop_texture.h"
+
+const uint16_t flopTexture[FLOP_CANONICAL] FLASH_TABLE = {
+	4644, 4612, 4628, 4628, 4628, 6693, 6661, 6677, 6677, 6677, 6693, 6661,
+	6677, 6677, 6677, 4901, 4869, 4885, 4885, 4885, 8486, 8454, 8470, 8470,
+	8470, 8486, 8454, 8470, 8470, 8470, 6694, 6662, 6678, 6678, 6678, 8486,
+	8454, 8470, 8470, 8470, 6694, 6662, 6678, 6678, 6678, 4902, 4870, 4886,
+	4886, 4886, 10279, 10247, 10263, 10263, 10263, 10279, 10247, 10263, 10263, 10263,
+	8487, 8455, 8471, 8471, 8471, 10279, 10247, 10263, 10263, 10263, 8487, 8455,
+	8471, 8471, 8471, 6695, 6663, 6679, 6679, 6679, 10279, 10247, 10263, 10263,
+	10263, 8487, 8455, 8471, 8471, 8471, 6695, 6663, 6679, 6679, 6679, 4903,
+	4871, 4887, 4887, 4887, 12328, 12296, 12312, 12312, 12312, 12328, 12296, 12312,
+	12312, 12312, 10280, 10248, 10264, 10264, 10264, 12328, 12296, 12312, 12312, 12312,
+	10280, 10248, 10264, 10264, 10264, 8488, 8456, 8472, 8472, 8472, 12328, 12296,
+	12312, 12312, 12312, 10280, 10248, 10264, 10264, 10264, 8488, 8456, 8472, 8472,
+	8472, 6696, 6664, 6680, 6680, 6680, 12328, 12296, 12312, 12312, 12312, 10280,
+	10248, 10264, 10264, 10264, 8488, 8456, 8472, 8472, 8472, 6696, 6664, 6680,
+	6680, 6680, 4904, 4872, 4888, 4888, 4888, 14377, 14345, 14361, 14361, 14361,
+	14377, 14345, 14361, 14361, 14361, 12329, 12297, 12313, 12313, 12313, 14377, 14345,
+	14361, 14361, 14361, 12329, 12297, 12313, 12313, 12313, 10281, 10249, 10265, 10265,
+	10265, 14377, 14345, 14361, 14361, 14361, 12329, 12297, 12313, 12313, 12313, 10281,
+	10249, 10265, 10265, 10265, 8489, 8457, 8473, 8473, 8473, 14377, 14345, 14361,
+	14361, 14361, 12329, 12297, 12313, 12313, 12313, 10281, 10249, 10265, 10265, 10265,
+	8489, 8457, 8473, 8473, 8473, 6697, 6665, 6681, 6681, 6681, 14377, 14345,
+	14361, 14361, 14361, 12329, 12297, 12313, 12313, 12313, 10281, 10249, 10265, 10265,
+	10265, 8489, 8457, 8473, 8473, 8473, 6697, 6665, 6681, 6681, 6681, 4905,
+	4873, 4889, 4889, 4889, 16426, 16394, 16410, 16410, 16410, 16426, 16394, 16410,
+	16410, 16410, 14378, 14346, 14362, 14362, 14362, 16426, 16394, 16410, 16410, 16410,
+	14378, 14346, 14362, 14362, 14362, 12330, 12298, 12314, 12314, 12314, 16426, 16394,
+	16410, 16410, 16410, 14378, 14346, 14362, 14362, 14362, 12330, 12298, 12314, 12314,
+	12314, 10282, 10250, 10266, 10266, 10266, 16426, 16394, 16410, 16410, 16410, 14378,
+	14346, 14362, 14362, 14362, 12330, 12298, 12314, 12314, 12314, 10282, 10250, 10266,
+	10266, 10266, 8490, 8458, 8474, 8474, 8474, 16426, 16394, 16410, 16410, 16410,
+	14378, 14346, 14362, 14362, 14362, 12330, 12298, 12314, 12314, 12314, 10282, 10250,
+	10266, 10266, 10266, 8490, 8458, 8474, 8474, 8474, 6698, 6666, 6682, 6682,
+	6682, 16426, 16394, 16410, 16410, 16410, 14378, 14346, 14362, 14362, 14362, 12330,
+	12298, 12314, 12314, 12314, 10282, 10250, 10266, 10266, 10266, 8490, 8458, 8474,
+	8474, 8474, 6698, 6666, 6682, 6682, 6682, 4906, 4874, 4890, 4890, 4890,
+	18475, 18443, 18459, 18459, 18459, 18475, 18443, 18459, 18459, 18459, 16427, 16395,
+	16411, 16411, 16411, 18475, 18443, 18459, 18459, 18459, 16427, 16395, 16411, 16411,
+	16411, 14379, 14347, 14363, 14363, 14363, 18475, 18443, 18459, 18459, 18459, 16427,
+	16395, 16411, 16411, 16411, 14379, 14347, 14363, 14363, 14363, 12331, 12299, 12315,
+	12315, 12315, 18475, 18443, 18459, 18459, 18459, 16427, 16395, 16411, 16411, 16411,
+	14379, 14347, 14363, 14363, 14363, 12331, 12299, 12315, 12315, 12315, 10283, 10251,
+	10267, 10267, 10267, 18475, 18443, 18459, 18459, 18459, 16427, 16395, 16411, 16411,
+	16411, 14379, 14347, 14363, 14363, 14363, 12331, 12299, 12315, 12315, 12315, 10283,
+	10251, 10267, 10267, 10267, 8491, 8459, 8475, 8475, 8475, 18475, 18443, 18459,
+	18459, 18459, 16427, 16395, 16411, 16411, 16411, 14379, 14347, 14363, 14363, 14363,
+	12331, 12299, 12315, 12315, 12315, 10283, 10251, 10267, 10267, 10267, 8491, 8459,
+	8475, 8475, 8475, 6699, 6667, 6683, 6683, 6683, 18475, 18443, 18459, 18459,
+	18459, 16427, 16395, 16411, 16411, 16411, 14379, 14347, 14363, 14363, 14363, 12331,
+	12299, 12315, 12315, 12315, 10283, 10251, 10267, 10267, 10267, 8491, 8459, 8475,
+	8475, 8475, 6699, 6667, 6683, 6683, 6683, 4907, 4875, 4891, 4891, 4891,
+	20524, 20492, 20508, 20508, 20508, 20524, 20492, 20508, 20508, 20508, 18476, 18444,
+	18460, 18460, 18460, 20524, 20492, 20508, 20508, 20508, 18476, 18444, 18460, 18460,
+	18460, 16428, 16396, 16412, 16412, 16412, 20524, 20492, 20508, 20508, 20508, 18476,
+	18444, 18460, 18460, 18460, 16428, 16396, 16412, 16412, 16412, 14380, 14348, 14364,
+	14364, 14364, 20524, 20492, 20508, 20508, 20508, 18476, 18444, 18460, 18460, 18460,
+	16428, 16396, 16412, 16412, 16412, 14380, 14348, 14364, 14364, 14364, 12332, 12300,
+	12316, 12316, 12316, 20524, 20492, 20508, 20508, 20508, 18476, 18444, 18460, 18460,
+	18460, 16428, 16396, 16412, 16412, 16412, 14380, 14348, 14364, 14364, 14364, 12332,
+	12300, 12316, 12316, 12316, 10284, 10252, 10268, 10268, 10268, 20524, 20492, 20508,
+	20508, 20508, 18476, 18444, 18460, 18460, 18460, 16428, 16396, 16412, 16412, 16412,
+	14380, 14348, 14364, 14364, 14364, 12332, 12300, 12316, 12316, 12316, 10284, 10252,
+	10268, 10268, 10268, 8492, 8460, 8476, 8476, 8476, 20524, 20492, 20508, 20508,
+	20508, 18476, 18444, 18460, 18460, 18460, 16428, 16396, 16412, 16412, 16412, 14380,
+	14348, 14364, 14364, 14364, 12332, 12300, 12316, 12316, 12316, 10284, 10252, 10268,
+	10268, 10268, 8492, 8460, 8476, 8476, 8476, 6700, 6668, 6684, 6684, 6684,
+	20524, 20492, 20508, 20508, 20508, 18476, 18444, 18460, 18460, 18460, 16428, 16396,
+	16412, 16412, 16412, 14380, 14348, 14364, 14364, 14364, 12332, 12300, 12316, 12316,
+	12316, 10284, 10252, 10268, 10268, 10268, 8492, 8460, 8476, 8476, 8476, 6700,
+	6668, 6684, 6684, 6684, 4908, 4876, 4892, 4892, 4892, 22573, 22541, 22557,
+	22557, 22557, 22573, 22541, 22557, 22557, 22557, 20525, 20493, 20509, 20509, 20509,
+	22573, 22541, 22557, 22557, 22557, 20525, 20493, 20509, 20509, 20509, 18477, 18445,
+	18461, 18461, 18461, 22573, 22541, 22557, 22557, 22557, 20525, 20493, 20509, 20509,
+	20509, 18477, 18445, 18461, 18461, 18461, 16429, 16397, 16413, 16413, 16413, 22573,
+	22541, 22557, 22557, 22557, 20525, 20493, 20509, 20509, 20509, 18477, 18445, 18461,
+	18461, 18461, 16429, 16397, 16413, 16413, 16413, 14381, 14349, 14365, 14365, 14365,
+	22573, 22541, 22557, 22557, 22557, 20525, 20493, 20509, 20509, 20509, 18477, 18445,
+	18461, 18461, 18461, 16429, 16397, 16413, 16413, 16413, 14381, 14349, 14365, 14365,
+	14365, 12333, 12301, 12317, 12317, 12317, 22573, 22541, 22557, 22557, 22557, 20525,
+	20493, 20509, 20509, 20509, 18477, 18445, 18461, 18461, 18461, 16429, 16397, 16413,
+	16413, 16413, 14381, 14349, 14365, 14365, 14365, 12333, 12301, 12317, 12317, 12317,
+	10285, 10253, 10269, 10269, 10269, 22573, 22541, 22557, 22557, 22557, 20525, 20493,
+	20509, 20509, 20509, 18477, 18445, 18461, 18461, 18461, 16429, 16397, 16413, 16413,
+	16413, 14381, 14349, 14365, 14365, 14365, 12333, 12301, 12317, 12317, 12317, 10285,
+	10253, 10269, 10269, 10269, 8493, 8461, 8477, 8477, 8477, 22573, 22541, 22557,
+	22557, 22557, 20525, 20493, 20509, 20509, 20509, 18477, 18445, 18461, 18461, 18461,
+	16429, 16397, 16413, 16413, 16413, 14381, 14349, 14365, 14365, 14365, 12333, 12301,
+	12317, 12317, 12317, 10285, 10253, 10269, 10269, 10269, 8493, 8461, 8477, 8477,
+	8477, 6701, 6669, 6685, 6685, 6685, 22573, 22541, 22557, 22557, 22557, 20525,
+	20493, 20509, 20509, 20509, 18477, 18445, 18461, 18461, 18461, 16429, 16397, 16413,
+	16413, 16413, 14381, 14349, 14365, 14365, 14365, 12333, 12301, 12317, 12317, 12317,
+	10285, 10253, 10269, 10269, 10269, 8493, 8461, 8477, 8477, 8477, 6701, 6669,
+	6685, 6685, 6685, 4653, 4621, 4637, 4637, 4637, 24878, 24846, 24862, 24862,
+	24862, 24878, 24846, 24862, 24862, 24862, 22830, 22798, 22814, 22814, 22814, 24878,
+	24846, 24862, 24862, 24862, 22830, 22798, 22814, 22814, 22814, 20782, 20750, 20766,
+	20766, 20766, 24622, 24590, 24606, 24606, 24606, 22574, 22542, 22558, 22558, 22558,
+	20526, 20494, 20510, 20510, 20510, 18478, 18446, 18462, 18462, 18462, 24622, 24590,
+	24606, 24606, 24606, 22574, 22542, 22558, 22558, 22558, 20526, 20494, 20510, 20510,
+	20510, 18478, 18446, 18462, 18462, 18462, 16430, 16398, 16414, 16414, 16414, 24622,
+	24590, 24606, 24606, 24606, 22574, 22542, 22558, 22558, 22558, 20526, 20494, 20510,
+	20510, 20510, 18478, 18446, 18462, 18462, 18462, 16430, 16398, 16414, 16414, 16414,
+	14382, 14350, 14366, 14366, 14366, 24622, 24590, 24606, 24606, 24606, 22574, 22542,
+	22558, 22558, 22558, 20526, 20494, 20510, 20510, 20510, 18478, 18446, 18462, 18462,
+	18462, 16430, 16398, 16414, 16414, 16414, 14382, 14350, 14366, 14366, 14366, 12334,
+	12302, 12318, 12318, 12318, 24622, 24590, 24606, 24606, 24606, 22574, 22542, 22558,
+	22558, 22558, 20526, 20494, 20510, 20510, 20510, 18478, 18446, 18462, 18462, 18462,
+	16430, 16398, 16414, 16414, 16414, 14382, 14350, 14366, 14366, 14366, 12334, 12302,
+	12318, 12318, 12318, 10286, 10254, 10270, 10270, 10270, 24622, 24590, 24606, 24606,
+	24606, 22574, 22542, 22558, 22558, 22558, 20526, 20494, 20510, 20510, 20510, 18478,
+	18446, 18462, 18462, 18462, 16430, 16398, 16414, 16414, 16414, 14382, 14350, 14366,
+	14366, 14366, 12334, 12302, 12318, 12318, 12318, 10286, 10254, 10270, 10270, 10270,
+	8494, 8462, 8478, 8478, 8478, 24622, 24590, 24606, 24606, 24606, 22574, 22542,
+	22558, 22558, 22558, 20526, 20494, 20510, 20510, 20510, 18478, 18446, 18462, 18462,
+	18462, 16430, 16398, 16414, 16414, 16414, 14382, 14350, 14366, 14366, 14366, 12334,
+	12302, 12318, 12318, 12318, 10286, 10254, 10270, 10270, 10270, 8494, 8462, 8478,
+	8478, 8478, 6446, 6414, 6430, 6430, 6430, 24622, 24590, 24606, 24606, 24606,
+	22574, 22542, 22558, 22558, 22558, 20526, 20494, 20510, 20510, 20510, 18478, 18446,
+	18462, 18462, 18462, 16430, 16398, 16414, 16414, 16414, 14382, 14350, 14366, 14366,
+	14366, 12334, 12302, 12318, 12318, 12318, 10286, 10254, 10270, 10270, 10270, 8494,
+	8462, 8478, 8478, 8478, 6446, 6414, 6430, 6430, 6430, 4398, 4366, 4382,
+	4382, 4382, 2627, 2643, 4676, 4692, 6725, 6741, 8518, 8534, 10311, 10327,
+	12360, 12376, 14409, 14425, 16458, 16474, 18507, 18523, 20556, 20572, 22605, 22621,
+	24910, 24926, 2627, 2643, 2884, 2900, 4933, 4949, 6726, 6742, 8519, 8535,
+	10312, 10328, 12361, 12377, 14410, 14426, 16459, 16475, 18508, 18524, 20557, 20573,
+	22862, 22878, 4676, 4692, 2884, 2900, 3141, 3157, 4934, 4950, 6727, 6743,
+	8520, 8536, 10313, 10329, 12362, 12378, 14411, 14427, 16460, 16476, 18509, 18525,
+	20814, 20830, 6725, 6741, 4933, 4949, 3141, 3157, 3142, 3158, 4935, 4951,
+	6728, 6744, 8521, 8537, 10314, 10330, 12363, 12379, 14412, 14428, 16461, 16477,
+	18766, 18782, 8518, 8534, 6726, 6742, 4934, 4950, 3142, 3158, 3143, 3159,
+	4936, 4952, 6729, 6745, 8522, 8538, 10315, 10331, 12364, 12380, 14413, 14429,
+	16462, 16478, 10311, 10327, 8519, 8535, 6727, 6743, 4935, 4951, 3143, 3159,
+	3144, 3160, 4937, 4953, 6730, 6746, 8523, 8539, 10316, 10332, 12365, 12381,
+	14414, 14430, 12360, 12376, 10312, 10328, 8520, 8536, 6728, 6744, 4936, 4952,
+	3144, 3160, 3145, 3161, 4938, 4954, 6731, 6747, 8524, 8540, 10317, 10333,
+	12366, 12382, 14409, 14425, 12361, 12377, 10313, 10329, 8521, 8537, 6729, 6745,
+	4937, 4953, 3145, 3161, 3146, 3162, 4939, 4955, 6732, 6748, 8525, 8541,
+	10318, 10334, 16458, 16474, 14410, 14426, 12362, 12378, 10314, 10330, 8522, 8538,
+	6730, 6746, 4938, 4954, 3146, 3162, 3147, 3163, 4940, 4956, 6733, 6749,
+	8526, 8542, 18507, 18523, 16459, 16475, 14411, 14427, 12363, 12379, 10315, 10331,
+	8523, 8539, 6731, 6747, 4939, 4955, 3147, 3163, 2892, 2908, 4685, 4701,
+	6478, 6494, 20556, 20572, 18508, 18524, 16460, 16476, 14412, 14428, 12364, 12380,
+	10316, 10332, 8524, 8540, 6732, 6748, 4940, 4956, 2892, 2908, 2637, 2653,
+	4430, 4446, 22605, 22621, 20557, 20573, 18509, 18525, 16461, 16477, 14413, 14429,
+	12365, 12381, 10317, 10333, 8525, 8541, 6733, 6749, 4685, 4701, 2637, 2653,
+	2382, 2398, 24910, 24926, 22862, 22878, 20814, 20830, 18766, 18782, 16462, 16478,
+	14414, 14430, 12366, 12382, 10318, 10334, 8526, 8542, 6478, 6494, 4430, 4446,
+	2382, 2398, 642, 899, 1156, 1413, 1414, 1415, 1416, 1417, 1418, 1163,
+	908, 653, 654,
+};
@@ -9,10 +9,28 @@
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include <util/delay.h>
+#include <util/atomic.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include "uart.h"
 #include "card.h"
+#include "showdown.h"
+#include "draws.h"
+#include "percentile.h"
+#include "equity.h"
+#include "flop_texture.h"
+#include "colex.h"
+#ifdef GAME_OMAHA
+#include "omaha.h"
+#endif
+#ifdef EVAL_BENCH
+#include "eval_bench.h"
+#endif
+
+//Every RANK_TABLE array has to fit the mapped flash window. card.c's are static: constRankBit 14 words,
+//eval_tables.h strengthBase 10, binom 13 x 6 and straightColex 10
+_Static_assert(sizeof(rankMaskInfo) + sizeof(fiveRankTable) + sizeof(colexBinom) + sizeof(percentileStrength)
+	+ sizeof(preflopEquity) + (14 + 10 + 13 * 6 + 10) * sizeof(uint16_t) <= RANK_TABLE_WINDOW, "RANK_TABLE data no longer fits the 32 KB mapped flash window, use FLASH_TABLE");
 
 //ISR Memory
 volatile uint16_t ticks = 0;
@@ -41,6 +59,15 @@ ISR(TCA0_OVF_vect){
 		ticks = 1;
 	}
 	TCA0.SINGLE.INTFLAGS = TCA_SINGLE_OVF_bm;
+}
+
+uint16_t ticks_now(void){
+	//ticks is 16 bits and the ISR can update it between the two byte loads, so read it with interrupts held off
+	uint16_t t;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE){
+		t = ticks;
+	}
+	return t;
 }
 
 ISR(USART3_RXC_vect){//For pausing and resuming
@@ -64,8 +91,204 @@ uint8_t usartGetChar(uint8_t *out){
 	return 1;
 }
 
+#ifdef GAME_OMAHA
+static void omaha_hole(const Player *p, Card hole[OMAHA_HOLE_CARDS]){
+	hole[0] = p->card1;
+	hole[1] = p->card2;
+	hole[2] = p->card3;
+	hole[3] = p->card4;
+}
+
+static void print_hole_cards(uint8_t player, const Player *p){
+	char c1[8], c2[8], c3[8], c4[8];
+	card_toString(p->card1, c1, sizeof(c1));
+	card_toString(p->card2, c2, sizeof(c2));
+	card_toString(p->card3, c3, sizeof(c3));
+	card_toString(p->card4, c4, sizeof(c4));
+	printf("Player %u cards: %s %s %s %s\r\n", player, c1, c2, c3, c4);
+}
+
+static void print_current_best(Game *g){
+	//Board work is done once, each player only runs their 4 hole cards against it
+	OmahaBoard board;
+	Card hole[OMAHA_HOLE_CARDS];
+	omaha_board_init(&board, g->community, g->communityCount);
+	omaha_hole(&g->p1, hole);
+	HandValue h1 = omaha_best(&board, hole);
+	omaha_hole(&g->p2, hole);
+	HandValue h2 = omaha_best(&board, hole);
+	printf("Player 1 has %s, Player 2 has %s\r\n", hand_type_to_string(h1.type), hand_type_to_string(h2.type));
+}
+#else
+static void print_draws(uint8_t player, const HandAccumulator *board, const Player *p){
+	//Outs count for the player, only printed when there is something to draw to
+	DrawInfo di;
+	draw_classify(board, p->card1, p->card2, &di);
+	if(di.flags == 0){
+		return;
+	}
+	printf("Player %u draws:", player);
+	if(di.flags & DRAW_FLUSH) printf(" flush draw");
+	if(di.flags & DRAW_OPEN_ENDED) printf(" open-ended");
+	if(di.flags & DRAW_GUTSHOT) printf(" gutshot");
+	if(di.flags & DRAW_OVERCARDS) printf(" %u overcard%s", di.overcards, (di.overcards > 1) ? "s" : "");
+	printf(", %u outs\r\n", di.outs);
+}
+
+static void print_equity(const Game *g){
+	//Every runout from the current board: 990 on the flop, 44 on the turn, 1 on the river
+	EquityResult er;
+	equity_game(g, &er);
+	uint16_t e = equity_p1(&er);
+	printf("Equity: Player 1 %u.%u%%, Player 2 %u.%u%%\r\n", e / 100, (e / 10) % 10,
+		(10000 - e) / 100, ((10000 - e) / 10) % 10);
+}
+
+static void print_current_best(Game *g){
+	//Board cards go in once, each player copies that and adds their 2 hole cards
+	HandAccumulator board;
+	hand_acc_init(&board);
+	for(uint8_t i = 0; i < g->communityCount; i++){
+		hand_acc_add(&board, g->community[i]);
+	}
+	HandAccumulator a1 = board, a2 = board;
+	hand_acc_add(&a1, g->p1.card1);
+	hand_acc_add(&a1, g->p1.card2);
+	hand_acc_add(&a2, g->p2.card1);
+	hand_acc_add(&a2, g->p2.card2);
+	
+	HandValue h1 = hand_acc_best(&a1);
+	HandValue h2 = hand_acc_best(&a2);
+	printf("Player 1 has %s, Player 2 has %s\r\n", hand_type_to_string(h1.type), hand_type_to_string(h2.type));
+	print_draws(1, &board, &g->p1);
+	print_draws(2, &board, &g->p2);
+	if(g->communityCount >= 3 && g->communityCount <= 4 && g->p1.isActive && g->p2.isActive){
+		print_equity(g);
+	}
+}
+#endif
+
+static void print_flop_texture(const Game *g){
+	//One table read for the flop's suit class
+	static const char *pairing[3] = {"unpaired", "paired", "trips"};
+	static const char *highs = "23456789TJQKA";
+	uint16_t t = flop_texture(g->community);
+	printf("Flop texture: %c high, %s, %s, %u straight%s possible\r\n", highs[FLOP_HIGH(t) - 2],
+		pairing[FLOP_PAIRING(t)], flop_suits_to_string(FLOP_SUITS(t)), FLOP_STRAIGHTS(t), (FLOP_STRAIGHTS(t) == 1) ? "" : "s");
+}
+
+#ifndef GAME_OMAHA
+static void print_best_five(uint8_t player, const HandValue *hv, const Card hole[2], const Card board[5]){
+	//The 5 cards that make hv in brackets, the other 2 after. Only worked out here, the evaluator does not track them
+	Card cards[7] = {hole[0], hole[1], board[0], board[1], board[2], board[3], board[4]};
+	uint8_t used = hand_best_cards(hv, cards, 7); //Bits 0-1 = hole, 2-6 = board
+	char buf[8];
+	printf("Player %u best five: [", player);
+	for(uint8_t i = 0; i < 7; i++){
+		if(used & (1 << i)){
+			card_toString(cards[i], buf, sizeof(buf));
+			printf(" %s", buf);
+		}
+	}
+	printf(" ]");
+	for(uint8_t i = 0; i < 7; i++){
+		if(!(used & (1 << i))){
+			card_toString(cards[i], buf, sizeof(buf));
+			printf(" %s", buf);
+		}
+	}
+	printf("\r\n");
+}
+
+static void print_preflop_equity(uint8_t player, const Player *p){
+	//Table lookup, 0.01 % units
+	uint16_t e = preflop_equity(p->card1, p->card2);
+	printf("Player %u preflop: %u.%u%% against a random hand\r\n", player, e / 100, (e / 10) % 10);
+}
+
+static void print_percentile(uint8_t player, uint16_t strength){
+	uint16_t top = strength_top_permille(strength);
+	printf("Player %u hand: top %u.%u%% of 7 card hands\r\n", player, top / 10, top % 10);
+}
+#endif
+
+//All-in runout: once neither player can bet, the rest of the board is dealt without prompts
+#ifndef RUNOUT_CARD_MS
+#define RUNOUT_CARD_MS 1500 //Pause between runout cards, the equity for a card is worked out inside it
+#endif
+static uint8_t runoutOn = 0;
+static uint16_t runoutLast; //ticks when the last runout card was dealt
+
+static uint16_t ticks_since(uint16_t start, uint16_t now){
+	//ticks counts 1..10000 and wraps, now is one ticks_now() snapshot
+	return (now >= start) ? now - start : now + 10000 - start;
+}
+
+static uint8_t betting_closed(const Game *g){
+	//Heads-up: both all in, or one all in and the other has put in at least as much
+	if(!g->p1.isActive || !g->p2.isActive){
+		return 0;
+	}
+	if(g->p1.allIn && g->p2.allIn){
+		return 1;
+	}
+	if(g->p1.allIn){
+		return g->p2.currentBet >= g->p1.currentBet;
+	}
+	if(g->p2.allIn){
+		return g->p1.currentBet >= g->p2.currentBet;
+	}
+	return 0;
+}
+
+static void runout_step(Game *g){
+	//Called from game_step() every main loop pass, one card per RUNOUT_CARD_MS
+	uint16_t now = ticks_now();
+	if(!runoutOn){
+		runoutOn = 1;
+		runoutLast = now;
+		printf("\r\nNo more betting possible, running out the board. Pot: %u\r\n", g->pot);
+		return;
+	}
+	if(ticks_since(runoutLast, now) < RUNOUT_CARD_MS){
+		return;
+	}
+	if(g->communityCount == 5){
+		runoutOn = 0;
+		g->round = ROUND_SHOWDOWN;
+		g->turn = 0;
+		showdown = 1;
+		return;
+	}
+	runoutLast = now;
+	deal_community(g, 1);
+	g->round = (g->communityCount == 4) ? ROUND_TURN : ROUND_RIVER;
+	g->turn = 0;
+	char buf[8];
+	printf("\r\nCommunity Cards:");
+	for(uint8_t i = 0; i < g->communityCount; i++){
+		card_toString(g->community[i], buf, sizeof(buf));
+		printf(" %s", buf);
+	}
+	printf("\r\n");
+	print_current_best(g); //Exact equity from this board on the turn
+#ifndef GAME_OMAHA
+	if(g->communityCount == 5){
+		print_equity(g);
+	}
+#endif
+	uint16_t spent = ticks_since(runoutLast, ticks_now());
+	if(spent >= RUNOUT_CARD_MS){
+		printf("Runout card took %u ms, longer than RUNOUT_CARD_MS\r\n", spent);
+	}
+}
+
 void game_step(Game *g){
 	uint8_t c; 
+	if(runoutOn || ((g->round == ROUND_TURN || g->round == ROUND_RIVER || (g->round == ROUND_FLOP && g->turn != 0)) && betting_closed(g))){
+		runout_step(g);
+		return;
+	}
 	switch (g->round){
 		case ROUND_MENU:
 			if(g->turn == 0){
@@ -78,7 +301,7 @@ void game_step(Game *g){
 				}
 				if(c == 'y'|| c== 'Y'){
 					card_init();
-					card_shuffle(ticks);
+					card_shuffle(ticks_now());
 				
 					g->pot            = 0;
 					g->communityCount = 0;
@@ -110,6 +333,11 @@ void game_step(Game *g){
 				
 				deal_player_cards(g);
 				deal_player_cards(g);
+#ifdef GAME_OMAHA
+				printf("\r\n");
+				print_hole_cards(1, &g->p1);
+				print_hole_cards(2, &g->p2);
+#else
 				//Print flop Cards
 				char p1c1[8], p1c2[8];
 				char p2c1[8], p2c2[8];
@@ -121,6 +349,9 @@ void game_step(Game *g){
 
 				printf("\r\nPlayer 1 cards: %s %s\r\n", p1c1, p1c2);
 				printf("Player 2 cards: %s %s\r\n", p2c1, p2c2);
+				print_preflop_equity(1, &g->p1);
+				print_preflop_equity(2, &g->p2);
+#endif
 				
 				deal_community(g, 3);
 				char c1[8],c2[8],c3[8];
@@ -129,6 +360,8 @@ void game_step(Game *g){
 				card_toString(g->community[2],c3,sizeof(c3));
 				
 				printf("\r\nCommunity Cards 1, 2, 3: %s %s %s\r\n", c1, c2, c3);
+				print_flop_texture(g);
+				print_current_best(g);
 				g->turn = 1;
 				printf("Player 1 Round Flop, Options: Fold, Call, Raise(F/C/R)\n");
 			}
@@ -270,6 +503,7 @@ void game_step(Game *g){
 				card_toString(g->community[3],c4,sizeof(c4));
 								
 				printf("\r\nCommunity Cards 1, 2, 3, 4: %s %s %s %s\r\n", c1, c2, c3, c4);
+				print_current_best(g);
 				printf("Pot: %u\r\n", g->pot);
 				
 				g->turn = 1;
@@ -405,6 +639,7 @@ void game_step(Game *g){
 				
 				printf("\r\nCommunity Cards 1, 2, 3, 4, 5: %s %s %s %s %s\r\n", c1, c2, c3, c4, c5);
 				printf("Pot: %u\r\n", g->pot);
+				print_current_best(g);
 
 				g->turn = 1;
 				printf("Player 1 Round River, Options: Fold, Call, Raise(F/C/R)\n");
@@ -540,6 +775,24 @@ void game_step(Game *g){
 				card_toString(g->community[4],c5,sizeof(c5));
 				
 				printf("\r\nCommunity Cards 1, 2, 3, 4, 5: %s %s %s %s %s\r\n", c1, c2, c3, c4, c5);
+#ifdef GAME_OMAHA
+				print_hole_cards(1, &g->p1);
+				print_hole_cards(2, &g->p2);
+				printf("\r\n Showdown. Pot = %u\r\n", g->pot);
+
+				//Exactly 2 hole cards and 3 board cards each
+				ShowdownResult sr;
+				OmahaBoard board;
+				Card hole[OMAHA_HOLE_CARDS];
+				omaha_board_init(&board, g->community, 5);
+				omaha_hole(&g->p1, hole);
+				sr.hand[0] = omaha_best(&board, hole);
+				omaha_hole(&g->p2, hole);
+				sr.hand[1] = omaha_best(&board, hole);
+				sr.strength[0] = hand_strength(&sr.hand[0]);
+				sr.strength[1] = hand_strength(&sr.hand[1]);
+				showdown_group(&sr, 2);
+#else
 				//Print Player Cards
 				char p1c1[8], p1c2[8];
 				char p2c1[8], p2c2[8];
@@ -553,32 +806,27 @@ void game_step(Game *g){
 				printf("Player 2 cards: %s %s\r\n", p2c1, p2c2);
 				printf("\r\n Showdown. Pot = %u\r\n", g->pot);
 				
-				//Calculate winner
-				Card p1Cards[7];
-				Card p2Cards[7];
-				//Build 7 Card hands, 2 player and 5 community cards
-				p1Cards[0] = g->p1.card1;
-				p1Cards[1] = g->p1.card2;
-
-				p2Cards[0] = g->p2.card1;
-				p2Cards[1] = g->p2.card2;
-				
-				for(int i = 0; i < 5; i++){
-					p1Cards[2+i] = g->community[i];
-					p2Cards[2+i] = g->community[i];
-				}
+				//Calculate winner, board evaluated once for both seats
+				Card hole[2][2] = {{g->p1.card1, g->p1.card2}, {g->p2.card1, g->p2.card2}};
+				ShowdownResult sr;
+				showdown_rank(g->community, hole, 2, &sr);
 				
-				HandValue h1 = evaluate_best_hand(p1Cards);
-				HandValue h2 = evaluate_best_hand(p2Cards);
+				print_best_five(1, &sr.hand[0], hole[0], g->community);
+				print_best_five(2, &sr.hand[1], hole[1], g->community);
+				print_percentile(1, sr.strength[0]);
+				print_percentile(2, sr.strength[1]);
+#endif
 				
-				int compare = compare_hands(&h1, &h2);
-				if (compare > 0){
-					printf("\r\n Player 1 wins with %s!\r\n", hand_type_to_string(h1.type));
+				//A folded seat cannot win the pot
+				uint16_t eligible = (g->p1.isActive ? 1 : 0) | (g->p2.isActive ? 2 : 0);
+				uint16_t winners = showdown_pot_winners(&sr, eligible ? eligible : 3);
+				if (winners == 1){
+					printf("\r\n Player 1 wins with %s!\r\n", hand_type_to_string(sr.hand[0].type));
 					g->p1.money += g->pot;
 				} 
-				else if (compare < 0 ){
-					printf("\r\n Player 2 wins with %s!\r\n", hand_type_to_string(h2.type));
-					g->p1.money += g->pot;
+				else if (winners == 2){
+					printf("\r\n Player 2 wins with %s!\r\n", hand_type_to_string(sr.hand[1].type));
+					g->p2.money += g->pot;
 				}
 				else{
 					printf("\r\nIt's a tie! Pot is split.\r\n");
@@ -613,6 +861,9 @@ int main(void)
 	sei();
 	
 	_delay_ms(5);
+#ifdef EVAL_BENCH
+	eval_bench_run(); //Cycle report for the evaluators, build with -DEVAL_BENCH
+#endif
 	Game game;
 	game_init(&game);
 	
@@ -0,0 +1,248 @@
+/*
+ * omaha.c
+ *
+ * Hands are compared as one 32 bit key, category << 26 | group ranks << 13 | kickers,
+ * with both rank fields as 13 bit masks. Within a category a larger mask is always the
+ * better hand, so the best of the 60 combos is a plain max and only the winner is turned
+ * back into a HandValue.
+ *
+ * Pair based categories come from every hole pair against every distinct board triple.
+ * Straights and flushes do not need the combos: a straight window works if the board
+ * has 3 of its ranks and the hole supplies the rest plus enough to make 2, and the best
+ * flush is always the top 2 hole cards of the suit with the top 3 board cards.
+ */ 
+
+#include "omaha.h"
+
+#define OMAHA_KEY(cat, hi, lo) (((uint32_t)(cat) << 26) | ((uint32_t)(hi) << 13) | (uint32_t)(lo))
+
+//Five rank straight windows, A-high (index 0) down to the wheel (index 9)
+static const uint16_t straightWindow[10] = {
+	0x1F00, 0x0F80, 0x07C0, 0x03E0, 0x01F0, 0x00F8, 0x007C, 0x003E, 0x001F, 0x100F
+};
+
+static uint16_t top_bits(uint16_t m, uint8_t n){
+	//Keep the n highest bits of m
+	uint16_t out = 0;
+	for(uint16_t bit = 0x1000; bit && n; bit >>= 1){
+		if(m & bit){
+			out |= bit;
+			n--;
+		}
+	}
+	return out;
+}
+
+static uint8_t mask_ranks(uint16_t m, uint8_t *out, uint8_t n){
+	//Up to n ranks (14..2) of the mask into out, highest first
+	uint8_t k = 0;
+	uint16_t bit = 0x1000;
+	for(uint8_t v = 14; v >= 2 && k < n; v--){
+		if(m & bit){
+			out[k++] = v;
+		}
+		bit >>= 1;
+	}
+	return k;
+}
+
+void omaha_board_init(OmahaBoard *ob, const Card *board, uint8_t n){
+	uint16_t ranks = 0;
+	uint16_t suitMask[4] = {0, 0, 0, 0};
+	for(uint8_t i = 0; i < n; i++){
+		ranks |= card_rank_bit(board[i]);
+		suitMask[board[i].suit] |= card_rank_bit(board[i]);
+	}
+
+	//Distinct board triples by rank counts, a paired board repeats some
+	ob->triples = 0;
+	for(uint8_t a = 0; a < n; a++){
+		for(uint8_t b = a + 1; b < n; b++){
+			for(uint8_t c = b + 1; c < n; c++){
+				uint16_t ba = card_rank_bit(board[a]), bb = card_rank_bit(board[b]), bc = card_rank_bit(board[c]);
+				uint16_t c1 = ba | bb | bc;
+				uint16_t c2 = (ba & bb) | (ba & bc) | (bb & bc);
+				uint16_t c3 = ba & bb & bc;
+				uint8_t t = 0;
+				while(t < ob->triples && (ob->c1[t] != c1 || ob->c2[t] != c2 || ob->c3[t] != c3)){
+					t++;
+				}
+				if(t == ob->triples){
+					ob->c1[t] = c1;
+					ob->c2[t] = c2;
+					ob->c3[t] = c3;
+					ob->triples++;
+				}
+			}
+		}
+	}
+
+	//Straights need 3 window ranks from the board, the other 2 come from the hole
+	ob->straightOk = 0;
+	for(uint8_t w = 0; w < 10; w++){
+		ob->straightNeed[w] = straightWindow[w] & (uint16_t)~ranks;
+		if(rank_mask_count(ob->straightNeed[w]) <= 2){
+			ob->straightOk |= (uint16_t)1 << w;
+		}
+	}
+
+	//With 5 board cards at most one suit can hold 3 or more
+	ob->flushSuit = OMAHA_NO_FLUSH;
+	ob->flushTop3 = 0;
+	ob->sfOk = 0;
+	for(uint8_t s = 0; s < 4; s++){
+		if(rank_mask_count(suitMask[s]) >= 3){
+			ob->flushSuit = s;
+			ob->flushTop3 = top_bits(suitMask[s], 3);
+			for(uint8_t w = 0; w < 10; w++){
+				ob->sfNeed[w] = straightWindow[w] & (uint16_t)~suitMask[s];
+				if(rank_mask_count(straightWindow[w] & suitMask[s]) == 3){
+					ob->sfOk |= (uint16_t)1 << w;
+				}
+			}
+			break;
+		}
+	}
+}
+
+static uint32_t best_key(const OmahaBoard *ob, const Card hole[OMAHA_HOLE_CARDS]){
+	uint16_t hb[OMAHA_HOLE_CARDS];
+	uint16_t holeRanks = 0, holeSuited = 0;
+	for(uint8_t i = 0; i < OMAHA_HOLE_CARDS; i++){
+		hb[i] = card_rank_bit(hole[i]);
+		holeRanks |= hb[i];
+		if(hole[i].suit == ob->flushSuit){
+			holeSuited |= hb[i];
+		}
+	}
+
+	//Straight flush first, the suit's hole and board cards never share a rank
+	if(rank_mask_count(holeSuited) >= 2){
+		for(uint8_t w = 0; w < 10; w++){
+			if((ob->sfOk & ((uint16_t)1 << w)) && (ob->sfNeed[w] & (uint16_t)~holeSuited) == 0){
+				return OMAHA_KEY(HAND_STRAIGHT_FLUSH, 0, 14 - w);
+			}
+		}
+	}
+
+	//Pairs, trips, full houses and quads, every hole pair with every distinct triple.
+	//Hole pairs with the same ranks (the other suits of a double paired hand) are tried once
+	uint32_t best = 0;
+	uint16_t pairAny[6], pairBoth[6];
+	uint8_t pairs = 0;
+	for(uint8_t i = 0; i < OMAHA_HOLE_CARDS; i++){
+		for(uint8_t j = i + 1; j < OMAHA_HOLE_CARDS; j++){
+			uint16_t any = hb[i] | hb[j], both = hb[i] & hb[j];
+			uint8_t k = 0;
+			while(k < pairs && (pairAny[k] != any || pairBoth[k] != both)){
+				k++;
+			}
+			if(k < pairs){
+				continue;
+			}
+			pairAny[pairs] = any;
+			pairBoth[pairs++] = both;
+			for(uint8_t t = 0; t < ob->triples; t++){
+				uint16_t c1 = ob->c1[t], c2 = ob->c2[t], c3 = ob->c3[t], c4 = 0;
+				uint16_t b = hb[i];
+				c4 |= c3 & b; c3 |= c2 & b; c2 |= c1 & b; c1 |= b;
+				b = hb[j];
+				c4 |= c3 & b; c3 |= c2 & b; c2 |= c1 & b; c1 |= b;
+
+				uint32_t key;
+				if(c4){
+					key = OMAHA_KEY(HAND_FOUR_OF_A_KIND, c4, c1 & (uint16_t)~c4);
+				}else if(c3){
+					uint16_t pair = c2 & (uint16_t)~c3;
+					key = pair ? OMAHA_KEY(HAND_FULL_HOUSE, c3, pair) : OMAHA_KEY(HAND_THREE_OF_A_KIND, c3, c1 & (uint16_t)~c3);
+				}else if(c2){
+					key = OMAHA_KEY((c2 & (uint16_t)(c2 - 1)) ? HAND_TWO_PAIR : HAND_ONE_PAIR, c2, c1 & (uint16_t)~c2);
+				}else{
+					key = OMAHA_KEY(HAND_HIGH_CARD, c1, 0);
+				}
+				if(key > best){
+					best = key;
+				}
+			}
+		}
+	}
+	if(best >= OMAHA_KEY(HAND_FULL_HOUSE, 0, 0)){
+		return best; //Beats any flush or straight
+	}
+
+	if(rank_mask_count(holeSuited) >= 2){
+		return OMAHA_KEY(HAND_FLUSH, ob->flushTop3 | top_bits(holeSuited, 2), 0);
+	}
+
+	//Straight: the hole covers what the board misses and puts 2 distinct ranks in the window
+	for(uint8_t w = 0; w < 10; w++){
+		uint16_t inWindow = straightWindow[w] & holeRanks;
+		if((ob->straightOk & ((uint16_t)1 << w)) && (ob->straightNeed[w] & (uint16_t)~holeRanks) == 0
+			&& (inWindow & (uint16_t)(inWindow - 1))){
+			return OMAHA_KEY(HAND_STRAIGHT, 0, 14 - w); //best is trips at most here
+		}
+	}
+	return best;
+}
+
+HandValue omaha_best(const OmahaBoard *ob, const Card hole[OMAHA_HOLE_CARDS]){
+	HandValue hv = {HAND_HIGH_CARD, {0}};
+	uint32_t key = best_key(ob, hole);
+	uint16_t hi = (uint16_t)(key >> 13) & 0x1FFF;
+	uint16_t lo = (uint16_t)key & 0x1FFF;
+	hv.type = (HandRankType)(key >> 26);
+
+	switch(hv.type){
+		case HAND_STRAIGHT_FLUSH:
+			if(lo == 14){
+				hv.type = HAND_ROYAL_FLUSH;
+			}
+			//Fall through
+		case HAND_STRAIGHT:
+			hv.ranks[0] = (uint8_t)lo;
+			break;
+		case HAND_HIGH_CARD:
+		case HAND_FLUSH:
+			mask_ranks(hi, hv.ranks, 5);
+			break;
+		default:
+			//Group ranks first, then the kickers
+			mask_ranks(lo, &hv.ranks[mask_ranks(hi, hv.ranks, 2)], 3);
+			break;
+	}
+	return hv;
+}
+
+uint16_t omaha_strength(const OmahaBoard *ob, const Card hole[OMAHA_HOLE_CARDS]){
+	HandValue hv = omaha_best(ob, hole);
+	return hand_strength(&hv);
+}
+
+HandValue omaha_best_brute(const Card *board, uint8_t n, const Card hole[OMAHA_HOLE_CARDS]){
+	HandValue best = {HAND_HIGH_CARD, {0}};
+	uint16_t bestStrength = 0;
+	for(uint8_t i = 0; i < OMAHA_HOLE_CARDS; i++){
+		for(uint8_t j = i + 1; j < OMAHA_HOLE_CARDS; j++){
+			for(uint8_t a = 0; a < n; a++){
+				for(uint8_t b = a + 1; b < n; b++){
+					for(uint8_t c = b + 1; c < n; c++){
+						HandAccumulator acc;
+						hand_acc_init(&acc);
+						hand_acc_add(&acc, hole[i]);
+						hand_acc_add(&acc, hole[j]);
+						hand_acc_add(&acc, board[a]);
+						hand_acc_add(&acc, board[b]);
+						hand_acc_add(&acc, board[c]);
+						HandValue hv = hand_acc_best(&acc);
+						uint16_t s = hand_strength(&hv);
+						if(s > bestStrength){
+							bestStrength = s;
+							best = hv;
+						}
+					}
+				}
+			}
+		}
+	}
+	return best;
+}
@@ -0,0 +1,40 @@
+/*
+ * omaha.h
+ *
+ * Omaha showdown: best 5 card hand from exactly 2 of 4 hole cards and exactly 3 of the
+ * board. Everything that only depends on the board (distinct rank triples, which
+ * straights and straight flushes it leaves open, the flush suit) is worked out once by
+ * omaha_board_init(), so each player only pays for a few mask operations per combo.
+ */ 
+
+#ifndef OMAHA_H
+#define OMAHA_H
+
+#include <stdint.h>
+#include "card.h"
+
+#define OMAHA_HOLE_CARDS 4
+#define OMAHA_NO_FLUSH 0xFF
+
+typedef struct{
+	//Rank count masks of each distinct 3 card board subset: >= 1, >= 2, 3 copies
+	uint16_t c1[10];
+	uint16_t c2[10];
+	uint16_t c3[10];
+	uint8_t triples;
+	//Straight windows A-high first: bit i of straightOk is set if window i has 3+ board ranks,
+	//straightNeed[i] are the window ranks the board is missing and the hole must supply
+	uint16_t straightOk;
+	uint16_t straightNeed[10];
+	uint8_t flushSuit; //Suit holding 3+ board cards, OMAHA_NO_FLUSH if none
+	uint16_t flushTop3; //Three highest board ranks of that suit
+	uint16_t sfOk; //Same as straightOk for the flush suit, exactly 3 board cards in the window
+	uint16_t sfNeed[10];
+} OmahaBoard;
+
+void omaha_board_init(OmahaBoard *ob, const Card *board, uint8_t n); //n = 3..5 board cards
+HandValue omaha_best(const OmahaBoard *ob, const Card hole[OMAHA_HOLE_CARDS]);
+uint16_t omaha_strength(const OmahaBoard *ob, const Card hole[OMAHA_HOLE_CARDS]); //hand_strength() of omaha_best()
+HandValue omaha_best_brute(const Card *board, uint8_t n, const Card hole[OMAHA_HOLE_CARDS]); //Every 2 + 3 combo through hand_acc_best(), reference only
+
+#endif
@@ -0,0 +1,720 @@
+/*
+ * preflop_matrix.c
+ *
+ * Generated by tools/gen_preflop_matrix.c, do not edit.
+ */ 
+
+#include "percentile.h"
+
+const uint8_t preflopMatrix[PREFLOP_PAIRS] FLASH_TABLE = {
+	170, 168, 119, 167, 102, 103, 170, 95, 95, 95, 172, 89, 90, 90, 86, 171, 82, 84, 84, 80,
+	76, 170, 79, 79, 80, 76, 72, 72, 170, 75, 76, 76, 73, 69, 69, 68, 170, 73, 74, 75,
+	71, 68, 68, 67, 66, 171, 71, 72, 74, 70, 66, 67, 66, 65, 64, 171, 70, 71, 72, 69,
+	66, 65, 66, 65, 64, 63, 168, 65, 66, 67, 68, 64, 64, 63, 64, 63, 62, 61, 160, 121,
+	129, 145, 152, 157, 163, 166, 170, 172, 173, 175, 180, 50, 28, 76, 78, 77, 77, 80, 80, 81,
+	80, 79, 79, 79, 40, 135, 115, 118, 125, 133, 137, 142, 144, 145, 145, 145, 146, 148, 123, 166,
+	133, 100, 113, 118, 132, 136, 141, 143, 144, 144, 144, 144, 147, 109, 164, 103, 135, 91, 106, 107,
+	118, 140, 144, 146, 147, 147, 147, 147, 149, 101, 167, 95, 96, 134, 82, 103, 103, 99, 117, 145,
+	147, 148, 148, 149, 148, 151, 93, 170, 90, 91, 86, 138, 80, 102, 102, 98, 95, 120, 151, 152,
+	152, 152, 152, 154, 91, 172, 87, 88, 84, 80, 136, 76, 98, 99, 96, 93, 94, 119, 152, 152,
+	151, 151, 154, 87, 171, 82, 84, 79, 75, 72, 136, 72, 98, 98, 95, 92, 93, 92, 119, 152,
+	152, 151, 154, 83, 171, 80, 80, 77, 73, 69, 69, 136, 70, 97, 98, 94, 92, 93, 93, 92,
+	119, 153, 152, 155, 81, 171, 78, 79, 74, 71, 68, 67, 66, 137, 68, 97, 98, 95, 92, 94,
+	93, 92, 91, 119, 153, 156, 79, 172, 76, 77, 74, 70, 67, 67, 66, 65, 137, 67, 97, 98,
+	95, 93, 93, 93, 93, 92, 91, 119, 157, 78, 173, 75, 76, 72, 69, 65, 66, 65, 64, 63,
+	136, 61, 93, 94, 92, 90, 91, 90, 91, 90, 89, 88, 120, 73, 169, 69, 70, 71, 67, 64,
+	64, 64, 63, 62, 61, 159, 113, 121, 144, 151, 156, 162, 166, 169, 171, 172, 174, 179, 120, 170,
+	130, 134, 140, 144, 144, 148, 148, 149, 149, 149, 152, 128, 110, 112, 119, 125, 129, 134, 136, 136,
+	137, 137, 137, 140, 117, 157, 121, 144, 151, 156, 159, 163, 165, 168, 169, 170, 176, 119, 48, 32,
+	27, 75, 75, 75, 77, 79, 79, 78, 78, 77, 78, 43, 48, 32, 77, 77, 77, 77, 79, 80,
+	79, 78, 77, 78, 40, 44, 130, 101, 98, 115, 128, 133, 137, 140, 141, 141, 141, 141, 144, 109,
+	133, 99, 118, 132, 136, 138, 142, 143, 142, 143, 143, 145, 107, 108, 162, 131, 96, 91, 103, 115,
+	136, 140, 142, 143, 144, 143, 143, 145, 105, 135, 93, 107, 118, 139, 141, 144, 145, 146, 145, 145,
+	148, 100, 102, 165, 96, 131, 91, 82, 100, 96, 115, 142, 144, 145, 145, 145, 144, 148, 101, 135,
+	87, 103, 99, 118, 143, 146, 147, 147, 147, 147, 150, 92, 97, 168, 91, 87, 134, 90, 80, 99,
+	95, 92, 117, 148, 149, 149, 148, 149, 151, 100, 136, 80, 102, 98, 96, 117, 148, 149, 149, 148,
+	149, 151, 90, 91, 170, 88, 84, 80, 136, 89, 76, 99, 96, 93, 94, 119, 152, 152, 151, 151,
+	154, 99, 139, 80, 103, 99, 96, 93, 120, 153, 153, 152, 152, 155, 87, 91, 173, 87, 83, 80,
+	76, 135, 88, 73, 97, 94, 91, 92, 92, 119, 151, 151, 150, 153, 97, 137, 77, 100, 97, 95,
+	92, 93, 119, 152, 152, 151, 154, 84, 88, 172, 84, 80, 76, 73, 69, 135, 87, 71, 97, 93,
+	91, 92, 93, 92, 119, 152, 151, 154, 97, 138, 75, 100, 96, 95, 92, 93, 92, 119, 153, 152,
+	155, 81, 85, 173, 82, 78, 75, 71, 67, 67, 136, 87, 69, 97, 94, 91, 93, 93, 92, 91,
+	119, 152, 155, 97, 138, 73, 100, 97, 94, 92, 93, 92, 92, 119, 153, 156, 80, 84, 173, 81,
+	77, 73, 70, 67, 66, 65, 136, 87, 67, 97, 94, 92, 92, 93, 93, 92, 91, 119, 156, 97,
+	139, 72, 100, 97, 95, 92, 94, 93, 92, 91, 119, 157, 78, 82, 174, 79, 76, 73, 69, 66,
+	66, 65, 64, 135, 83, 62, 93, 91, 89, 90, 90, 91, 90, 89, 88, 119, 93, 138, 66, 97,
+	94, 92, 90, 91, 91, 90, 89, 88, 120, 73, 77, 171, 74, 75, 71, 68, 64, 65, 64, 63,
+	62, 157, 98, 98, 121, 151, 155, 161, 165, 169, 170, 171, 173, 178, 106, 168, 122, 130, 140, 143,
+	144, 146, 148, 148, 148, 148, 151, 106, 128, 171, 132, 143, 146, 147, 147, 149, 149, 149, 149, 152,
+	127, 96, 107, 112, 125, 129, 133, 135, 136, 136, 136, 136, 139, 104, 155, 98, 121, 151, 155, 158,
+	162, 165, 167, 168, 169, 175, 113, 106, 169, 130, 140, 143, 144, 144, 146, 146, 146, 146, 149, 119,
+	124, 96, 94, 110, 121, 125, 129, 132, 133, 133, 133, 133, 136, 102, 127, 95, 112, 125, 129, 130,
+	134, 135, 134, 134, 135, 137, 102, 104, 153, 121, 151, 155, 157, 159, 162, 163, 165, 166, 171, 117,
+	119, 47, 31, 31, 27, 72, 72, 75, 76, 78, 77, 76, 75, 76, 42, 47, 33, 31, 75, 75,
+	75, 77, 78, 77, 77, 76, 76, 42, 43, 47, 36, 77, 77, 77, 77, 79, 78, 77, 76, 77,
+	40, 44, 48, 128, 93, 93, 89, 108, 132, 136, 138, 140, 140, 140, 140, 142, 103, 132, 96, 91,
+	109, 136, 137, 140, 142, 142, 142, 142, 144, 102, 104, 135, 93, 111, 139, 141, 141, 144, 144, 143,
+	143, 146, 99, 101, 102, 163, 128, 90, 90, 81, 93, 107, 138, 140, 141, 141, 142, 141, 144, 99,
+	132, 93, 86, 96, 109, 140, 142, 144, 144, 144, 143, 147, 99, 102, 136, 89, 100, 111, 143, 143,
+	145, 145, 146, 145, 148, 92, 96, 98, 165, 87, 131, 89, 89, 80, 92, 89, 108, 144, 145, 145,
+	145, 145, 148, 99, 132, 91, 80, 95, 92, 108, 144, 145, 145, 145, 145, 148, 98, 101, 137, 85,
+	99, 96, 111, 146, 147, 147, 147, 148, 150, 90, 90, 95, 168, 85, 81, 133, 88, 88, 76, 92,
+	90, 91, 110, 148, 148, 148, 147, 151, 98, 136, 92, 80, 96, 93, 90, 110, 149, 149, 149, 148,
+	152, 98, 101, 137, 80, 99, 96, 93, 111, 149, 149, 149, 148, 152, 86, 90, 91, 171, 84, 80,
+	76, 135, 88, 88, 73, 94, 91, 92, 92, 112, 151, 151, 150, 153, 97, 137, 92, 77, 97, 94,
+	92, 93, 112, 152, 152, 151, 154, 98, 101, 140, 82, 100, 98, 95, 92, 113, 153, 153, 152, 155,
+	84, 88, 92, 173, 83, 80, 77, 73, 134, 87, 87, 71, 92, 90, 91, 91, 92, 111, 151, 150,
+	153, 97, 137, 91, 75, 96, 94, 91, 92, 92, 112, 152, 151, 154, 97, 101, 139, 80, 99, 97,
+	94, 91, 92, 112, 153, 152, 155, 82, 86, 90, 173, 81, 78, 75, 71, 67, 135, 87, 87, 69,
+	93, 90, 92, 92, 92, 91, 111, 151, 154, 96, 138, 91, 74, 96, 93, 91, 92, 92, 91, 112,
+	152, 155, 97, 100, 140, 78, 99, 96, 94, 92, 93, 92, 112, 153, 156, 80, 84, 88, 174, 81,
+	77, 74, 70, 66, 66, 135, 86, 87, 68, 93, 91, 91, 92, 93, 92, 91, 111, 154, 96, 138,
+	91, 72, 96, 94, 91, 93, 93, 92, 91, 112, 156, 97, 100, 141, 77, 99, 97, 94, 92, 93,
+	92, 91, 112, 157, 79, 83, 87, 175, 80, 77, 73, 70, 66, 65, 64, 134, 83, 83, 62, 90,
+	88, 90, 89, 91, 89, 89, 88, 112, 93, 137, 87, 67, 93, 91, 89, 90, 91, 90, 89, 88,
+	112, 93, 97, 139, 71, 97, 94, 92, 89, 91, 90, 89, 88, 113, 73, 78, 82, 172, 78, 74,
+	71, 67, 65, 64, 63, 62, 160, 90, 91, 91, 121, 159, 165, 169, 172, 174, 174, 176, 177, 99,
+	169, 116, 116, 130, 147, 147, 150, 151, 151, 151, 151, 153, 100, 122, 171, 120, 132, 150, 151, 150,
+	152, 152, 152, 152, 154, 100, 122, 126, 173, 139, 153, 154, 153, 152, 153, 153, 153, 155, 128, 88,
+	101, 101, 112, 132, 136, 137, 138, 139, 138, 138, 140, 97, 158, 91, 91, 121, 159, 162, 166, 168,
+	171, 171, 172, 174, 108, 100, 169, 116, 130, 147, 148, 147, 148, 149, 149, 149, 151, 108, 100, 122,
+	171, 138, 150, 151, 150, 149, 150, 149, 150, 152, 119, 125, 91, 87, 98, 109, 128, 132, 134, 135,
+	136, 135, 135, 137, 98, 128, 89, 101, 112, 132, 133, 136, 137, 137, 137, 137, 139, 96, 98, 156,
+	92, 121, 159, 161, 162, 165, 167, 168, 169, 170, 105, 108, 100, 169, 136, 147, 148, 147, 145, 147,
+	146, 147, 149, 117, 119, 122, 89, 88, 86, 102, 124, 128, 131, 133, 132, 132, 132, 134, 96, 125,
+	91, 88, 104, 128, 129, 132, 134, 134, 134, 134, 136, 95, 98, 128, 89, 106, 132, 133, 133, 136,
+	136, 135, 135, 138, 95, 97, 98, 154, 121, 159, 161, 162, 162, 164, 165, 166, 167, 110, 111, 113,
+	47, 34, 35, 35, 21, 71, 73, 74, 76, 76, 75, 74, 76, 45, 47, 36, 37, 26, 73, 73,
+	75, 76, 77, 76, 75, 78, 45, 47, 47, 38, 30, 75, 75, 75, 77, 77, 76, 76, 78, 46,
+	47, 48, 48, 35, 77, 77, 77, 77, 78, 77, 76, 79, 34, 39, 43, 47, 125, 88, 88, 88,
+	75, 97, 134, 136, 137, 139, 138, 138, 138, 97, 129, 92, 91, 81, 99, 136, 138, 140, 141, 141,
+	140, 141, 98, 101, 132, 94, 83, 101, 140, 140, 142, 143, 142, 142, 142, 97, 100, 103, 136, 84,
+	103, 143, 143, 143, 144, 144, 143, 144, 86, 91, 93, 94, 163, 128, 87, 88, 87, 75, 87, 99,
+	140, 141, 142, 142, 142, 142, 97, 129, 91, 90, 75, 90, 99, 140, 141, 142, 142, 142, 142, 98,
+	100, 133, 94, 80, 93, 101, 142, 144, 144, 144, 144, 144, 97, 100, 103, 136, 82, 97, 103, 146,
+	145, 146, 146, 146, 146, 85, 86, 90, 92, 166, 80, 130, 87, 88, 87, 71, 87, 88, 100, 144,
+	145, 144, 144, 145, 97, 132, 91, 91, 75, 91, 88, 100, 145, 146, 145, 145, 146, 97, 101, 133,
+	94, 75, 94, 91, 100, 145, 146, 145, 145, 146, 97, 101, 103, 137, 81, 97, 94, 102, 147, 148,
+	148, 147, 148, 82, 86, 86, 91, 169, 80, 76, 131, 87, 88, 88, 68, 89, 90, 90, 101, 148,
+	147, 147, 147, 97, 134, 91, 91, 72, 92, 89, 90, 102, 149, 148, 148, 148, 97, 101, 136, 95,
+	77, 95, 93, 90, 102, 150, 149, 149, 149, 97, 101, 104, 137, 77, 99, 96, 93, 102, 150, 149,
+	149, 149, 79, 83, 87, 87, 171, 80, 76, 73, 134, 87, 88, 88, 66, 91, 92, 92, 92, 103,
+	151, 150, 150, 97, 137, 92, 92, 71, 94, 92, 93, 93, 103, 152, 151, 151, 98, 101, 139, 96,
+	75, 98, 95, 92, 93, 104, 153, 152, 152, 98, 102, 105, 142, 80, 101, 98, 95, 92, 104, 154,
+	153, 153, 77, 82, 86, 90, 175, 81, 78, 74, 70, 134, 87, 88, 88, 65, 90, 92, 92, 92,
+	92, 102, 150, 150, 97, 136, 91, 92, 70, 93, 91, 92, 92, 92, 103, 151, 151, 97, 101, 139,
+	95, 74, 96, 95, 92, 93, 93, 103, 152, 152, 98, 101, 105, 141, 78, 100, 98, 95, 92, 93,
+	104, 153, 153, 76, 80, 84, 89, 176, 80, 77, 73, 69, 65, 134, 87, 87, 88, 64, 91, 91,
+	92, 92, 92, 91, 102, 151, 97, 137, 91, 92, 68, 94, 91, 93, 93, 93, 92, 103, 152, 97,
+	101, 140, 95, 73, 97, 94, 92, 93, 93, 92, 103, 153, 98, 101, 105, 142, 77, 101, 97, 95,
+	93, 94, 92, 104, 154, 75, 79, 83, 87, 176, 80, 76, 73, 69, 65, 64, 135, 87, 87, 88,
+	62, 90, 92, 92, 93, 93, 92, 91, 105, 97, 138, 91, 92, 67, 94, 92, 92, 93, 93, 92,
+	91, 107, 97, 101, 141, 95, 71, 97, 95, 92, 94, 94, 93, 92, 107, 98, 101, 105, 144, 76,
+	100, 98, 95, 93, 94, 93, 92, 108, 74, 78, 82, 86, 177, 78, 75, 71, 68, 64, 64, 63,
+	162, 85, 86, 86, 82, 121, 169, 173, 175, 177, 178, 178, 181, 94, 169, 112, 112, 109, 130, 150,
+	152, 153, 153, 154, 153, 155, 95, 118, 171, 116, 113, 133, 153, 153, 154, 154, 155, 154, 156, 96,
+	119, 122, 173, 117, 140, 156, 156, 154, 155, 155, 155, 157, 92, 116, 120, 123, 175, 149, 159, 158,
+	156, 154, 155, 155, 155, 128, 79, 97, 98, 94, 111, 137, 139, 140, 140, 140, 139, 142, 89, 160,
+	86, 87, 83, 121, 165, 169, 172, 173, 175, 175, 177, 104, 95, 169, 113, 110, 130, 150, 150, 151,
+	151, 151, 151, 153, 105, 96, 119, 171, 113, 138, 153, 153, 151, 152, 152, 152, 154, 101, 92, 116,
+	120, 173, 147, 156, 155, 153, 151, 152, 152, 152, 119, 125, 87, 79, 95, 91, 109, 134, 136, 136,
+	136, 137, 136, 139, 94, 129, 84, 98, 95, 112, 135, 138, 139, 139, 139, 138, 141, 89, 93, 158,
+	87, 83, 121, 165, 166, 169, 170, 172, 172, 174, 102, 105, 96, 169, 110, 136, 150, 150, 148, 149,
+	149, 149, 151, 99, 102, 92, 116, 171, 146, 152, 152, 150, 148, 149, 148, 149, 116, 119, 122, 86,
+	86, 78, 88, 102, 130, 132, 133, 133, 134, 133, 136, 93, 126, 89, 83, 92, 103, 132, 134, 136,
+	135, 136, 135, 138, 93, 96, 129, 85, 95, 106, 135, 135, 137, 137, 138, 137, 140, 88, 93, 94,
+	156, 83, 121, 165, 165, 165, 167, 168, 169, 171, 96, 99, 102, 93, 169, 144, 149, 149, 147, 145,
+	146, 145, 146, 110, 111, 113, 119, 84, 84, 84, 73, 93, 126, 128, 130, 131, 130, 130, 130, 91,
+	123, 88, 87, 78, 95, 128, 131, 132, 133, 133, 132, 133, 92, 95, 126, 90, 80, 96, 132, 132,
+	134, 135, 134, 134, 134, 91, 94, 97, 129, 81, 98, 135, 135, 134, 136, 136, 135, 136, 83, 88,
+	89, 91, 154, 121, 165, 166, 165, 164, 166, 166, 167, 101, 103, 104, 106, 46, 36, 37, 38, 32,
+	17, 70, 72, 73, 74, 74, 73, 76, 46, 47, 39, 40, 35, 21, 71, 73, 75, 75, 75, 74,
+	77, 48, 50, 48, 41, 36, 26, 73, 73, 75, 76, 76, 75, 78, 48, 50, 51, 48, 37, 31,
+	75, 75, 75, 76, 77, 76, 78, 43, 45, 46, 48, 47, 34, 76, 76, 76, 75, 76, 75, 74,
+	30, 35, 39, 43, 47, 125, 83, 86, 86, 81, 70, 89, 136, 138, 138, 139, 138, 139, 93, 126,
+	89, 89, 84, 70, 89, 136, 138, 138, 139, 138, 139, 96, 98, 130, 93, 88, 76, 91, 138, 140,
+	141, 141, 141, 142, 96, 99, 102, 133, 91, 78, 92, 142, 141, 142, 143, 143, 143, 91, 94, 97,
+	100, 136, 78, 93, 146, 145, 143, 145, 144, 143, 81, 81, 86, 88, 88, 164, 126, 86, 86, 87,
+	81, 67, 85, 89, 141, 141, 141, 141, 142, 96, 129, 90, 90, 85, 71, 85, 90, 142, 142, 142,
+	142, 143, 96, 99, 130, 93, 88, 71, 89, 91, 142, 142, 142, 142, 143, 96, 100, 102, 134, 92,
+	77, 92, 92, 144, 144, 145, 144, 146, 91, 95, 98, 101, 137, 77, 94, 93, 147, 145, 146, 146,
+	146, 78, 82, 82, 87, 88, 167, 76, 128, 85, 87, 87, 82, 64, 86, 87, 90, 144, 144, 143,
+	144, 95, 131, 91, 91, 86, 68, 87, 88, 91, 145, 145, 145, 145, 96, 100, 133, 94, 90, 73,
+	90, 87, 91, 146, 146, 146, 146, 97, 100, 104, 134, 92, 73, 94, 91, 92, 146, 146, 146, 146,
+	92, 96, 99, 102, 138, 77, 96, 93, 92, 148, 148, 148, 147, 75, 79, 83, 84, 87, 169, 76,
+	72, 131, 86, 87, 88, 83, 62, 89, 89, 89, 91, 147, 147, 148, 96, 133, 91, 92, 87, 67,
+	89, 90, 90, 92, 148, 148, 149, 97, 101, 136, 95, 91, 71, 93, 90, 91, 93, 149, 149, 150,
+	97, 101, 105, 138, 95, 76, 96, 93, 90, 93, 150, 150, 151, 93, 97, 101, 104, 139, 75, 98,
+	95, 92, 92, 150, 150, 149, 74, 78, 82, 86, 85, 173, 78, 74, 70, 133, 87, 88, 89, 84,
+	62, 92, 92, 92, 92, 93, 150, 151, 96, 136, 92, 92, 88, 66, 92, 93, 93, 93, 94, 151,
+	152, 98, 101, 139, 96, 92, 70, 95, 93, 93, 93, 94, 152, 153, 98, 102, 105, 141, 96, 75,
+	99, 96, 93, 94, 95, 153, 154, 94, 98, 102, 105, 143, 78, 101, 98, 95, 92, 94, 154, 153,
+	73, 77, 81, 85, 88, 177, 80, 77, 73, 69, 133, 86, 88, 88, 84, 61, 90, 91, 92, 91,
+	91, 92, 151, 96, 136, 91, 92, 88, 65, 91, 93, 93, 93, 93, 93, 152, 97, 101, 139, 96,
+	92, 70, 94, 92, 93, 93, 93, 94, 153, 98, 101, 105, 141, 96, 74, 97, 95, 93, 93, 93,
+	94, 154, 94, 98, 101, 105, 143, 77, 100, 98, 95, 92, 93, 94, 153, 72, 76, 80, 84, 87,
+	178, 79, 76, 72, 68, 64, 134, 86, 87, 87, 84, 58, 90, 90, 91, 91, 91, 90, 96, 95,
+	137, 91, 91, 88, 63, 91, 91, 93, 92, 92, 91, 97, 97, 100, 139, 95, 92, 67, 94, 91,
+	93, 93, 93, 92, 97, 97, 101, 104, 142, 95, 72, 97, 94, 92, 93, 93, 92, 98, 94, 98,
+	101, 105, 144, 76, 101, 97, 96, 93, 93, 92, 94, 70, 74, 78, 82, 86, 177, 78, 74, 71,
+	67, 63, 63, 161, 79, 80, 80, 76, 73, 121, 173, 176, 177, 178, 179, 180, 89, 166, 107, 108,
+	105, 104, 128, 151, 152, 152, 152, 152, 154, 90, 114, 169, 112, 109, 107, 130, 152, 153, 153, 153,
+	153, 155, 90, 115, 118, 171, 113, 111, 139, 155, 153, 154, 154, 154, 156, 86, 112, 116, 119, 173,
+	115, 147, 157, 156, 153, 154, 154, 153, 83, 111, 114, 118, 121, 176, 157, 160, 159, 156, 154, 155,
+	155, 131, 77, 97, 97, 93, 91, 114, 143, 143, 143, 143, 143, 146, 87, 162, 83, 84, 80, 77,
+	121, 173, 176, 177, 178, 179, 180, 104, 92, 169, 111, 108, 106, 130, 152, 154, 153, 153, 154, 155,
+	104, 93, 117, 171, 112, 110, 139, 155, 154, 154, 154, 155, 156, 101, 90, 115, 118, 173, 113, 147,
+	158, 156, 154, 154, 154, 154, 98, 87, 113, 116, 120, 175, 157, 160, 158, 156, 153, 154, 154, 121,
+	128, 86, 77, 94, 90, 88, 111, 139, 140, 140, 140, 140, 142, 94, 129, 77, 97, 94, 91, 111,
+	139, 140, 140, 140, 140, 142, 87, 87, 161, 84, 81, 77, 121, 169, 172, 174, 174, 176, 177, 101,
+	104, 94, 169, 108, 106, 136, 152, 151, 151, 151, 151, 153, 98, 101, 90, 115, 171, 110, 146, 155,
+	153, 151, 151, 151, 151, 95, 98, 87, 113, 116, 173, 155, 157, 155, 153, 150, 151, 151, 118, 119,
+	125, 85, 85, 77, 87, 85, 103, 136, 137, 137, 137, 137, 139, 93, 126, 87, 77, 91, 88, 103,
+	136, 137, 137, 137, 137, 139, 92, 95, 130, 82, 94, 91, 105, 137, 139, 139, 139, 139, 141, 87,
+	87, 91, 159, 81, 77, 121, 169, 168, 170, 171, 172, 174, 95, 98, 101, 90, 169, 106, 144, 151,
+	150, 148, 148, 148, 148, 92, 95, 98, 87, 113, 171, 154, 154, 152, 150, 147, 148, 148, 111, 111,
+	113, 122, 83, 84, 83, 72, 83, 94, 132, 133, 134, 133, 134, 134, 91, 123, 86, 86, 72, 86,
+	94, 132, 133, 134, 133, 134, 134, 91, 94, 127, 90, 77, 89, 96, 134, 136, 136, 136, 136, 136,
+	91, 94, 97, 130, 79, 92, 98, 138, 137, 138, 137, 138, 138, 82, 82, 87, 89, 157, 77, 121,
+	169, 169, 167, 168, 170, 170, 90, 93, 96, 99, 87, 170, 153, 151, 150, 148, 145, 146, 145, 103,
+	103, 104, 106, 119, 79, 82, 82, 77, 68, 84, 129, 130, 130, 131, 131, 131, 87, 120, 85, 85,
+	80, 68, 85, 129, 130, 130, 131, 131, 131, 90, 92, 124, 89, 84, 73, 87, 130, 132, 133, 133,
+	133, 134, 90, 92, 96, 127, 87, 75, 88, 134, 133, 134, 135, 135, 135, 85, 88, 91, 94, 130,
+	75, 89, 137, 137, 135, 136, 136, 135, 78, 79, 83, 85, 85, 155, 121, 170, 169, 167, 166, 167,
+	167, 94, 94, 96, 97, 98, 47, 36, 37, 38, 33, 29, 17, 71, 72, 72, 73, 73, 76, 47,
+	47, 41, 42, 37, 33, 17, 71, 72, 72, 73, 73, 76, 48, 51, 48, 44, 39, 35, 22, 72,
+	74, 74, 74, 75, 77, 48, 52, 54, 48, 41, 37, 26, 74, 74, 75, 75, 75, 78, 43, 47,
+	49, 51, 47, 37, 30, 75, 75, 73, 74, 75, 74, 40, 44, 46, 47, 47, 46, 34, 76, 76,
+	75, 73, 74, 74, 31, 31, 35, 39, 43, 46, 124, 85, 85, 86, 81, 76, 66, 81, 138, 138,
+	138, 139, 140, 95, 126, 85, 89, 84, 80, 67, 81, 138, 138, 138, 139, 140, 95, 95, 127, 91,
+	87, 83, 67, 82, 138, 138, 138, 139, 140, 96, 98, 100, 131, 91, 86, 72, 84, 140, 141, 141,
+	142, 143, 91, 94, 97, 100, 134, 88, 73, 84, 143, 142, 142, 143, 143, 86, 90, 93, 96, 98,
+	137, 73, 84, 147, 145, 143, 145, 144, 78, 78, 78, 83, 84, 84, 165, 126, 85, 86, 86, 82,
+	77, 64, 84, 82, 141, 141, 141, 142, 95, 127, 89, 89, 85, 81, 64, 85, 82, 141, 141, 141,
+	142, 96, 98, 130, 93, 89, 85, 69, 85, 83, 142, 143, 142, 143, 96, 99, 102, 131, 92, 88,
+	69, 88, 83, 142, 143, 142, 143, 92, 95, 99, 101, 135, 90, 73, 91, 84, 144, 145, 145, 144,
+	88, 91, 94, 97, 100, 138, 74, 93, 84, 148, 146, 146, 146, 75, 76, 80, 80, 84, 85, 167,
+	72, 129, 85, 87, 87, 83, 79, 63, 87, 87, 82, 145, 144, 145, 95, 130, 89, 91, 86, 83,
+	63, 87, 87, 82, 145, 144, 145, 97, 99, 133, 95, 90, 87, 67, 87, 88, 84, 146, 146, 146,
+	97, 100, 104, 135, 94, 90, 72, 91, 88, 84, 147, 147, 148, 93, 96, 100, 103, 136, 92, 71,
+	93, 90, 83, 147, 146, 146, 89, 93, 96, 100, 101, 139, 75, 95, 93, 84, 148, 149, 148, 74,
+	74, 78, 82, 82, 86, 171, 74, 70, 131, 86, 88, 88, 84, 81, 62, 90, 90, 89, 83, 148,
+	149, 96, 133, 90, 92, 88, 84, 62, 90, 90, 90, 83, 148, 149, 97, 100, 136, 95, 92, 88,
+	67, 90, 91, 91, 85, 149, 150, 98, 101, 105, 138, 95, 92, 71, 93, 91, 91, 85, 150, 151,
+	94, 97, 101, 104, 140, 95, 74, 96, 93, 90, 84, 151, 150, 91, 94, 98, 101, 104, 141, 73,
+	98, 95, 92, 83, 151, 150, 73, 73, 78, 82, 85, 84, 175, 77, 73, 69, 134, 87, 88, 89,
+	85, 82, 61, 92, 93, 92, 92, 85, 152, 97, 136, 91, 92, 89, 85, 62, 93, 93, 92, 92,
+	85, 152, 98, 101, 138, 96, 92, 89, 66, 93, 94, 94, 94, 86, 153, 99, 102, 105, 141, 96,
+	93, 70, 96, 93, 94, 94, 87, 154, 95, 98, 102, 105, 143, 96, 74, 99, 96, 93, 93, 86,
+	154, 92, 95, 99, 102, 105, 145, 77, 101, 98, 95, 92, 85, 155, 73, 73, 77, 81, 84, 87,
+	179, 78, 76, 72, 67, 134, 86, 88, 88, 85, 81, 59, 90, 92, 91, 91, 91, 87, 96, 135,
+	90, 92, 88, 84, 60, 91, 92, 92, 91, 91, 88, 97, 100, 138, 95, 92, 88, 64, 91, 93,
+	93, 93, 92, 89, 98, 101, 105, 141, 96, 92, 68, 94, 92, 93, 93, 93, 89, 95, 98, 102,
+	105, 143, 96, 73, 97, 96, 92, 93, 93, 85, 91, 94, 98, 101, 105, 144, 76, 100, 98, 95,
+	92, 92, 85, 71, 71, 75, 79, 83, 86, 178, 77, 75, 70, 66, 62, 161, 75, 75, 76, 73,
+	69, 69, 121, 176, 178, 178, 179, 181, 85, 166, 105, 106, 104, 102, 98, 128, 153, 153, 152, 152,
+	155, 85, 112, 167, 109, 107, 105, 102, 129, 153, 153, 152, 152, 155, 86, 113, 115, 170, 110, 109,
+	105, 137, 153, 154, 153, 153, 156, 83, 111, 114, 117, 172, 113, 109, 147, 156, 153, 154, 153, 153,
+	79, 109, 112, 116, 119, 174, 113, 156, 159, 156, 154, 154, 155, 79, 106, 109, 112, 116, 119, 175,
+	164, 161, 158, 156, 153, 155, 130, 73, 93, 95, 91, 88, 89, 113, 143, 143, 143, 142, 145, 83,
+	162, 79, 80, 76, 72, 69, 121, 176, 177, 178, 178, 181, 101, 88, 167, 107, 105, 103, 102, 128,
+	153, 153, 152, 152, 155, 102, 89, 114, 169, 109, 107, 105, 137, 153, 154, 153, 153, 156, 99, 86,
+	112, 116, 171, 111, 109, 146, 155, 153, 153, 153, 153, 96, 82, 110, 114, 117, 173, 113, 155, 158,
+	155, 153, 153, 154, 97, 79, 109, 112, 116, 119, 175, 164, 161, 158, 156, 153, 155, 120, 130, 85,
+	73, 94, 91, 88, 89, 113, 143, 143, 142, 142, 145, 93, 132, 77, 98, 94, 91, 89, 113, 144,
+	144, 143, 143, 146, 83, 87, 163, 83, 80, 76, 73, 121, 176, 177, 178, 178, 181, 102, 105, 92,
+	169, 108, 106, 104, 137, 154, 154, 154, 153, 156, 98, 101, 89, 115, 171, 110, 107, 146, 156, 153,
+	154, 153, 154, 96, 99, 86, 113, 116, 173, 111, 155, 158, 156, 153, 153, 154, 97, 96, 83, 111,
+	114, 117, 174, 163, 160, 158, 155, 152, 154, 120, 121, 127, 84, 84, 73, 88, 85, 86, 104, 140,
+	140, 139, 139, 142, 92, 129, 88, 77, 91, 88, 86, 105, 141, 141, 140, 140, 143, 92, 95, 130,
+	77, 94, 92, 89, 105, 141, 141, 140, 140, 143, 83, 87, 87, 161, 80, 76, 73, 121, 172, 174,
+	175, 175, 177, 95, 98, 101, 90, 169, 106, 104, 144, 153, 150, 151, 150, 151, 93, 96, 99, 86,
+	113, 171, 107, 154, 155, 153, 150, 150, 151, 94, 93, 96, 83, 111, 114, 172, 162, 157, 155, 152,
+	149, 151, 112, 112, 113, 124, 83, 84, 83, 68, 83, 84, 95, 136, 137, 136, 136, 137, 91, 126,
+	87, 87, 72, 86, 84, 95, 137, 137, 137, 137, 138, 91, 95, 127, 90, 73, 90, 87, 95, 137,
+	138, 137, 137, 138, 91, 94, 97, 131, 78, 93, 90, 97, 139, 140, 139, 139, 140, 79, 83, 83,
+	87, 159, 76, 73, 121, 172, 171, 172, 172, 174, 91, 94, 97, 100, 86, 170, 104, 153, 153, 150,
+	148, 148, 148, 92, 91, 94, 97, 83, 111, 171, 162, 155, 153, 150, 147, 148, 103, 104, 104, 106,
+	121, 82, 82, 82, 78, 64, 81, 85, 133, 133, 133, 133, 134, 89, 123, 86, 86, 81, 69, 81,
+	86, 134, 134, 134, 134, 135, 89, 93, 124, 89, 84, 69, 85, 86, 134, 134, 134, 134, 135, 90,
+	94, 96, 128, 88, 74, 88, 88, 135, 136, 136, 136, 138, 85, 89, 92, 95, 131, 75, 90, 89,
+	139, 137, 138, 137, 138, 75, 79, 79, 84, 85, 158, 73, 121, 173, 171, 169, 169, 171, 89, 89,
+	92, 95, 97, 83, 170, 161, 153, 150, 148, 145, 146, 94, 95, 95, 97, 97, 119, 81, 81, 82,
+	77, 73, 64, 77, 130, 130, 131, 131, 132, 89, 120, 81, 84, 80, 76, 65, 78, 130, 130, 131,
+	131, 132, 89, 89, 121, 87, 83, 79, 65, 78, 130, 130, 131, 131, 132, 89, 92, 94, 125, 87,
+	83, 70, 80, 132, 133, 133, 134, 134, 85, 88, 91, 94, 128, 85, 71, 80, 135, 134, 134, 135,
+	135, 81, 84, 87, 90, 92, 130, 71, 81, 139, 137, 135, 136, 136, 75, 75, 76, 80, 81, 81,
+	156, 121, 173, 171, 169, 167, 168, 87, 87, 88, 89, 90, 90, 46, 37, 37, 38, 33, 29, 29,
+	16, 70, 70, 71, 71, 75, 47, 48, 41, 43, 38, 33, 29, 18, 71, 72, 72, 72, 76, 47,
+	51, 48, 46, 42, 38, 34, 18, 71, 72, 72, 72, 76, 49, 53, 56, 49, 44, 40, 36, 22,
+	72, 73, 73, 74, 78, 44, 48, 52, 54, 48, 40, 36, 26, 73, 72, 73, 73, 74, 40, 44,
+	48, 50, 50, 47, 36, 29, 74, 73, 72, 73, 74, 40, 40, 44, 46, 47, 47, 46, 33, 75,
+	74, 73, 72, 74, 30, 31, 31, 35, 39, 42, 45, 124, 85, 85, 85, 81, 77, 76, 63, 74,
+	138, 138, 138, 140, 94, 125, 88, 88, 85, 80, 76, 64, 75, 139, 139, 139, 140, 95, 98, 127,
+	89, 87, 84, 79, 65, 76, 139, 139, 139, 140, 95, 98, 98, 127, 90, 87, 83, 65, 76, 139,
+	139, 139, 140, 91, 94, 97, 99, 131, 89, 85, 69, 77, 140, 141, 141, 141, 87, 90, 94, 96,
+	99, 134, 87, 70, 77, 144, 142, 142, 142, 86, 86, 89, 92, 95, 97, 137, 70, 78, 147, 145,
+	143, 144, 74, 75, 76, 76, 80, 81, 81, 165, 127, 85, 85, 87, 82, 79, 78, 62, 84, 75,
+	142, 142, 143, 95, 128, 89, 90, 86, 82, 78, 63, 85, 76, 142, 142, 143, 95, 99, 129, 93,
+	89, 86, 81, 63, 85, 76, 142, 142, 143, 96, 100, 102, 132, 93, 90, 85, 68, 86, 77, 143,
+	143, 144, 92, 96, 98, 102, 133, 91, 87, 67, 88, 77, 143, 143, 143, 89, 92, 95, 99, 100,
+	136, 90, 71, 90, 77, 145, 145, 145, 88, 88, 91, 95, 97, 99, 139, 72, 93, 77, 148, 146,
+	146, 73, 74, 75, 79, 78, 82, 83, 169, 70, 129, 86, 86, 88, 84, 80, 80, 61, 87, 86,
+	75, 145, 146, 96, 131, 90, 91, 87, 84, 80, 62, 88, 87, 76, 145, 146, 96, 99, 132, 94,
+	91, 87, 84, 63, 88, 88, 77, 145, 146, 97, 101, 103, 135, 94, 91, 87, 67, 88, 89, 78,
+	146, 148, 94, 97, 100, 104, 137, 94, 90, 70, 91, 87, 77, 147, 147, 90, 94, 97, 101, 103,
+	137, 92, 70, 93, 90, 76, 147, 147, 90, 90, 93, 97, 100, 101, 141, 74, 95, 92, 77, 148,
+	149, 72, 74, 74, 78, 81, 80, 84, 173, 73, 68, 132, 87, 87, 88, 85, 81, 82, 60, 90,
+	89, 89, 76, 149, 97, 134, 91, 92, 88, 85, 82, 62, 91, 90, 90, 77, 150, 97, 100, 135,
+	95, 92, 89, 85, 62, 91, 90, 90, 77, 150, 98, 101, 104, 138, 95, 92, 89, 67, 91, 92,
+	92, 79, 151, 94, 98, 101, 105, 140, 95, 92, 70, 93, 90, 91, 78, 150, 92, 95, 98, 102,
+	104, 142, 95, 73, 96, 93, 89, 77, 151, 92, 92, 95, 99, 101, 104, 142, 72, 98, 95, 92,
+	77, 151, 72, 73, 73, 77, 81, 84, 83, 177, 75, 71, 67, 135, 87, 87, 89, 86, 82, 82,
+	59, 92, 91, 91, 91, 81, 97, 137, 91, 92, 89, 85, 82, 60, 93, 92, 92, 92, 82, 97,
+	101, 138, 95, 93, 89, 86, 61, 93, 93, 92, 92, 82, 98, 102, 104, 141, 96, 93, 89, 65,
+	93, 94, 94, 93, 83, 95, 99, 102, 106, 143, 96, 93, 69, 96, 93, 94, 94, 79, 92, 95,
+	98, 102, 105, 144, 96, 73, 98, 95, 92, 93, 79, 92, 92, 95, 99, 102, 105, 146, 76, 101,
+	98, 94, 91, 78, 70, 72, 72, 76, 80, 83, 86, 180, 78, 74, 70, 66, 160, 72, 73, 73,
+	70, 66, 66, 65, 121, 178, 179, 179, 181, 82, 166, 105, 105, 103, 101, 98, 98, 128, 153, 153,
+	153, 155, 83, 112, 167, 108, 106, 104, 101, 98, 129, 154, 153, 153, 155, 83, 112, 115, 168, 108,
+	108, 104, 101, 135, 154, 153, 153, 155, 80, 110, 113, 115, 170, 111, 108, 105, 145, 153, 153, 153,
+	152, 77, 108, 111, 114, 118, 173, 111, 108, 156, 156, 154, 154, 154, 77, 105, 108, 111, 114, 118,
+	174, 111, 164, 158, 156, 153, 154, 76, 105, 105, 108, 112, 115, 118, 176, 170, 161, 159, 156, 154,
+	129, 70, 93, 93, 90, 88, 89, 88, 113, 144, 143, 143, 145, 80, 161, 76, 76, 73, 70, 66,
+	66, 121, 178, 179, 179, 180, 100, 86, 167, 107, 104, 102, 101, 97, 128, 153, 153, 152, 154, 100,
+	86, 113, 168, 107, 106, 104, 100, 135, 153, 153, 152, 154, 98, 83, 111, 114, 170, 109, 108, 104,
+	145, 153, 153, 153, 152, 95, 80, 109, 112, 116, 171, 111, 107, 155, 155, 152, 153, 153, 96, 77,
+	108, 111, 114, 118, 174, 111, 163, 158, 156, 153, 154, 95, 76, 104, 107, 111, 114, 118, 175, 169,
+	160, 158, 155, 153, 120, 128, 84, 70, 92, 89, 87, 88, 88, 112, 143, 142, 142, 144, 91, 131,
+	74, 95, 93, 90, 87, 88, 113, 144, 143, 143, 145, 80, 84, 162, 80, 77, 73, 69, 66, 121,
+	178, 178, 179, 180, 99, 102, 89, 167, 105, 104, 102, 100, 134, 153, 153, 152, 154, 97, 100, 86,
+	112, 169, 108, 106, 104, 145, 152, 153, 152, 152, 94, 97, 83, 111, 114, 171, 109, 107, 154, 155,
+	152, 152, 152, 95, 95, 80, 109, 112, 116, 172, 111, 162, 157, 154, 152, 153, 95, 96, 76, 107,
+	111, 114, 118, 175, 169, 160, 158, 155, 153, 119, 120, 128, 84, 84, 70, 89, 87, 88, 88, 106,
+	142, 142, 142, 144, 91, 131, 88, 74, 93, 90, 87, 88, 106, 143, 143, 143, 145, 92, 95, 133,
+	78, 96, 93, 90, 88, 107, 144, 144, 144, 146, 80, 84, 88, 163, 79, 77, 73, 70, 121, 178,
+	178, 179, 180, 97, 100, 103, 89, 169, 107, 105, 102, 144, 153, 153, 153, 152, 94, 97, 100, 87,
+	114, 171, 108, 106, 154, 155, 153, 153, 153, 95, 95, 98, 83, 111, 115, 172, 109, 162, 158, 155,
+	152, 153, 95, 96, 95, 80, 109, 113, 116, 174, 169, 160, 157, 154, 152, 114, 114, 115, 125, 83,
+	84, 84, 66, 85, 85, 85, 96, 139, 139, 138, 138, 91, 128, 87, 87, 70, 88, 85, 86, 96,
+	140, 140, 139, 140, 91, 95, 130, 91, 74, 91, 88, 85, 97, 141, 141, 140, 140, 91, 95, 98,
+	131, 74, 94, 91, 89, 97, 141, 141, 140, 140, 76, 80, 84, 84, 162, 77, 73, 70, 121, 174,
+	176, 176, 176, 92, 95, 98, 101, 86, 170, 105, 103, 153, 153, 150, 151, 150, 93, 93, 96, 99,
+	83, 112, 171, 106, 162, 155, 153, 150, 150, 93, 93, 93, 96, 80, 109, 113, 173, 168, 158, 155,
+	152, 149, 104, 105, 105, 105, 122, 81, 83, 83, 79, 62, 82, 82, 85, 136, 136, 135, 136, 89,
+	125, 86, 86, 82, 66, 83, 84, 87, 137, 137, 136, 137, 90, 94, 127, 90, 86, 70, 86, 83,
+	87, 138, 138, 137, 138, 90, 94, 97, 128, 88, 70, 89, 86, 87, 138, 138, 137, 138, 86, 90,
+	93, 95, 131, 74, 91, 89, 88, 139, 140, 139, 139, 73, 77, 80, 81, 84, 160, 73, 70, 121,
+	174, 172, 173, 174, 90, 90, 93, 96, 99, 83, 170, 103, 161, 153, 151, 148, 148, 90, 91, 91,
+	94, 96, 80, 110, 172, 168, 155, 153, 150, 147, 95, 96, 96, 96, 97, 120, 81, 82, 82, 78,
+	74, 62, 80, 78, 133, 133, 133, 134, 89, 121, 85, 85, 81, 77, 62, 81, 78, 133, 133, 133,
+	134, 90, 92, 124, 89, 85, 81, 66, 81, 79, 134, 134, 134, 135, 90, 92, 96, 125, 87, 84,
+	67, 84, 79, 134, 134, 134, 135, 86, 89, 92, 95, 128, 86, 71, 87, 80, 136, 136, 136, 136,
+	82, 85, 89, 91, 94, 131, 72, 89, 80, 139, 137, 138, 137, 73, 73, 77, 77, 81, 82, 158,
+	70, 121, 175, 172, 170, 171, 88, 88, 89, 92, 94, 96, 80, 171, 168, 153, 150, 148, 145, 87,
+	88, 89, 89, 89, 90, 118, 81, 81, 81, 77, 73, 72, 61, 71, 131, 131, 130, 132, 88, 120,
+	84, 84, 81, 77, 73, 62, 72, 131, 131, 131, 132, 88, 92, 121, 84, 83, 80, 76, 62, 72,
+	131, 131, 131, 132, 89, 92, 92, 122, 86, 83, 79, 63, 73, 131, 131, 131, 132, 85, 88, 91,
+	93, 125, 85, 81, 67, 74, 132, 133, 133, 133, 81, 84, 88, 90, 93, 128, 83, 68, 74, 136,
+	134, 134, 134, 80, 80, 84, 87, 89, 91, 130, 68, 74, 139, 137, 135, 136, 72, 73, 73, 74,
+	77, 78, 78, 156, 121, 175, 173, 170, 167, 81, 82, 82, 83, 83, 84, 84, 46, 37, 38, 38,
+	33, 30, 30, 29, 16, 68, 69, 69, 73, 47, 47, 42, 42, 38, 34, 30, 30, 17, 70, 70,
+	70, 74, 48, 52, 49, 47, 42, 39, 34, 30, 18, 71, 71, 71, 75, 48, 52, 56, 49, 46,
+	43, 39, 35, 18, 71, 71, 71, 75, 44, 48, 52, 56, 49, 44, 40, 36, 22, 71, 71, 72,
+	72, 40, 45, 49, 53, 54, 48, 40, 36, 26, 72, 70, 71, 72, 41, 41, 45, 49, 50, 50,
+	47, 36, 29, 73, 71, 70, 72, 40, 41, 41, 45, 46, 46, 47, 46, 33, 74, 72, 71, 71,
+	30, 31, 32, 32, 35, 38, 42, 45, 123, 84, 85, 85, 81, 78, 77, 75, 61, 68, 138, 138,
+	139, 94, 125, 88, 88, 84, 81, 77, 76, 62, 70, 138, 138, 139, 95, 98, 126, 92, 88, 85,
+	81, 76, 63, 71, 138, 138, 139, 95, 98, 101, 127, 88, 88, 84, 80, 63, 71, 138, 138, 140,
+	91, 94, 97, 98, 128, 89, 86, 82, 63, 70, 138, 138, 138, 88, 91, 95, 97, 99, 132, 89,
+	84, 67, 71, 140, 140, 140, 87, 87, 91, 94, 96, 98, 135, 86, 68, 72, 143, 141, 142, 85,
+	86, 86, 90, 92, 94, 96, 137, 68, 72, 147, 145, 143, 72, 73, 74, 75, 74, 78, 79, 79,
+	165, 126, 85, 86, 86, 83, 79, 79, 77, 60, 83, 69, 141, 142, 94, 128, 89, 89, 86, 83,
+	79, 78, 61, 84, 70, 141, 143, 95, 99, 129, 93, 90, 87, 83, 78, 63, 85, 71, 142, 143,
+	96, 99, 102, 130, 93, 89, 86, 82, 63, 85, 72, 142, 143, 93, 96, 99, 102, 133, 92, 89,
+	85, 66, 84, 72, 143, 142, 90, 93, 96, 99, 101, 133, 91, 87, 66, 86, 71, 142, 142, 89,
+	90, 93, 96, 99, 100, 137, 89, 70, 89, 71, 144, 144, 88, 88, 89, 92, 95, 97, 99, 139,
+	71, 91, 71, 147, 145, 72, 73, 74, 74, 77, 77, 80, 81, 169, 68, 129, 86, 87, 87, 84,
+	81, 81, 80, 60, 85, 85, 69, 146, 95, 130, 90, 90, 87, 84, 81, 81, 61, 86, 86, 71,
+	146, 96, 100, 132, 94, 91, 88, 85, 81, 62, 88, 87, 72, 146, 96, 100, 103, 133, 94, 91,
+	88, 84, 63, 88, 87, 72, 146, 94, 97, 100, 103, 136, 94, 91, 87, 66, 87, 88, 72, 146,
+	91, 94, 98, 101, 103, 137, 94, 90, 69, 89, 86, 72, 147, 91, 91, 94, 98, 100, 103, 138,
+	92, 68, 92, 89, 71, 146, 90, 91, 91, 94, 97, 99, 101, 141, 73, 94, 91, 71, 148, 71,
+	72, 73, 74, 77, 80, 79, 83, 173, 71, 67, 132, 86, 87, 87, 85, 81, 81, 80, 58, 88,
+	87, 87, 73, 96, 133, 91, 91, 88, 85, 81, 81, 59, 89, 88, 88, 75, 97, 100, 135, 94,
+	92, 88, 85, 82, 61, 90, 89, 89, 76, 97, 100, 104, 136, 95, 92, 89, 85, 61, 90, 90,
+	89, 76, 95, 98, 101, 104, 138, 95, 92, 89, 65, 90, 91, 90, 73, 91, 94, 98, 101, 104,
+	140, 95, 91, 69, 92, 89, 90, 73, 91, 92, 95, 98, 102, 104, 141, 94, 72, 94, 91, 88,
+	72, 91, 92, 92, 95, 98, 101, 104, 142, 71, 97, 94, 90, 71, 69, 71, 72, 72, 76, 79,
+	83, 82, 176, 74, 70, 66, 160, 70, 71, 72, 68, 65, 65, 64, 63, 121, 180, 180, 182, 80,
+	166, 104, 105, 102, 101, 98, 98, 97, 128, 154, 153, 155, 81, 111, 168, 108, 105, 104, 101, 98,
+	98, 129, 154, 154, 156, 82, 112, 115, 169, 108, 108, 104, 101, 98, 136, 154, 154, 156, 78, 109,
+	112, 115, 170, 110, 107, 104, 102, 144, 154, 153, 152, 76, 108, 111, 114, 117, 172, 111, 108, 105,
+	155, 154, 154, 154, 75, 105, 108, 111, 114, 117, 173, 111, 108, 163, 156, 153, 154, 75, 105, 105,
+	108, 111, 115, 117, 175, 111, 170, 159, 156, 154, 74, 105, 105, 106, 109, 112, 115, 117, 177, 176,
+	163, 160, 158, 130, 67, 92, 93, 89, 88, 89, 88, 87, 113, 144, 143, 146, 78, 162, 74, 75,
+	71, 68, 65, 64, 64, 121, 180, 180, 181, 100, 84, 167, 107, 104, 102, 101, 97, 97, 128, 154,
+	153, 155, 101, 85, 114, 169, 107, 106, 104, 100, 98, 135, 154, 153, 156, 97, 81, 111, 114, 169,
+	108, 107, 103, 101, 143, 153, 153, 152, 95, 79, 109, 112, 115, 171, 111, 107, 104, 154, 153, 153,
+	153, 96, 75, 108, 111, 114, 117, 173, 111, 108, 163, 156, 153, 154, 96, 75, 104, 107, 110, 114,
+	117, 174, 110, 169, 158, 155, 153, 95, 74, 105, 105, 108, 111, 115, 117, 176, 175, 162, 159, 157,
+	120, 129, 83, 68, 92, 89, 87, 88, 88, 87, 112, 143, 142, 145, 91, 131, 72, 96, 92, 90,
+	87, 88, 88, 113, 144, 143, 146, 78, 82, 163, 78, 74, 72, 68, 64, 64, 121, 179, 180, 181,
+	100, 103, 88, 168, 105, 104, 102, 100, 97, 135, 154, 153, 155, 96, 99, 84, 112, 169, 106, 105,
+	103, 100, 143, 153, 152, 152, 94, 97, 82, 111, 113, 170, 109, 107, 103, 153, 152, 152, 153, 95,
+	95, 78, 109, 112, 115, 172, 111, 107, 162, 155, 152, 153, 96, 96, 75, 107, 110, 114, 117, 174,
+	110, 169, 158, 155, 153, 95, 95, 75, 104, 107, 110, 114, 117, 175, 174, 161, 158, 156, 119, 120,
+	128, 83, 83, 68, 88, 86, 87, 87, 87, 106, 142, 142, 144, 91, 130, 87, 72, 91, 89, 86,
+	87, 88, 106, 143, 143, 145, 91, 94, 133, 77, 94, 92, 90, 87, 88, 107, 144, 143, 146, 79,
+	82, 86, 164, 78, 75, 71, 68, 64, 121, 179, 179, 180, 95, 98, 101, 87, 168, 105, 103, 101,
+	100, 142, 153, 152, 152, 94, 97, 100, 85, 112, 170, 107, 105, 103, 153, 152, 152, 152, 95, 94,
+	97, 81, 110, 114, 171, 108, 107, 161, 154, 151, 152, 95, 95, 95, 78, 108, 112, 115, 173, 110,
+	167, 157, 154, 152, 95, 95, 95, 75, 107, 110, 114, 117, 175, 173, 161, 158, 156, 113, 114, 114,
+	128, 83, 84, 84, 64, 87, 88, 88, 88, 98, 142, 141, 141, 91, 130, 88, 88, 68, 90, 87,
+	88, 88, 98, 143, 142, 143, 92, 95, 133, 92, 72, 93, 90, 88, 89, 98, 144, 143, 144, 92,
+	95, 99, 135, 76, 96, 94, 91, 88, 99, 145, 144, 144, 75, 79, 82, 86, 165, 77, 75, 71,
+	67, 121, 179, 180, 180, 94, 97, 100, 103, 87, 171, 106, 104, 102, 154, 153, 153, 153, 95, 95,
+	98, 101, 84, 113, 172, 108, 105, 162, 156, 153, 153, 95, 96, 95, 98, 81, 111, 114, 174, 109,
+	168, 158, 155, 152, 95, 96, 96, 96, 78, 109, 112, 116, 175, 174, 161, 158, 155, 106, 106, 107,
+	107, 124, 82, 83, 84, 80, 60, 85, 85, 85, 86, 139, 138, 139, 89, 127, 87, 87, 83, 65,
+	85, 86, 86, 88, 140, 139, 140, 91, 94, 129, 91, 87, 69, 88, 85, 86, 88, 141, 140, 141,
+	91, 95, 98, 132, 91, 73, 91, 89, 86, 89, 142, 141, 142, 87, 91, 94, 98, 132, 72, 94,
+	91, 88, 88, 142, 141, 141, 71, 75, 79, 83, 82, 163, 75, 71, 67, 121, 176, 177, 177, 92,
+	93, 96, 99, 101, 84, 171, 104, 102, 161, 153, 151, 151, 92, 93, 93, 96, 98, 81, 111, 173,
+	106, 168, 156, 153, 150, 92, 93, 94, 93, 95, 78, 109, 112, 174, 173, 159, 156, 153, 96, 97,
+	97, 98, 97, 123, 81, 83, 83, 79, 76, 61, 83, 83, 78, 136, 136, 137, 89, 124, 85, 86,
+	82, 79, 61, 83, 83, 78, 136, 136, 137, 90, 93, 126, 90, 86, 83, 65, 83, 84, 80, 137,
+	137, 138, 91, 94, 97, 129, 90, 86, 69, 86, 84, 80, 138, 138, 139, 87, 90, 94, 97, 129,
+	88, 68, 89, 86, 79, 138, 138, 138, 84, 87, 90, 94, 95, 133, 72, 91, 88, 80, 140, 140,
+	140, 72, 72, 76, 79, 79, 82, 162, 71, 67, 121, 176, 173, 174, 90, 90, 91, 94, 96, 98,
+	81, 172, 102, 168, 153, 151, 148, 90, 91, 92, 91, 93, 96, 78, 109, 173, 173, 157, 154, 151,
+	88, 88, 89, 90, 89, 90, 121, 81, 81, 83, 79, 75, 74, 60, 80, 71, 134, 133, 135, 89,
+	122, 85, 86, 82, 79, 74, 61, 81, 72, 134, 134, 135, 89, 92, 123, 89, 84, 82, 78, 61,
+	81, 73, 134, 134, 135, 90, 93, 96, 126, 88, 85, 81, 65, 81, 74, 135, 135, 136, 86, 90,
+	92, 95, 126, 87, 84, 65, 84, 73, 135, 135, 135, 83, 86, 89, 93, 94, 130, 86, 69, 86,
+	74, 136, 137, 137, 82, 82, 85, 89, 91, 93, 132, 70, 88, 74, 140, 137, 138, 71, 72, 72,
+	76, 75, 79, 80, 160, 67, 121, 176, 174, 171, 88, 89, 89, 89, 91, 93, 96, 78, 172, 173,
+	154, 152, 149, 81, 83, 83, 84, 83, 83, 84, 118, 80, 81, 81, 77, 74, 73, 72, 59, 65,
+	130, 130, 131, 87, 119, 84, 84, 80, 78, 74, 73, 60, 67, 130, 130, 131, 88, 92, 121, 88,
+	84, 81, 77, 73, 61, 68, 131, 130, 132, 89, 92, 95, 122, 84, 84, 80, 76, 61, 68, 131,
+	130, 132, 85, 88, 91, 91, 122, 85, 82, 78, 61, 67, 130, 130, 130, 82, 85, 89, 91, 92,
+	126, 85, 81, 65, 68, 132, 132, 132, 81, 82, 85, 88, 90, 92, 128, 83, 66, 69, 135, 133,
+	134, 80, 80, 81, 84, 86, 88, 90, 131, 66, 69, 139, 136, 134, 70, 71, 72, 72, 72, 75,
+	76, 76, 156, 121, 177, 174, 171, 76, 77, 78, 78, 78, 79, 79, 79, 46, 36, 38, 39, 33,
+	30, 31, 30, 29, 15, 69, 69, 73, 47, 47, 42, 43, 38, 35, 31, 31, 30, 16, 70, 70,
+	74, 48, 52, 48, 48, 42, 39, 35, 31, 31, 17, 71, 71, 75, 49, 53, 57, 50, 47, 43,
+	40, 35, 31, 19, 72, 72, 76, 44, 48, 52, 56, 49, 46, 43, 39, 35, 17, 71, 71, 71,
+	41, 45, 49, 53, 55, 49, 44, 40, 36, 21, 71, 71, 73, 41, 41, 46, 50, 53, 54, 48,
+	40, 36, 25, 72, 70, 72, 41, 42, 42, 46, 49, 50, 50, 47, 36, 28, 73, 71, 71, 40,
+	41, 42, 42, 45, 46, 46, 47, 46, 33, 74, 73, 73, 29, 30, 31, 32, 31, 34, 38, 41,
+	45, 127, 85, 86, 87, 83, 79, 80, 78, 75, 60, 66, 142, 143, 95, 129, 90, 91, 86, 83,
+	80, 79, 77, 61, 67, 142, 143, 96, 99, 130, 94, 90, 87, 84, 79, 78, 62, 68, 142, 144,
+	97, 100, 103, 131, 93, 90, 87, 83, 78, 64, 69, 143, 144, 93, 96, 99, 103, 132, 89, 89,
+	85, 80, 63, 69, 143, 142, 90, 93, 96, 100, 99, 133, 90, 87, 83, 62, 68, 142, 142, 90,
+	90, 94, 97, 98, 100, 136, 90, 85, 66, 69, 144, 144, 88, 89, 89, 93, 95, 97, 99, 139,
+	87, 67, 69, 147, 145, 86, 87, 88, 88, 90, 92, 95, 97, 142, 67, 69, 152, 150, 71, 72,
+	74, 75, 74, 73, 77, 78, 78, 170, 130, 86, 87, 88, 84, 82, 82, 80, 78, 59, 85, 66,
+	146, 96, 131, 90, 91, 87, 85, 82, 81, 79, 60, 87, 67, 147, 97, 100, 133, 95, 91, 89,
+	85, 82, 80, 62, 88, 69, 147, 98, 101, 104, 134, 94, 92, 89, 85, 80, 63, 89, 70, 147,
+	94, 97, 100, 104, 135, 94, 91, 88, 83, 62, 88, 69, 146, 92, 95, 98, 102, 103, 137, 93,
+	91, 86, 66, 87, 69, 147, 92, 92, 95, 98, 100, 103, 138, 92, 88, 65, 89, 68, 146, 91,
+	92, 92, 95, 97, 100, 101, 141, 90, 69, 92, 69, 148, 88, 89, 90, 90, 92, 95, 97, 100,
+	144, 70, 95, 69, 153, 71, 72, 73, 74, 74, 77, 76, 80, 81, 174, 67, 132, 86, 87, 88,
+	85, 82, 82, 81, 80, 58, 88, 87, 70, 96, 134, 91, 92, 88, 85, 82, 82, 81, 59, 89,
+	88, 71, 97, 100, 136, 96, 92, 89, 86, 82, 82, 60, 90, 89, 72, 98, 101, 105, 137, 95,
+	92, 89, 86, 82, 62, 91, 90, 74, 95, 98, 101, 105, 138, 95, 93, 89, 85, 62, 91, 90,
+	69, 92, 95, 98, 102, 104, 139, 95, 92, 88, 65, 90, 90, 70, 92, 92, 96, 99, 102, 105,
+	141, 95, 91, 68, 92, 89, 70, 91, 92, 93, 96, 99, 101, 104, 141, 93, 68, 95, 91, 69,
+	90, 91, 92, 92, 95, 97, 100, 102, 145, 73, 98, 95, 69, 69, 70, 72, 73, 73, 76, 79,
+	79, 83, 177, 70, 65, 161, 68, 69, 70, 67, 63, 64, 63, 62, 62, 121, 181, 182, 78, 167,
+	104, 105, 103, 101, 98, 98, 98, 97, 128, 154, 156, 79, 111, 168, 108, 106, 104, 101, 98, 99,
+	98, 129, 154, 156, 80, 112, 115, 170, 109, 107, 104, 102, 99, 99, 136, 155, 157, 77, 110, 113,
+	116, 171, 110, 107, 105, 102, 99, 144, 154, 154, 74, 108, 111, 114, 117, 172, 110, 108, 105, 102,
+	153, 154, 154, 75, 105, 108, 111, 114, 116, 173, 110, 108, 105, 162, 153, 154, 74, 105, 106, 109,
+	112, 115, 117, 175, 110, 107, 169, 156, 154, 73, 105, 106, 106, 109, 112, 114, 117, 177, 111, 175,
+	160, 158, 72, 104, 105, 106, 106, 109, 111, 114, 118, 177, 178, 160, 158, 130, 66, 92, 93, 90,
+	87, 89, 88, 88, 87, 113, 144, 147, 76, 162, 72, 74, 70, 67, 64, 64, 63, 62, 121, 181,
+	182, 99, 82, 168, 107, 104, 102, 101, 97, 98, 97, 128, 154, 156, 100, 83, 113, 169, 107, 105,
+	104, 101, 98, 98, 135, 154, 156, 97, 80, 111, 114, 170, 108, 107, 104, 101, 98, 144, 154, 153,
+	95, 77, 109, 112, 115, 171, 110, 107, 104, 101, 152, 153, 153, 96, 75, 108, 111, 114, 116, 173,
+	110, 108, 105, 162, 153, 154, 96, 74, 105, 108, 111, 114, 117, 174, 110, 107, 168, 155, 153, 95,
+	74, 105, 105, 108, 111, 114, 117, 176, 111, 174, 159, 157, 95, 73, 104, 105, 105, 108, 111, 114,
+	117, 176, 177, 159, 157, 120, 129, 83, 66, 92, 89, 86, 88, 88, 88, 87, 112, 143, 146, 91,
+	132, 70, 95, 92, 89, 88, 89, 88, 87, 113, 144, 147, 77, 80, 163, 77, 74, 70, 67, 64,
+	63, 62, 121, 180, 182, 99, 102, 86, 169, 106, 104, 102, 101, 97, 97, 135, 154, 156, 97, 100,
+	84, 113, 170, 107, 105, 104, 100, 97, 143, 153, 153, 94, 97, 80, 110, 113, 170, 107, 107, 103,
+	100, 152, 152, 153, 96, 95, 78, 109, 112, 114, 172, 110, 107, 104, 161, 152, 153, 96, 96, 74,
+	108, 111, 114, 117, 174, 110, 107, 168, 155, 153, 95, 95, 74, 104, 107, 110, 113, 117, 175, 111,
+	173, 158, 156, 94, 95, 73, 104, 104, 107, 110, 114, 117, 175, 176, 158, 156, 119, 120, 128, 83,
+	83, 67, 88, 85, 87, 87, 88, 87, 106, 142, 145, 90, 131, 87, 71, 92, 89, 87, 88, 88,
+	87, 106, 143, 146, 91, 94, 133, 75, 95, 92, 90, 87, 88, 87, 107, 144, 147, 77, 81, 85,
+	164, 77, 73, 71, 67, 63, 63, 121, 180, 181, 96, 99, 102, 87, 169, 105, 104, 102, 100, 96,
+	143, 153, 153, 93, 96, 99, 83, 112, 169, 106, 105, 103, 99, 151, 152, 152, 95, 94, 97, 81,
+	111, 113, 171, 108, 107, 103, 160, 152, 152, 95, 95, 95, 77, 109, 112, 115, 173, 110, 106, 167,
+	154, 152, 95, 95, 96, 74, 107, 110, 113, 117, 175, 111, 173, 158, 156, 94, 94, 95, 74, 103,
+	106, 110, 113, 117, 174, 175, 157, 155, 113, 114, 114, 127, 83, 83, 84, 63, 85, 87, 87, 87,
+	87, 97, 141, 141, 91, 130, 87, 88, 67, 89, 87, 88, 88, 88, 98, 142, 143, 91, 95, 132,
+	91, 71, 92, 90, 87, 88, 88, 98, 143, 143, 91, 95, 98, 135, 75, 95, 93, 90, 88, 88,
+	99, 144, 144, 73, 77, 81, 85, 166, 76, 73, 70, 66, 62, 121, 180, 181, 93, 96, 99, 102,
+	86, 170, 105, 103, 101, 99, 152, 153, 152, 95, 94, 97, 100, 83, 112, 172, 107, 105, 103, 161,
+	152, 152, 95, 95, 95, 98, 80, 110, 114, 173, 108, 106, 168, 154, 152, 95, 95, 96, 95, 77,
+	108, 112, 115, 175, 111, 173, 158, 155, 95, 95, 96, 96, 73, 106, 110, 113, 117, 175, 176, 158,
+	155, 106, 106, 106, 107, 127, 82, 84, 84, 81, 59, 87, 87, 87, 87, 88, 141, 142, 90, 130,
+	87, 88, 84, 64, 87, 88, 88, 88, 89, 142, 143, 91, 95, 132, 92, 88, 68, 91, 88, 89,
+	89, 90, 143, 144, 92, 95, 99, 134, 92, 72, 94, 91, 88, 89, 90, 144, 145, 88, 92, 95,
+	99, 136, 75, 96, 93, 91, 88, 90, 145, 145, 70, 74, 78, 82, 85, 167, 76, 73, 70, 66,
+	121, 181, 181, 95, 95, 98, 101, 103, 86, 173, 106, 104, 101, 162, 154, 154, 95, 96, 96, 98,
+	101, 83, 113, 174, 108, 105, 168, 156, 153, 95, 96, 96, 96, 98, 80, 111, 114, 175, 109, 173,
+	159, 156, 95, 96, 96, 96, 95, 76, 108, 112, 116, 175, 176, 158, 155, 97, 98, 99, 99, 99,
+	125, 82, 83, 84, 80, 77, 60, 85, 85, 85, 79, 139, 140, 90, 127, 86, 87, 84, 80, 60,
+	85, 85, 85, 79, 139, 140, 91, 93, 129, 91, 87, 84, 64, 86, 87, 86, 81, 140, 141, 91,
+	95, 98, 131, 91, 88, 68, 89, 86, 87, 81, 141, 142, 88, 91, 95, 98, 133, 90, 71, 91,
+	88, 85, 80, 142, 142, 85, 88, 92, 95, 98, 134, 71, 93, 91, 88, 80, 142, 142, 71, 71,
+	75, 79, 81, 81, 165, 73, 70, 66, 121, 177, 178, 93, 93, 93, 96, 98, 101, 83, 173, 104,
+	102, 168, 154, 151, 93, 93, 94, 94, 96, 98, 80, 111, 174, 106, 173, 157, 154, 93, 93, 94,
+	94, 93, 95, 76, 109, 113, 174, 176, 156, 153, 89, 89, 90, 91, 90, 89, 123, 82, 82, 83,
+	80, 77, 76, 59, 82, 82, 72, 137, 138, 90, 125, 85, 87, 83, 80, 76, 60, 83, 83, 73,
+	137, 138, 90, 93, 126, 89, 86, 83, 80, 61, 84, 83, 73, 137, 138, 91, 94, 97, 128, 90,
+	87, 83, 65, 84, 85, 74, 138, 139, 87, 91, 94, 97, 130, 90, 86, 68, 86, 83, 74, 139,
+	138, 84, 88, 91, 94, 97, 131, 88, 67, 88, 85, 73, 138, 138, 84, 84, 87, 91, 93, 95,
+	134, 71, 91, 88, 74, 140, 140, 70, 71, 71, 75, 78, 77, 81, 163, 70, 66, 121, 177, 175,
+	90, 91, 91, 92, 94, 96, 98, 80, 173, 103, 173, 155, 152, 90, 91, 91, 92, 91, 93, 95,
+	76, 110, 173, 175, 154, 151, 82, 83, 83, 84, 84, 83, 84, 120, 81, 82, 82, 79, 76, 76,
+	74, 58, 79, 66, 133, 134, 88, 122, 85, 85, 82, 79, 76, 75, 59, 80, 67, 133, 134, 89,
+	92, 123, 88, 86, 83, 79, 75, 61, 81, 68, 133, 135, 89, 93, 96, 124, 88, 85, 82, 78,
+	61, 81, 68, 133, 135, 87, 90, 93, 95, 126, 88, 85, 81, 64, 80, 69, 134, 134, 84, 87,
+	90, 92, 95, 127, 87, 83, 63, 82, 68, 134, 134, 83, 84, 87, 90, 92, 94, 130, 86, 67,
+	85, 68, 136, 136, 82, 83, 83, 86, 89, 91, 93, 133, 68, 87, 69, 139, 137, 69, 70, 71,
+	72, 75, 74, 78, 79, 160, 66, 121, 178, 175, 86, 87, 88, 88, 88, 90, 92, 94, 76, 171,
+	175, 151, 148, 76, 77, 78, 79, 79, 78, 79, 79, 121, 81, 82, 83, 79, 76, 76, 75, 72,
+	58, 63, 134, 135, 89, 123, 85, 86, 82, 79, 76, 76, 73, 59, 64, 134, 135, 89, 93, 124,
+	90, 86, 82, 80, 76, 74, 60, 65, 134, 135, 90, 94, 97, 125, 89, 86, 83, 79, 74, 61,
+	66, 134, 136, 87, 90, 93, 96, 126, 85, 85, 81, 77, 61, 66, 134, 134, 84, 87, 90, 93,
+	92, 127, 86, 83, 79, 60, 65, 134, 134, 84, 84, 87, 91, 92, 94, 130, 86, 81, 64, 66,
+	136, 136, 82, 83, 83, 87, 89, 91, 93, 132, 83, 65, 66, 139, 137, 80, 81, 82, 82, 84,
+	86, 89, 91, 135, 66, 67, 143, 141, 69, 70, 71, 72, 72, 71, 75, 75, 76, 161, 121, 178,
+	175, 74, 75, 76, 77, 76, 75, 76, 77, 77, 46, 36, 38, 39, 34, 30, 31, 31, 30, 29,
+	14, 69, 73, 47, 47, 42, 43, 39, 34, 31, 32, 31, 30, 16, 70, 74, 48, 52, 49, 48,
+	43, 39, 36, 32, 32, 31, 17, 71, 75, 49, 53, 57, 50, 48, 43, 40, 36, 32, 32, 18,
+	72, 76, 45, 49, 53, 57, 50, 46, 43, 39, 35, 31, 18, 72, 72, 41, 45, 49, 53, 56,
+	49, 46, 43, 39, 34, 17, 71, 72, 42, 42, 46, 50, 53, 55, 49, 44, 40, 35, 20, 71,
+	73, 41, 42, 42, 47, 50, 53, 54, 48, 40, 36, 24, 72, 72, 41, 42, 43, 43, 46, 49,
+	50, 50, 47, 36, 29, 74, 73, 40, 41, 42, 43, 42, 45, 46, 46, 47, 46, 28, 73, 72,
+	28, 29, 30, 31, 31, 30, 34, 37, 41, 40, 130, 86, 87, 88, 85, 81, 82, 81, 79, 78,
+	59, 64, 147, 96, 132, 91, 92, 88, 85, 82, 82, 80, 79, 60, 65, 148, 97, 100, 134, 95,
+	92, 89, 85, 82, 81, 80, 61, 66, 148, 98, 101, 104, 135, 96, 92, 89, 86, 81, 81, 63,
+	67, 148, 95, 98, 101, 105, 136, 95, 91, 88, 84, 80, 63, 68, 147, 92, 95, 98, 102, 104,
+	137, 91, 90, 86, 83, 62, 67, 147, 92, 92, 95, 98, 101, 100, 137, 92, 88, 85, 61, 66,
+	147, 91, 92, 92, 96, 98, 100, 101, 141, 91, 87, 66, 67, 148, 89, 90, 91, 91, 93, 96,
+	98, 100, 144, 90, 67, 67, 153, 88, 89, 90, 91, 90, 93, 95, 97, 100, 144, 66, 66, 152,
+	70, 71, 73, 74, 74, 73, 73, 77, 78, 77, 175, 133, 87, 88, 89, 86, 82, 83, 82, 80,
+	79, 57, 88, 67, 96, 135, 91, 92, 89, 85, 83, 83, 81, 81, 58, 89, 69, 97, 101, 137,
+	96, 93, 89, 87, 83, 82, 82, 60, 90, 70, 98, 102, 105, 138, 97, 92, 90, 87, 83, 83,
+	61, 91, 71, 96, 99, 102, 106, 139, 96, 94, 90, 86, 83, 62, 92, 68, 92, 95, 98, 102,
+	105, 139, 95, 92, 88, 85, 62, 90, 68, 93, 93, 96, 100, 103, 104, 141, 95, 91, 88, 65,
+	90, 68, 92, 93, 93, 97, 100, 101, 104, 141, 94, 90, 64, 92, 67, 91, 91, 92, 93, 96,
+	98, 101, 103, 145, 93, 70, 96, 67, 90, 91, 92, 93, 93, 95, 97, 100, 103, 145, 69, 95,
+	67, 69, 70, 71, 72, 74, 73, 76, 75, 80, 79, 178, 65, 161, 67, 68, 69, 66, 63, 63,
+	63, 62, 61, 60, 121, 183, 77, 167, 104, 105, 102, 101, 97, 99, 98, 97, 97, 128, 157, 78,
+	111, 169, 108, 106, 105, 101, 99, 99, 98, 97, 129, 157, 79, 112, 115, 171, 109, 108, 104, 102,
+	99, 99, 98, 136, 157, 76, 109, 113, 116, 171, 111, 107, 105, 102, 99, 99, 144, 154, 74, 109,
+	112, 115, 118, 173, 110, 108, 105, 102, 99, 154, 155, 73, 105, 108, 111, 114, 117, 173, 109, 108,
+	105, 101, 161, 154, 73, 106, 106, 109, 112, 115, 116, 175, 110, 107, 104, 169, 154, 73, 105, 106,
+	106, 109, 112, 114, 117, 176, 111, 108, 175, 158, 72, 105, 106, 106, 106, 109, 112, 114, 118, 177,
+	107, 178, 158, 71, 104, 105, 106, 106, 107, 109, 111, 115, 114, 177, 180, 158, 130, 65, 92, 93,
+	90, 88, 89, 89, 88, 87, 87, 113, 147, 75, 163, 71, 72, 69, 66, 63, 63, 63, 62, 61,
+	121, 183, 99, 81, 169, 107, 104, 103, 101, 98, 98, 97, 97, 128, 157, 100, 82, 113, 170, 107,
+	106, 104, 101, 98, 98, 98, 135, 157, 97, 79, 111, 114, 171, 109, 107, 104, 101, 98, 98, 144,
+	154, 95, 77, 110, 113, 116, 171, 110, 107, 104, 101, 98, 152, 154, 96, 73, 108, 111, 114, 117,
+	173, 109, 108, 105, 101, 160, 154, 96, 74, 105, 108, 111, 114, 116, 174, 110, 107, 104, 168, 153,
+	96, 73, 105, 106, 108, 111, 114, 117, 176, 111, 108, 174, 157, 95, 72, 105, 106, 106, 108, 112,
+	114, 118, 176, 107, 177, 157, 94, 72, 104, 105, 106, 106, 109, 111, 115, 114, 176, 179, 157, 120,
+	130, 83, 65, 92, 89, 87, 88, 89, 88, 87, 86, 112, 147, 90, 132, 69, 95, 92, 90, 87,
+	89, 88, 88, 87, 113, 148, 75, 79, 164, 76, 72, 70, 66, 63, 63, 62, 61, 121, 183, 99,
+	102, 85, 170, 106, 104, 102, 101, 97, 97, 97, 135, 157, 97, 100, 82, 113, 170, 107, 105, 104,
+	101, 97, 97, 143, 154, 95, 98, 80, 111, 114, 171, 108, 107, 104, 100, 97, 152, 154, 95, 95,
+	76, 109, 112, 115, 171, 109, 107, 104, 100, 159, 153, 96, 97, 74, 108, 111, 114, 116, 174, 110,
+	107, 104, 167, 153, 96, 96, 74, 105, 108, 111, 113, 117, 175, 111, 108, 173, 156, 95, 95, 73,
+	105, 105, 108, 111, 114, 117, 175, 107, 176, 156, 94, 94, 72, 104, 105, 105, 108, 111, 114, 114,
+	175, 178, 156, 119, 120, 129, 83, 83, 65, 88, 86, 87, 88, 88, 87, 86, 106, 146, 90, 131,
+	87, 70, 91, 89, 86, 88, 88, 87, 87, 106, 147, 91, 94, 134, 74, 95, 92, 90, 88, 89,
+	88, 87, 107, 148, 76, 80, 83, 165, 76, 73, 69, 66, 63, 62, 62, 121, 182, 96, 99, 102,
+	85, 170, 106, 103, 102, 101, 97, 97, 143, 153, 94, 97, 100, 83, 113, 170, 106, 105, 104, 100,
+	96, 152, 153, 94, 94, 97, 79, 110, 113, 171, 107, 107, 103, 100, 159, 153, 95, 96, 95, 77,
+	109, 112, 114, 172, 110, 106, 103, 166, 152, 96, 96, 96, 74, 108, 111, 113, 117, 175, 111, 108,
+	172, 156, 95, 95, 95, 73, 104, 107, 110, 113, 117, 174, 107, 175, 155, 94, 94, 94, 72, 104,
+	104, 107, 110, 114, 113, 174, 177, 155, 113, 114, 114, 128, 83, 83, 84, 61, 86, 87, 88, 88,
+	88, 87, 97, 142, 90, 130, 87, 87, 66, 89, 86, 88, 88, 88, 87, 98, 143, 91, 94, 133,
+	91, 70, 93, 90, 88, 89, 89, 88, 98, 144, 91, 95, 98, 135, 74, 96, 93, 91, 88, 89,
+	88, 99, 145, 72, 76, 80, 84, 166, 76, 72, 69, 66, 62, 61, 121, 181, 94, 97, 100, 103,
+	85, 171, 105, 104, 102, 100, 96, 152, 153, 94, 94, 97, 100, 82, 112, 171, 106, 105, 103, 99,
+	160, 152, 95, 96, 95, 98, 79, 111, 113, 173, 108, 106, 102, 167, 152, 95, 96, 96, 96, 76,
+	109, 112, 115, 174, 111, 107, 172, 155, 95, 96, 96, 96, 73, 107, 110, 113, 117, 175, 107, 175,
+	155, 94, 95, 95, 95, 72, 103, 106, 109, 114, 114, 174, 177, 154, 106, 106, 106, 107, 127, 82,
+	83, 84, 80, 59, 86, 87, 87, 87, 87, 87, 142, 90, 129, 87, 88, 84, 63, 86, 88, 88,
+	88, 88, 89, 143, 91, 95, 132, 91, 88, 67, 90, 88, 89, 89, 88, 89, 144, 92, 95, 99,
+	134, 91, 71, 93, 91, 88, 89, 89, 90, 145, 88, 91, 95, 98, 136, 74, 95, 93, 90, 87,
+	88, 89, 145, 70, 73, 77, 81, 84, 167, 75, 72, 69, 65, 61, 121, 182, 94, 94, 97, 100,
+	102, 85, 172, 105, 103, 101, 99, 160, 153, 94, 96, 95, 98, 100, 82, 112, 173, 107, 104, 102,
+	167, 153, 95, 96, 96, 96, 98, 79, 110, 114, 175, 109, 107, 173, 156, 94, 96, 96, 96, 95,
+	75, 108, 111, 116, 174, 107, 175, 155, 94, 96, 96, 96, 96, 72, 106, 110, 114, 114, 175, 177,
+	155, 97, 98, 98, 98, 98, 128, 83, 84, 85, 81, 78, 59, 88, 88, 88, 88, 80, 143, 91,
+	129, 87, 88, 84, 81, 59, 88, 88, 88, 88, 81, 143, 92, 94, 132, 92, 88, 85, 64, 88,
+	89, 89, 89, 82, 144, 92, 95, 99, 134, 92, 89, 68, 92, 89, 90, 89, 82, 145, 89, 92,
+	95, 99, 136, 92, 71, 94, 91, 88, 89, 82, 145, 86, 89, 93, 96, 99, 138, 74, 96, 93,
+	90, 87, 81, 146, 70, 70, 74, 78, 81, 84, 169, 75, 72, 68, 64, 121, 182, 95, 96, 96,
+	99, 101, 103, 84, 174, 106, 104, 101, 168, 154, 96, 96, 97, 96, 98, 101, 82, 113, 176, 108,
+	106, 174, 157, 95, 95, 97, 97, 96, 98, 79, 111, 115, 175, 105, 176, 156, 95, 95, 96, 97,
+	96, 95, 75, 108, 112, 112, 175, 178, 155, 90, 90, 91, 92, 91, 91, 126, 83, 83, 84, 81,
+	78, 78, 58, 85, 85, 85, 72, 141, 90, 127, 86, 88, 84, 81, 78, 60, 86, 86, 86, 74,
+	141, 91, 94, 129, 90, 87, 84, 81, 60, 86, 86, 86, 74, 141, 92, 95, 97, 131, 91, 88,
+	85, 64, 87, 87, 87, 75, 142, 88, 92, 95, 98, 133, 91, 88, 67, 89, 86, 87, 75, 142,
+	86, 89, 92, 95, 98, 135, 90, 70, 91, 88, 85, 74, 143, 86, 86, 89, 92, 95, 98, 135,
+	70, 93, 90, 87, 73, 142, 69, 71, 71, 75, 78, 80, 80, 167, 72, 68, 64, 121, 179, 93,
+	94, 94, 94, 96, 98, 101, 82, 175, 105, 102, 173, 155, 93, 94, 94, 95, 93, 96, 98, 78,
+	112, 174, 102, 176, 154, 92, 93, 93, 95, 94, 93, 95, 75, 109, 109, 174, 177, 153, 83, 84,
+	84, 85, 85, 84, 83, 123, 82, 82, 83, 80, 77, 77, 76, 58, 81, 81, 66, 137, 89, 124,
+	86, 86, 83, 80, 77, 77, 59, 82, 82, 67, 137, 90, 93, 126, 89, 87, 84, 81, 77, 60,
+	83, 83, 69, 138, 90, 93, 97, 127, 89, 87, 84, 80, 60, 83, 83, 69, 138, 88, 91, 94,
+	96, 129, 90, 87, 83, 64, 83, 83, 69, 137, 85, 88, 91, 94, 97, 131, 89, 86, 67, 85,
+	82, 69, 138, 85, 85, 88, 91, 94, 97, 131, 87, 66, 87, 84, 68, 138, 84, 85, 85, 88,
+	91, 93, 95, 134, 70, 90, 87, 68, 139, 69, 70, 71, 71, 74, 77, 76, 80, 164, 68, 65,
+	121, 179, 89, 90, 91, 91, 90, 93, 95, 97, 78, 173, 98, 175, 151, 89, 90, 91, 91, 91,
+	90, 92, 94, 75, 105, 172, 177, 150, 77, 78, 79, 79, 79, 79, 78, 79, 123, 82, 83, 84,
+	80, 78, 78, 77, 74, 57, 81, 63, 138, 89, 125, 86, 87, 83, 81, 78, 78, 75, 58, 82,
+	64, 138, 90, 94, 127, 90, 86, 84, 81, 78, 76, 60, 83, 66, 138, 91, 94, 98, 128, 90,
+	88, 85, 81, 76, 61, 84, 67, 139, 88, 91, 94, 97, 129, 89, 86, 83, 79, 60, 83, 66,
+	137, 86, 89, 92, 95, 97, 131, 89, 86, 82, 63, 83, 66, 138, 86, 86, 89, 92, 94, 96,
+	131, 88, 84, 63, 85, 66, 138, 85, 86, 86, 89, 91, 94, 95, 134, 86, 67, 88, 66, 139,
+	82, 83, 84, 84, 86, 89, 91, 94, 137, 68, 91, 66, 144, 68, 69, 71, 72, 71, 74, 73,
+	77, 78, 164, 64, 121, 179, 89, 90, 91, 92, 91, 91, 93, 95, 98, 75, 173, 178, 151, 74,
+	75, 76, 77, 76, 77, 76, 76, 77, 124, 82, 83, 84, 81, 78, 78, 77, 75, 74, 57, 61,
+	139, 90, 126, 86, 87, 84, 81, 78, 78, 76, 75, 58, 62, 139, 91, 94, 127, 91, 88, 84,
+	81, 78, 77, 76, 59, 63, 139, 91, 95, 98, 129, 91, 88, 85, 82, 77, 77, 61, 64, 140,
+	88, 92, 95, 98, 130, 90, 87, 84, 80, 76, 61, 65, 138, 85, 89, 92, 95, 97, 130, 86,
+	86, 82, 79, 60, 64, 138, 86, 86, 89, 92, 94, 94, 131, 87, 84, 81, 59, 63, 138, 85,
+	86, 86, 89, 92, 93, 95, 134, 87, 84, 63, 64, 140, 83, 84, 85, 85, 87, 90, 92, 94,
+	137, 86, 65, 65, 144, 82, 83, 84, 85, 84, 87, 89, 91, 93, 137, 64, 64, 144, 68, 69,
+	70, 71, 72, 71, 70, 74, 75, 74, 165, 121, 180, 72, 73, 74, 75, 75, 74, 74, 75, 75,
+	74, 46, 36, 38, 39, 34, 31, 31, 31, 31, 30, 28, 14, 73, 47, 48, 42, 43, 39, 35,
+	31, 32, 32, 31, 30, 15, 74, 48, 52, 49, 48, 43, 40, 35, 32, 33, 32, 31, 16, 75,
+	49, 53, 57, 50, 48, 44, 40, 37, 33, 33, 32, 17, 76, 45, 49, 53, 57, 50, 48, 43,
+	40, 36, 32, 32, 17, 72, 42, 46, 50, 54, 57, 50, 46, 43, 40, 35, 31, 17, 73, 42,
+	42, 46, 50, 53, 56, 49, 46, 43, 38, 34, 16, 72, 42, 43, 43, 47, 50, 53, 55, 49,
+	44, 39, 35, 20, 72, 41, 42, 43, 43, 47, 50, 53, 54, 48, 40, 36, 24, 74, 40, 41,
+	42, 43, 42, 46, 49, 50, 50, 47, 35, 23, 73, 39, 40, 41, 42, 42, 41, 44, 45, 46,
+	45, 46, 22, 72, 28, 29, 30, 31, 31, 31, 30, 33, 37, 36, 35, 134, 87, 88, 89, 86,
+	83, 83, 82, 81, 80, 79, 57, 66, 97, 136, 91, 92, 90, 86, 83, 83, 82, 81, 80, 58,
+	67, 98, 101, 138, 96, 93, 90, 87, 83, 83, 82, 81, 59, 69, 98, 102, 105, 139, 97, 93,
+	90, 87, 83, 83, 82, 61, 70, 96, 99, 103, 106, 140, 97, 94, 90, 87, 83, 83, 62, 67,
+	93, 96, 99, 103, 106, 140, 96, 92, 89, 86, 82, 62, 67, 93, 93, 96, 100, 103, 105, 141,
+	92, 92, 88, 85, 61, 66, 92, 93, 93, 96, 100, 102, 101, 141, 94, 91, 87, 61, 66, 91,
+	92, 93, 93, 97, 99, 101, 103, 145, 94, 91, 66, 67, 91, 91, 92, 93, 93, 96, 98, 100,
+	103, 145, 90, 65, 66, 90, 91, 92, 92, 93, 92, 95, 97, 100, 99, 145, 64, 65, 68, 70,
+	71, 72, 73, 73, 73, 72, 77, 76, 75, 178, 158, 62, 63, 64, 65, 61, 61, 61, 61, 60,
+	59, 58, 121, 72, 167, 101, 102, 101, 98, 95, 95, 96, 95, 94, 93, 128, 73, 108, 168, 105,
+	104, 102, 98, 95, 97, 96, 95, 94, 129, 74, 109, 112, 170, 107, 105, 102, 99, 97, 97, 96,
+	95, 136, 75, 108, 111, 114, 170, 111, 107, 104, 102, 99, 99, 98, 141, 72, 106, 109, 112, 118,
+	170, 110, 107, 105, 102, 98, 98, 150, 72, 103, 106, 109, 114, 116, 170, 109, 107, 104, 101, 98,
+	158, 71, 103, 103, 106, 111, 113, 115, 171, 109, 106, 103, 100, 164, 72, 103, 104, 104, 109, 112,
+	114, 116, 173, 110, 107, 104, 171, 71, 102, 103, 104, 106, 109, 111, 113, 116, 173, 106, 103, 174,
+	70, 102, 102, 103, 106, 106, 108, 110, 114, 113, 173, 102, 177, 69, 101, 102, 103, 106, 106, 105,
+	107, 111, 110, 109, 173, 178, 129, 59, 89, 90, 88, 85, 87, 86, 86, 86, 85, 84, 113, 70,
+	160, 66, 67, 68, 64, 61, 61, 61, 60, 59, 59, 121, 96, 77, 168, 104, 102, 100, 98, 95,
+	96, 95, 94, 93, 128, 97, 77, 111, 170, 105, 103, 102, 98, 96, 96, 95, 94, 135, 95, 78,
+	109, 112, 168, 108, 107, 103, 101, 98, 98, 97, 140, 93, 75, 107, 110, 115, 169, 110, 106, 104,
+	101, 97, 97, 149, 94, 72, 106, 109, 114, 116, 170, 109, 107, 104, 101, 98, 158, 94, 72, 102,
+	105, 110, 112, 115, 170, 109, 106, 103, 100, 163, 94, 72, 103, 103, 108, 111, 114, 116, 172, 110,
+	106, 103, 170, 93, 71, 102, 103, 105, 108, 111, 113, 116, 172, 106, 103, 173, 92, 70, 102, 102,
+	105, 105, 108, 110, 113, 113, 172, 102, 176, 92, 70, 101, 102, 105, 105, 105, 107, 110, 110, 109,
+	172, 177, 121, 128, 79, 60, 89, 87, 84, 86, 86, 86, 85, 84, 84, 113, 87, 131, 64, 92,
+	90, 88, 86, 86, 86, 86, 85, 84, 113, 71, 74, 161, 71, 71, 68, 65, 61, 62, 61, 60,
+	59, 121, 96, 99, 81, 169, 103, 101, 100, 98, 95, 95, 94, 93, 135, 94, 97, 81, 110, 168,
+	107, 105, 103, 100, 97, 97, 97, 140, 92, 95, 78, 108, 113, 168, 107, 106, 103, 100, 97, 97,
+	149, 94, 93, 75, 107, 112, 114, 169, 109, 106, 103, 100, 97, 157, 94, 94, 72, 105, 110, 112,
+	115, 170, 109, 106, 103, 100, 163, 94, 94, 72, 102, 108, 110, 113, 116, 171, 109, 106, 103, 169,
+	93, 93, 72, 102, 105, 107, 110, 113, 116, 171, 105, 102, 172, 92, 92, 71, 102, 105, 104, 107,
+	110, 113, 112, 171, 102, 174, 91, 92, 70, 101, 104, 104, 104, 107, 110, 109, 109, 171, 176, 120,
+	120, 127, 79, 79, 60, 86, 84, 85, 85, 86, 85, 84, 83, 106, 87, 130, 83, 64, 89, 87,
+	85, 85, 86, 85, 85, 84, 106, 87, 91, 133, 69, 92, 90, 88, 85, 87, 86, 85, 84, 107,
+	71, 75, 79, 162, 74, 71, 68, 64, 62, 61, 60, 59, 121, 93, 96, 99, 84, 167, 105, 104,
+	101, 100, 96, 96, 96, 139, 91, 94, 97, 81, 112, 168, 106, 103, 103, 99, 96, 96, 149, 93,
+	92, 95, 78, 110, 113, 168, 106, 106, 102, 99, 96, 156, 93, 93, 93, 75, 108, 110, 113, 168,
+	109, 105, 102, 99, 162, 94, 94, 94, 72, 108, 110, 113, 116, 171, 109, 106, 103, 169, 93, 93,
+	93, 72, 104, 106, 109, 112, 116, 170, 105, 102, 171, 92, 92, 93, 71, 104, 103, 106, 109, 113,
+	112, 170, 101, 173, 91, 91, 92, 70, 103, 103, 103, 106, 110, 109, 108, 170, 175, 114, 114, 115,
+	129, 83, 84, 84, 60, 86, 87, 87, 88, 88, 87, 86, 100, 91, 132, 87, 88, 64, 89, 87,
+	88, 89, 89, 88, 87, 101, 91, 95, 134, 91, 68, 92, 90, 87, 89, 89, 88, 87, 102, 91,
+	95, 98, 137, 73, 96, 93, 90, 89, 89, 88, 87, 102, 71, 75, 79, 82, 167, 75, 72, 68,
+	65, 62, 61, 60, 121, 94, 97, 100, 103, 84, 172, 106, 103, 102, 100, 96, 96, 152, 95, 95,
+	98, 101, 82, 113, 172, 106, 105, 103, 99, 96, 160, 95, 95, 95, 98, 78, 110, 113, 172, 108,
+	106, 102, 99, 166, 96, 96, 97, 96, 76, 109, 112, 115, 174, 111, 107, 104, 172, 96, 96, 97,
+	97, 72, 107, 110, 113, 118, 175, 107, 104, 175, 95, 95, 96, 96, 72, 104, 106, 109, 114, 114,
+	174, 103, 176, 94, 94, 95, 95, 71, 104, 104, 106, 111, 111, 110, 174, 178, 108, 109, 110, 110,
+	127, 82, 83, 83, 80, 56, 86, 86, 87, 87, 87, 85, 91, 89, 130, 87, 87, 84, 61, 86,
+	87, 88, 88, 88, 87, 92, 90, 94, 133, 91, 88, 65, 90, 87, 89, 88, 88, 87, 92, 91,
+	95, 98, 135, 91, 69, 93, 90, 88, 89, 89, 87, 93, 88, 91, 95, 98, 137, 73, 96, 93,
+	91, 88, 89, 88, 89, 67, 71, 75, 79, 83, 167, 74, 71, 68, 64, 61, 60, 121, 94, 94,
+	97, 100, 103, 84, 172, 105, 104, 101, 99, 95, 160, 93, 95, 94, 97, 100, 81, 112, 172, 107,
+	104, 102, 98, 166, 94, 96, 96, 95, 98, 78, 111, 113, 173, 109, 107, 103, 172, 94, 95, 96,
+	96, 96, 75, 108, 111, 115, 173, 107, 103, 174, 94, 95, 96, 96, 96, 71, 106, 109, 114, 114,
+	174, 103, 177, 93, 94, 95, 95, 95, 71, 103, 106, 110, 110, 110, 173, 177, 100, 101, 101, 102,
+	98, 127, 82, 83, 84, 81, 77, 57, 86, 87, 87, 87, 87, 83, 90, 129, 86, 87, 84, 80,
+	58, 86, 87, 87, 87, 87, 83, 91, 93, 132, 91, 88, 84, 62, 87, 88, 88, 88, 88, 85,
+	92, 95, 98, 134, 91, 88, 66, 90, 88, 89, 88, 88, 85, 88, 92, 95, 99, 136, 91, 70,
+	93, 91, 88, 89, 88, 81, 85, 88, 92, 95, 98, 137, 73, 95, 93, 90, 87, 88, 81, 68,
+	69, 72, 76, 80, 83, 168, 74, 71, 67, 63, 60, 121, 94, 94, 94, 97, 100, 102, 83, 172,
+	106, 103, 100, 99, 166, 95, 95, 96, 95, 98, 100, 81, 112, 174, 107, 105, 103, 172, 94, 95,
+	96, 96, 95, 97, 78, 110, 114, 174, 105, 103, 175, 94, 94, 96, 96, 96, 95, 74, 108, 112,
+	112, 173, 103, 176, 94, 94, 95, 96, 96, 95, 71, 106, 110, 110, 110, 174, 178, 93, 93, 94,
+	94, 91, 91, 128, 83, 83, 85, 81, 78, 78, 57, 87, 87, 87, 87, 77, 91, 130, 87, 88,
+	85, 81, 78, 58, 88, 88, 88, 87, 78, 91, 94, 131, 90, 88, 85, 82, 58, 88, 88, 88,
+	88, 78, 92, 95, 98, 134, 92, 88, 85, 63, 89, 89, 89, 89, 79, 89, 92, 95, 99, 136,
+	92, 89, 67, 92, 89, 89, 89, 76, 86, 89, 92, 96, 99, 137, 91, 70, 94, 91, 88, 88,
+	75, 86, 86, 89, 93, 96, 99, 138, 73, 96, 93, 90, 87, 75, 68, 69, 69, 73, 77, 80,
+	83, 169, 74, 71, 67, 63, 121, 95, 96, 96, 96, 99, 101, 103, 84, 175, 107, 104, 102, 173,
+	95, 95, 96, 97, 96, 98, 100, 81, 114, 175, 104, 101, 175, 94, 95, 95, 96, 97, 95, 97,
+	77, 111, 111, 174, 101, 177, 94, 95, 95, 96, 97, 96, 94, 74, 109, 109, 108, 174, 178, 87,
+	88, 88, 89, 86, 85, 85, 125, 82, 83, 83, 81, 77, 78, 77, 56, 83, 83, 83, 70, 90,
+	127, 86, 87, 84, 81, 78, 78, 57, 84, 84, 84, 71, 91, 94, 129, 90, 87, 84, 81, 78,
+	59, 85, 85, 85, 72, 91, 94, 97, 130, 90, 87, 84, 81, 59, 85, 85, 85, 73, 88, 92,
+	95, 97, 132, 91, 88, 85, 63, 86, 86, 86, 70, 85, 88, 92, 95, 98, 133, 90, 87, 66,
+	88, 85, 85, 70, 85, 86, 89, 92, 95, 98, 135, 90, 69, 90, 87, 84, 69, 85, 86, 86,
+	89, 92, 95, 97, 135, 68, 92, 89, 86, 68, 67, 68, 70, 70, 74, 76, 79, 79, 166, 71,
+	67, 63, 121, 91, 92, 93, 93, 93, 95, 97, 99, 81, 173, 100, 97, 175, 91, 92, 93, 93,
+	94, 92, 94, 97, 77, 107, 173, 97, 177, 91, 92, 92, 93, 93, 93, 92, 94, 74, 105, 104,
+	172, 177, 80, 81, 83, 83, 80, 80, 79, 79, 126, 82, 83, 84, 81, 78, 78, 78, 76, 56,
+	83, 83, 67, 90, 128, 87, 88, 84, 81, 78, 79, 77, 57, 84, 84, 68, 91, 94, 129, 91,
+	87, 85, 82, 79, 78, 58, 85, 85, 69, 92, 95, 98, 131, 91, 88, 85, 82, 78, 59, 86,
+	86, 70, 88, 92, 95, 98, 131, 90, 88, 85, 81, 60, 86, 86, 66, 86, 89, 92, 95, 98,
+	133, 91, 88, 84, 63, 85, 86, 67, 86, 86, 89, 93, 96, 98, 134, 90, 86, 66, 88, 85,
+	67, 85, 86, 86, 90, 92, 95, 98, 135, 89, 65, 90, 87, 66, 84, 85, 86, 86, 89, 91,
+	94, 96, 138, 70, 93, 90, 66, 67, 68, 69, 70, 71, 73, 76, 76, 80, 167, 66, 63, 121,
+	91, 92, 93, 94, 94, 93, 95, 97, 100, 77, 173, 97, 178, 91, 92, 93, 94, 94, 94, 92,
+	94, 97, 73, 105, 173, 178, 77, 78, 79, 80, 77, 77, 77, 76, 77, 127, 82, 83, 84, 82,
+	78, 79, 78, 77, 76, 55, 83, 64, 90, 129, 87, 88, 85, 81, 79, 79, 78, 77, 57, 84,
+	66, 91, 94, 130, 91, 88, 85, 82, 79, 79, 78, 58, 85, 67, 92, 95, 98, 132, 92, 88,
+	86, 83, 79, 79, 59, 86, 68, 89, 93, 96, 99, 133, 91, 89, 86, 82, 79, 60, 87, 65,
+	86, 89, 92, 95, 98, 132, 90, 87, 84, 81, 59, 86, 65, 87, 87, 90, 93, 96, 98, 134,
+	90, 87, 84, 63, 85, 65, 86, 87, 87, 90, 93, 95, 97, 134, 89, 86, 62, 88, 64, 85,
+	85, 86, 86, 90, 92, 94, 96, 138, 89, 67, 91, 65, 84, 85, 86, 86, 86, 89, 91, 93,
+	96, 138, 66, 90, 64, 66, 68, 69, 70, 71, 70, 73, 73, 77, 77, 168, 62, 121, 91, 92,
+	93, 94, 94, 94, 93, 95, 98, 97, 73, 174, 179, 75, 76, 77, 78, 75, 75, 75, 75, 75,
+	74, 128, 83, 84, 85, 82, 79, 79, 78, 77, 77, 76, 55, 63, 90, 130, 87, 88, 85, 82,
+	79, 79, 78, 78, 77, 56, 64, 91, 94, 131, 91, 89, 86, 82, 79, 79, 79, 78, 57, 65,
+	92, 95, 99, 133, 92, 89, 86, 82, 79, 79, 79, 59, 67, 90, 93, 96, 99, 133, 92, 89,
+	86, 83, 79, 79, 60, 64, 87, 90, 93, 96, 99, 133, 91, 88, 85, 82, 78, 60, 64, 87,
+	87, 90, 93, 96, 98, 134, 87, 87, 84, 81, 59, 63, 86, 87, 87, 90, 93, 95, 95, 134,
+	90, 86, 83, 59, 63, 85, 86, 87, 87, 90, 92, 95, 97, 138, 90, 86, 64, 64, 85, 85,
+	86, 87, 87, 89, 92, 94, 97, 138, 86, 63, 63, 84, 85, 86, 86, 87, 86, 89, 91, 94,
+	93, 138, 62, 63, 66, 67, 68, 70, 71, 71, 70, 70, 74, 74, 73, 168, 121, 74, 75, 76,
+	77, 74, 75, 74, 73, 75, 74, 73, 45, 33, 34, 35, 34, 30, 31, 30, 31, 30, 28, 27,
+	17, 43, 46, 38, 39, 39, 35, 31, 31, 32, 31, 30, 28, 18, 44, 49, 48, 44, 43, 39,
+	36, 31, 33, 32, 31, 30, 20, 45, 50, 54, 49, 48, 44, 40, 36, 33, 33, 32, 31, 21,
+	45, 49, 53, 57, 50, 48, 44, 40, 37, 32, 32, 31, 16, 41, 45, 49, 53, 57, 50, 48,
+	43, 40, 36, 31, 31, 17, 42, 42, 46, 50, 54, 57, 50, 46, 44, 39, 35, 30, 17, 41,
+	42, 42, 46, 50, 53, 56, 49, 47, 42, 38, 33, 16, 41, 42, 43, 43, 47, 50, 54, 57,
+	49, 44, 40, 35, 21, 40, 41, 42, 43, 43, 46, 49, 52, 54, 48, 38, 34, 20, 39, 40,
+	41, 42, 43, 42, 45, 48, 50, 49, 47, 33, 19, 38, 39, 40, 41, 42, 42, 41, 44, 46,
+	45, 44, 46, 17, 31, 32, 33, 34, 30, 31, 31, 29, 34, 33, 32, 31,
+};
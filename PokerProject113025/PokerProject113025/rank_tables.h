@@ -0,0 +1,65 @@
+/*
+ * rank_tables.h
+ *
+ * Flash lookup tables indexed by a 13 bit rank mask (bit 0 = 2 ... bit 12 = Ace).
+ * Contents are generated by tools/gen_tables.cpp into rank_tables.c, which also holds
+ * colexBinom (see colex.h).
+ *
+ * With avr-libc 2.2+ the tables sit in the memory mapped flash window and are read with
+ * plain loads, older toolchains fall back to PROGMEM + LPM.
+ */ 
+
+#ifndef RANK_TABLES_H
+#define RANK_TABLES_H
+
+#include <stdint.h>
+
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#endif
+
+#if defined(__AVR__) && defined(PROGMEM_MAPPED)
+#define RANK_TABLE PROGMEM_MAPPED
+#define rank_table_byte(p) (*(p))
+#define rank_table_word(p) (*(p))
+#define rank_table_dword(p) (*(p))
+#elif defined(__AVR__)
+#define RANK_TABLE PROGMEM
+#define rank_table_byte(p) pgm_read_byte(p)
+#define rank_table_word(p) pgm_read_word(p)
+#define rank_table_dword(p) pgm_read_dword(p)
+#else //Host builds of card.c
+#define RANK_TABLE
+#define rank_table_byte(p) (*(p))
+#define rank_table_word(p) (*(p))
+#define rank_table_dword(p) (*(p))
+#endif
+
+//Every generated table is const data in flash and none is copied to RAM:
+//  RANK_TABLE   rankMaskInfo 16384 B, fiveRankTable 6385 B, colexBinom 1664 B,
+//               percentileStrength 2000 B, preflopEquity 338 B, eval_tables.h (card.c) 216 B
+//  FLASH_TABLE  preflopMatrix 14196 B, flopTexture 3510 B
+//The mapped window is 32 KB and also holds .rodata, so RANK_TABLE is kept for the evaluator's
+//hot tables. Bigger tables read a few times per hand (preflopMatrix, flopTexture) use
+//FLASH_TABLE, plain PROGMEM + LPM on every toolchain. main.c checks the RANK_TABLE total
+//against RANK_TABLE_WINDOW at compile time and tools/eval_report.sh checks the linked image
+#define RANK_TABLE_WINDOW 32768u
+#if defined(__AVR__)
+#define FLASH_TABLE PROGMEM
+#define flash_table_byte(p) pgm_read_byte(p)
+#define flash_table_word(p) pgm_read_word(p)
+#else
+#define FLASH_TABLE
+#define flash_table_byte(p) (*(p))
+#define flash_table_word(p) (*(p))
+#endif
+
+#define RANK_FIVE_NONE 0x07FF //Fewer than 5 ranks, or the top five are a straight
+
+#define RANK_INFO_STRAIGHT(info) ((uint8_t)((info) >> 12)) //Straight high card 5-14, 0 if none
+#define RANK_INFO_FIVE(info) ((info) & 0x07FF) //Class 0..1276 of the top five ranks, weakest first
+
+extern const uint16_t rankMaskInfo[8192] RANK_TABLE;
+extern const uint8_t fiveRankTable[1277][5] RANK_TABLE; //Ranks (14..2) of each five rank class, descending
+
+#endif
@@ -0,0 +1,31 @@
+/*
+ * showdown.h
+ *
+ * Showdown for any number of seats: the board goes into one accumulator once, each seat
+ * only adds its 2 hole cards, and seats come back sorted into groups of equal strength.
+ * A pot (main or side) goes to the first group holding any of the seats that contest it,
+ * split between those seats.
+ */ 
+
+#ifndef SHOWDOWN_H
+#define SHOWDOWN_H
+
+#include <stdint.h>
+#include "card.h"
+
+#define SHOWDOWN_MAX_PLAYERS 10 //Full ring, seat masks fit in 16 bits
+
+typedef struct{
+	uint8_t count; //Seats ranked
+	HandValue hand[SHOWDOWN_MAX_PLAYERS]; //Best hand per seat
+	uint16_t strength[SHOWDOWN_MAX_PLAYERS]; //hand_strength() per seat
+	uint8_t order[SHOWDOWN_MAX_PLAYERS]; //Seats strongest first, ties in seat order
+	uint8_t groups;
+	uint8_t groupStart[SHOWDOWN_MAX_PLAYERS + 1]; //Group g is order[groupStart[g]..groupStart[g + 1] - 1]
+} ShowdownResult;
+
+void showdown_rank(const Card board[5], const Card hole[][2], uint8_t n, ShowdownResult *sr); //Evaluate and group n seats
+void showdown_group(ShowdownResult *sr, uint8_t n); //Sort and group strength[0..n-1] filled by the caller, e.g. Omaha
+uint16_t showdown_pot_winners(const ShowdownResult *sr, uint16_t eligible); //Seat mask that splits a pot contested by the eligible seats
+
+#endif
@@ -0,0 +1,59 @@
+/*
+ * board_cache.c
+ *
+ * Combo index of two remaining positions i < j is j * (j - 1) / 2 + i, which packs
+ * the 1081 holdings densely in the order they are built.
+ */ 
+
+#include "board_cache.h"
+
+void board_cache_build(BoardCache *bc, const Card board[5]){
+	//Board goes into the accumulator once, each holding only adds its 2 cards
+	HandAccumulator boardAcc;
+	hand_acc_init(&boardAcc);
+	for(uint8_t i = 0; i < 52; i++){
+		bc->pos[i] = 0;
+	}
+	for(uint8_t i = 0; i < 5; i++){
+		hand_acc_add(&boardAcc, board[i]);
+		bc->pos[card_index(board[i])] = 0xFF;
+	}
+
+	Card remaining[BOARD_CACHE_CARDS];
+	uint8_t n = 0;
+	for(uint8_t i = 0; i < 52; i++){
+		if(bc->pos[i] != 0xFF){
+			bc->pos[i] = n;
+			remaining[n++] = card_from_index(i);
+		}
+	}
+
+	uint16_t k = 0;
+	for(uint8_t j = 1; j < BOARD_CACHE_CARDS; j++){
+		HandAccumulator withJ = boardAcc;
+		hand_acc_add(&withJ, remaining[j]);
+		for(uint8_t i = 0; i < j; i++){
+			HandAccumulator acc = withJ;
+			hand_acc_add(&acc, remaining[i]);
+			HandValue hv = hand_acc_best(&acc);
+			bc->strength[k++] = hand_strength(&hv);
+		}
+	}
+}
+
+uint16_t board_cache_combo(const BoardCache *bc, Card a, Card b){
+	uint8_t i = bc->pos[card_index(a)];
+	uint8_t j = bc->pos[card_index(b)];
+	if(i == 0xFF || j == 0xFF || i == j){
+		return BOARD_CACHE_COMBOS;
+	}
+	if(i > j){
+		uint8_t t = i; i = j; j = t;
+	}
+	return (uint16_t)(j * (j - 1) / 2 + i);
+}
+
+uint16_t board_cache_lookup(const BoardCache *bc, Card a, Card b){
+	uint16_t k = board_cache_combo(bc, a, b);
+	return (k == BOARD_CACHE_COMBOS) ? 0 : bc->strength[k];
+}
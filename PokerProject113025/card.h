@@ -22,9 +22,47 @@ typedef struct {
 	Suit suit; //Can be SUIT_HEARTS,...etc 
 } Card;
 
+//One byte card, rank << 2 | suit, rank 1-13 (A = 1). Card is 3 bytes on avr-gcc (int sized enum)
+typedef uint8_t PackedCard;
+#define CARD_PACK(rank, suit) ((PackedCard)(((rank) << 2) | (suit)))
+#define PACKED_RANK(p) ((uint8_t)((p) >> 2))
+#define PACKED_SUIT(p) ((Suit)((p) & 3))
+
+//Set of cards, bit p = PackedCard p, so bits 4..55 are used and no conversion is needed
+typedef uint64_t CardSet;
+#define CARD_SET_ALL 0x00FFFFFFFFFFFFF0ull //All 52 cards
+#define card_set_add(s, p) (*(s) |= (CardSet)1 << (p))
+#define card_set_remove(s, p) (*(s) &= ~((CardSet)1 << (p)))
+#define card_set_contains(s, p) ((uint8_t)(((s) >> (p)) & 1))
+
+//Rank helpers shared by the evaluator, draws.c, omaha.c and the preflop/flop tables, Card rank 1 is the Ace
+static inline uint8_t card_rank_value(uint8_t rank){ //2..14
+	return (rank == 1) ? 14 : rank;
+}
+static inline uint8_t card_rank_index(uint8_t rank){ //0 = 2 ... 12 = Ace
+	return (rank == 1) ? 12 : rank - 2;
+}
+#define RANK_BIT(v) ((uint16_t)1 << ((v) - 2)) //Bit of a 2..14 rank value in a 13 bit rank mask, a macro so static tables can use it
+static inline uint16_t card_rank_bit(Card c){ //Bit of the card in a 13 bit rank mask, bit 0 = 2 ... bit 12 = Ace
+	return (uint16_t)1 << card_rank_index(c.rank);
+}
+static inline uint8_t rank_mask_count(uint16_t m){ //Number of ranks set in the mask
+	uint8_t n = 0;
+	while(m){
+		m &= (uint16_t)(m - 1); //Clear lowest bit
+		n++;
+	}
+	return n;
+}
+
+//Build with -DGAME_OMAHA for Omaha: 4 hole cards, exactly 2 of them used at showdown (omaha.c)
 typedef struct {
 	Card card1;
 	Card card2;
+#ifdef GAME_OMAHA
+	Card card3;
+	Card card4;
+#endif
 	uint16_t money; //Total money player has
 	uint16_t currentBet; //how much money they have placed in the pot this round
 	uint8_t isActive; //1 = still in, 0 = folded
@@ -74,20 +112,70 @@ typedef struct{
 	HandRankType type;
 	uint8_t ranks[5]; //For tie breakers
 } HandValue;
+
+typedef struct{
+	uint16_t suitMask[4]; //Rank mask per suit, bit 0 = 2 ... bit 12 = Ace
+	uint8_t count; //Cards added so far
+} HandAccumulator;
 void card_init();
 void card_shuffle(uint16_t seed);
 Card get_card(uint8_t index);
+uint8_t card_index(Card c); //0..51, suit * 13 + rank - 1, same order card_init() builds the deck
+Card card_from_index(uint8_t index);
 void card_toString(Card c, char *buf, uint8_t bufSize);
+PackedCard get_packed(uint8_t index);
+PackedCard card_pack(Card c);
+Card card_unpack(PackedCard p);
+void card_toString_packed(PackedCard p, char *buf, uint8_t bufSize);
+uint8_t card_set_count(CardSet s); //Cards in the set
+CardSet card_set_of(const Card *cards, uint8_t n);
 
 void player_init(Player *p, uint16_t startingMoney);
 Card draw_card();
+PackedCard draw_packed(); //Same deck as draw_card()
+CardSet cards_dealt(void); //Drawn since the last shuffle, CARD_SET_ALL & ~cards_dealt() is what is left
 void deal_player_cards(Game *g);
 void game_init(Game *g);
 void deal_community(Game *g, uint8_t count);
 
+//Evaluator behind evaluate_best_hand(), pick one per board revision with -DEVAL_BACKEND=...
+//hand_acc_best(), which showdown, equity, board_cache and draws use, stays the suit mask evaluator on every backend
+//but EVAL_CONSTANT, so the firmware links it either way. tools/eval_report.sh sizes the whole image per backend
+#define EVAL_COUNTING 0 //Original per-rank counting arrays
+#define EVAL_BITMASK 1 //Suit masks and bit tricks, no tables
+#define EVAL_TABLES 2 //Suit masks plus the flash tables in rank_tables.c, sizes in rank_tables.h
+#define EVAL_TINY 3 //Smallest evaluate_best_hand(), one shared kicker loop for every category
+#define EVAL_CONSTANT 4 //Same instructions for every hand in the evaluator, see evaluate_best_hand_const()
+#ifndef EVAL_BACKEND
+#define EVAL_BACKEND EVAL_TABLES
+#endif
+
 HandValue evaluate_best_hand(Card cards[7]); //Evaluate best 5 card hand from 7 cards
+HandValue evaluate_best_hand_packed(const PackedCard cards[7]); //Same, from packed cards
+
+//Card by card evaluation, e.g. board cards as they are dealt plus a player's hole cards
+void hand_acc_init(HandAccumulator *acc);
+void hand_acc_add(HandAccumulator *acc, Card c); //O(1), one OR into the suit mask
+void hand_acc_add_packed(HandAccumulator *acc, PackedCard p);
+HandValue hand_acc_best(const HandAccumulator *acc); //Best 5 card hand of the 5, 6 or 7 cards added
+uint8_t hand_best_cards(const HandValue *hv, const Card *cards, uint8_t n); //Which of cards[0..n-1] make up hv, bit i = cards[i]. A second pass, only for printing the best five
+HandValue evaluate_best_hand_counting(Card cards[7]); //Original counting array evaluator, same result, used for cross-checks and cycle comparison
+HandValue evaluate_best_hand_tiny(Card cards[7]); //Smallest flash variant, same result
+HandValue evaluate_best_hand_const(Card cards[7]); //Constant time variant, same result
+HandValue hand_masks_best_const(const uint16_t suitMask[4]); //Constant time best hand of 5-7 cards given as suit rank masks
+//Under EVAL_CONSTANT only the category and tie breakers are branch free: evaluate_best_hand(), hand_acc_best() and
+//the two functions above. hand_strength(), hand_best_cards() and the sort in showdown_rank() branch on the hand, so
+//a showdown does not take a fixed time. No cycle bound is claimed until one is measured on the target, the
+//EVAL_BENCH image prints best/worst cycles per category for the evaluator and for a whole showdown_rank()
+const char* eval_backend_name(void); //Name of the compiled in EVAL_BACKEND, for reports
 
 int compare_hands(const HandValue *a, const HandValue *b); //Compare two hands, returns > 0 if a>b, <0 if a<b, 0 if tie
 
+#define HAND_STRENGTH_MAX 7462 //Royal flush, weakest hand (7-5-4-3-2 offsuit) is 1
+
+uint16_t hand_strength(const HandValue *hv); //Collapse a HandValue to 1..7462, larger is always stronger
+uint16_t evaluate_hand_strength(Card cards[7]); //evaluate_best_hand() + hand_strength() in one call
+HandRankType strength_to_type(uint16_t strength); //Category from a strength value, for hand_type_to_string()
+
 const char* hand_type_to_string(HandRankType t); //Get string name for hand type
 #endif
\ No newline at end of file
@@ -0,0 +1,34 @@
+/*
+ * colex.h
+ *
+ * Dense index for any k card subset of the deck (k <= 7) in colex order, and back.
+ * Cards are card_index() values 0..51. Counts are C(52, k): 1326 holdings, 22100 flops,
+ * 2598960 five card sets, 133784560 seven card sets, so a table over k card sets is a
+ * flat array and a walk over every set is a counter loop.
+ *
+ * colexBinom is generated into rank_tables.c by tools/gen_tables.cpp.
+ */ 
+
+#ifndef COLEX_H
+#define COLEX_H
+
+#include <stdint.h>
+#include "card.h"
+#include "rank_tables.h"
+
+#define colex_binom(n, k) rank_table_dword(&colexBinom[n][k])
+
+#define COLEX_MAX_K 7
+
+extern const uint32_t colexBinom[52][COLEX_MAX_K + 1] RANK_TABLE; //C(n, k)
+
+uint32_t colex_count(uint8_t k); //Number of k card sets, C(52, k)
+uint32_t colex_rank(const uint8_t *idx, uint8_t k); //idx ascending, k additions
+void colex_unrank(uint32_t rank, uint8_t k, uint8_t *idx); //Ascending indices of the set with this rank
+uint8_t colex_next(uint8_t *idx, uint8_t k); //Step idx to the set of rank + 1, 0 after the last set
+
+//Card versions, cards in any order; unrank gives them ascending by card_index()
+uint32_t colex_rank_cards(const Card *cards, uint8_t k);
+void colex_unrank_cards(uint32_t rank, uint8_t k, Card *cards);
+
+#endif
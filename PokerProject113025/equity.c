@@ -0,0 +1,166 @@
+/*
+ * equity.c
+ *
+ * The cards left are listed once from a CardSet of the dead cards. Runouts are walked
+ * as k card combinations with one accumulator per player and depth, so each new card
+ * costs one OR per player and only the full boards are evaluated. Stack: 2 x 6
+ * accumulators plus 5 recursion frames.
+ * Monte Carlo runouts are a partial Fisher-Yates over the same list: need swaps, each
+ * picking with a multiply-shift on an xorshift32 value instead of a slow modulo.
+ */ 
+
+#include "equity.h"
+
+typedef struct{
+	PackedCard left[48];
+	uint8_t numLeft;
+	uint8_t need; //Board cards still to come
+	uint8_t part, parts;
+	EquityResult *er;
+} EquityWalk;
+
+static void score(const HandAccumulator *a1, const HandAccumulator *a2, EquityResult *er){
+	HandValue h1 = hand_acc_best(a1);
+	HandValue h2 = hand_acc_best(a2);
+	int c = compare_hands(&h1, &h2);
+	if(c > 0){
+		er->win++;
+	}
+	else if(c < 0){
+		er->loss++;
+	}
+	else{
+		er->tie++;
+	}
+	er->runouts++;
+}
+
+static void walk(const EquityWalk *w, const HandAccumulator *a1, const HandAccumulator *a2, uint8_t depth, uint8_t start){
+	//Card depth of the runout from left[start..], leaving room for the ones after it
+	uint8_t last = w->numLeft - (w->need - depth);
+	for(uint8_t i = start; i <= last; i++){
+		if(depth == 0 && i % w->parts != w->part){
+			continue;
+		}
+		HandAccumulator n1 = *a1, n2 = *a2;
+		hand_acc_add_packed(&n1, w->left[i]);
+		hand_acc_add_packed(&n2, w->left[i]);
+		if(depth + 1 == w->need){
+			score(&n1, &n2, w->er);
+		}
+		else{
+			walk(w, &n1, &n2, depth + 1, i + 1);
+		}
+	}
+}
+
+static uint8_t equity_setup(const Card hole1[2], const Card hole2[2], const Card *board, uint8_t n,
+	HandAccumulator *a1, HandAccumulator *a2, PackedCard left[48]){
+	//Known cards into both accumulators, the rest of the deck into left, returns how many are left
+	hand_acc_init(a1);
+	hand_acc_init(a2);
+	for(uint8_t i = 0; i < n; i++){
+		hand_acc_add(a1, board[i]);
+		hand_acc_add(a2, board[i]);
+	}
+	for(uint8_t i = 0; i < 2; i++){
+		hand_acc_add(a1, hole1[i]);
+		hand_acc_add(a2, hole2[i]);
+	}
+
+	CardSet dead = card_set_of(board, n) | card_set_of(hole1, 2) | card_set_of(hole2, 2);
+	uint8_t numLeft = 0;
+	for(uint8_t rank = 1; rank <= 13; rank++){
+		for(uint8_t suit = 0; suit < 4; suit++){
+			PackedCard p = CARD_PACK(rank, suit);
+			if(!card_set_contains(dead, p)){
+				left[numLeft++] = p;
+			}
+		}
+	}
+	return numLeft;
+}
+
+void equity_exact_part(const Card hole1[2], const Card hole2[2], const Card *board, uint8_t n,
+	uint8_t part, uint8_t parts, EquityResult *er){
+	EquityWalk w;
+	HandAccumulator a1, a2;
+	er->win = er->tie = er->loss = er->runouts = 0;
+	w.need = 5 - n;
+	w.part = part;
+	w.parts = parts;
+	w.er = er;
+	w.numLeft = equity_setup(hole1, hole2, board, n, &a1, &a2, w.left);
+
+	if(w.need == 0){
+		if(part == 0){
+			score(&a1, &a2, er);
+		}
+		return;
+	}
+	walk(&w, &a1, &a2, 0, 0);
+}
+
+void equity_exact(const Card hole1[2], const Card hole2[2], const Card *board, uint8_t n, EquityResult *er){
+	equity_exact_part(hole1, hole2, board, n, 0, 1, er);
+}
+
+void equity_game(const Game *g, EquityResult *er){
+	Card h1[2] = {g->p1.card1, g->p1.card2};
+	Card h2[2] = {g->p2.card1, g->p2.card2};
+	equity_exact(h1, h2, g->community, g->communityCount, er);
+}
+
+uint16_t equity_p1(const EquityResult *er){
+	if(er->runouts == 0){
+		return 0;
+	}
+	//Half runouts won over 2 * runouts, rounded, in 32 bits so no 64 bit division is linked into the AVR image
+	uint32_t win = er->win, tie = er->tie, runouts = er->runouts;
+	while(runouts >= (1ul << 24)){ //Keep 200 * runouts in 32 bits, only very long Monte Carlo runs get here
+		win >>= 1;
+		tie >>= 1;
+		runouts >>= 1;
+	}
+	uint32_t den = 2 * runouts;
+	uint32_t x = (2 * win + tie) * 100; //Split the * 10000 in two so neither step overflows
+	uint32_t hi = x / den, rem = x % den;
+	return (uint16_t)(hi * 100 + (rem * 100 + runouts) / den);
+}
+
+void equity_mc_start(EquityMc *mc, const Card hole1[2], const Card hole2[2], const Card *board, uint8_t n, uint32_t seed){
+	mc->numLeft = equity_setup(hole1, hole2, board, n, &mc->base1, &mc->base2, mc->left);
+	mc->need = 5 - n;
+	mc->rng = seed ? seed : 0x9E3779B9ul;
+	mc->er.win = mc->er.tie = mc->er.loss = mc->er.runouts = 0;
+}
+
+void equity_mc_samples(EquityMc *mc, uint16_t count){
+	for(uint16_t s = 0; s < count; s++){
+		HandAccumulator a1 = mc->base1, a2 = mc->base2;
+		for(uint8_t i = 0; i < mc->need; i++){
+			//Swap a random card of left[i..] into slot i, the order of left does not matter
+			uint32_t x = mc->rng;
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			mc->rng = x;
+			uint8_t j = i + (uint8_t)(((x >> 16) * (uint16_t)(mc->numLeft - i)) >> 16);
+			PackedCard p = mc->left[j];
+			mc->left[j] = mc->left[i];
+			mc->left[i] = p;
+			hand_acc_add_packed(&a1, p);
+			hand_acc_add_packed(&a2, p);
+		}
+		score(&a1, &a2, &mc->er);
+	}
+}
+
+uint16_t equity_mc_run(EquityMc *mc, uint16_t (*clock)(void), uint16_t budget){
+	uint16_t start = clock(), added = 0;
+	while((uint16_t)(clock() - start) < budget){
+		equity_mc_samples(mc, 1);
+		added++;
+	}
+	return added;
+}
@@ -0,0 +1,47 @@
+/*
+ * equity.h
+ *
+ * Exact heads-up equity: every way the rest of the board can come, both hands evaluated
+ * on each. Runouts: 1,712,304 preflop, 990 on the flop, 44 on the turn, 1 on the river.
+ * Flop and turn are meant for the device, preflop for the host, which splits the work
+ * across threads with equity_exact_part().
+ * Where that is too slow (preflop on the device) EquityMc estimates it from random runouts,
+ * in slices the main loop hands it, so input keeps being polled in between.
+ */ 
+
+#ifndef EQUITY_H
+#define EQUITY_H
+
+#include <stdint.h>
+#include "card.h"
+
+typedef struct{
+	uint32_t win; //Player 1 ahead
+	uint32_t tie;
+	uint32_t loss;
+	uint32_t runouts; //win + tie + loss
+} EquityResult;
+
+void equity_exact(const Card hole1[2], const Card hole2[2], const Card *board, uint8_t n, EquityResult *er); //n = 0..5 board cards
+//Share of the runouts: the ones whose first new card is the part-th, part + parts-th, ... card left in the deck
+void equity_exact_part(const Card hole1[2], const Card hole2[2], const Card *board, uint8_t n,
+	uint8_t part, uint8_t parts, EquityResult *er);
+void equity_game(const Game *g, EquityResult *er); //Player 1 against Player 2 on g->community[0..communityCount-1]
+uint16_t equity_p1(const EquityResult *er); //Player 1 equity in 0.01 %, ties count half
+
+typedef struct{
+	PackedCard left[48];
+	uint8_t numLeft;
+	uint8_t need;
+	HandAccumulator base1, base2; //Board so far plus each player's hole cards
+	uint32_t rng; //xorshift32 state, never 0
+	EquityResult er; //Samples so far, runouts = sample count
+} EquityMc;
+
+void equity_mc_start(EquityMc *mc, const Card hole1[2], const Card hole2[2], const Card *board, uint8_t n, uint32_t seed);
+void equity_mc_samples(EquityMc *mc, uint16_t count); //Add count random runouts
+//Sample until clock() has moved budget ticks past its value on entry, returns the samples added.
+//clock must read the counter atomically (ticks_now() in main.c). A counter wrap ends the slice early
+uint16_t equity_mc_run(EquityMc *mc, uint16_t (*clock)(void), uint16_t budget);
+
+#endif
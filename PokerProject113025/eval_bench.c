@@ -0,0 +1,315 @@
+/*
+ * eval_bench.c
+ *
+ * Counts CPU cycles of each evaluator with TCB1 clocked straight from CLK_PER (16 MHz),
+ * so one count = one cycle. Interrupts are held off while a hand is timed so the
+ * TCA0 tick ISR does not land inside a measurement.
+ * Stack peak is measured by painting the free stack below SP and finding the deepest
+ * byte the evaluator overwrote. tools/eval_report.sh adds flash and static RAM per backend.
+ */ 
+
+#ifdef EVAL_BENCH
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <stdio.h>
+#include <string.h>
+#include "eval_bench.h"
+#include "showdown.h"
+#include "draws.h"
+#include "equity.h"
+#ifdef GAME_OMAHA
+#include "omaha.h"
+#endif
+
+#define BENCH_DEALS 200 //Shuffled hands on top of the fixed category hands
+#define EQUITY_DEALS 10 //Flop and turn equity runs, each takes milliseconds
+
+#define STACK_PAINT 384 //Bytes below SP painted before each run
+#define STACK_PATTERN 0xA5
+
+static const EvalBackend backends[] = {
+	{"counting", evaluate_best_hand_counting},
+	{"tiny",     evaluate_best_hand_tiny},
+	{"constant", evaluate_best_hand_const},
+	{"selected", evaluate_best_hand}, //Whatever EVAL_BACKEND this image was built with
+};
+#define NUM_BACKENDS (sizeof(backends) / sizeof(backends[0]))
+
+//One hand per category, rank 1-13 (A = 1), suit 0-3
+static const Card fixedHands[][7] = {
+	{{1,0},{9,1},{7,2},{5,3},{3,0},{12,1},{10,2}},	//High card
+	{{1,0},{1,1},{7,2},{5,3},{3,0},{12,1},{10,2}},	//One pair
+	{{1,0},{1,1},{7,2},{7,3},{3,0},{3,1},{10,2}},	//Two pair, three pairs
+	{{6,0},{6,1},{6,2},{13,3},{3,0},{12,1},{10,2}},	//Three of a kind
+	{{1,0},{2,1},{3,2},{4,3},{5,0},{12,1},{10,2}},	//Wheel straight
+	{{2,0},{9,0},{7,0},{5,0},{11,0},{13,0},{10,2}},	//Six card flush
+	{{6,0},{6,1},{6,2},{9,3},{9,0},{9,1},{10,2}},	//Full house from two trips
+	{{8,0},{8,1},{8,2},{8,3},{3,0},{12,1},{10,2}},	//Four of a kind
+	{{5,3},{6,3},{7,3},{8,3},{9,3},{10,3},{2,2}},	//Straight flush
+	{{10,1},{11,1},{12,1},{13,1},{1,1},{1,2},{1,3}},	//Royal flush
+};
+#define NUM_FIXED (sizeof(fixedHands) / sizeof(fixedHands[0]))
+
+static volatile uint8_t sink; //Keeps the evaluator result alive
+
+static void cycle_timer_init(void){
+	TCB1.CCMP = 0xFFFF;
+	TCB1.CTRLB = TCB_CNTMODE_INT_gc;
+	TCB1.CTRLA = TCB_CLKSEL_DIV1_gc | TCB_ENABLE_bm;
+}
+
+static HandValue eval_nothing(Card cards[7]){
+	HandValue hv = {HAND_HIGH_CARD, {0}};
+	(void)cards;
+	return hv;
+}
+
+static uint16_t time_eval(EvalFn fn, Card cards[7]){
+	uint8_t sreg = SREG;
+	cli();
+	TCB1.CNT = 0;
+	HandValue hv = fn(cards);
+	uint16_t t = TCB1.CNT;
+	SREG = sreg;
+	sink = hv.type;
+	return t;
+}
+
+static __attribute__((noinline)) uint16_t stack_peak(EvalFn fn, Card cards[7]){
+	//Bytes of stack used by fn below this frame, interrupts off so nothing else touches the paint
+	uint8_t sreg = SREG;
+	cli();
+	uint8_t *top = (uint8_t *)SP;
+	uint8_t *low = top - STACK_PAINT;
+	for(uint8_t *p = low; p < top - 8; p++){
+		*p = STACK_PATTERN;
+	}
+	HandValue hv = fn(cards);
+	uint8_t *p = low;
+	while(p < top && *p == STACK_PATTERN){
+		p++;
+	}
+	SREG = sreg;
+	sink = hv.type;
+	return (uint16_t)(top - p);
+}
+
+static void corpus_hand(uint16_t n, Card out[7]){
+	//Hands 0..NUM_FIXED-1 are the fixed ones, the rest come from a seeded shuffle
+	if(n < NUM_FIXED){
+		memcpy(out, fixedHands[n], sizeof(fixedHands[n]));
+		return;
+	}
+	card_init();
+	card_shuffle(n);
+	for(uint8_t i = 0; i < 7; i++){
+		out[i] = get_card(i);
+	}
+}
+
+static uint16_t time_showdown(Card hand[7]){
+	//One seat showdown_rank() with hand[0..1] as the hole cards, the whole call including hand_strength()
+	ShowdownResult sr;
+	uint8_t sreg = SREG;
+	cli();
+	TCB1.CNT = 0;
+	showdown_rank(&hand[2], (const Card (*)[2])hand, 1, &sr);
+	uint16_t t = TCB1.CNT;
+	SREG = sreg;
+	sink = (uint8_t)sr.strength[0];
+	return t;
+}
+
+static void const_bench_run(uint16_t overhead){
+	//Per category spread of the constant time evaluator and of a whole showdown_rank() on the selected
+	//backend, every category is in the fixed hands
+	uint16_t best[2][10], worst[2][10];
+	uint16_t lo[2] = {0xFFFF, 0xFFFF}, hi[2] = {0, 0};
+	for(uint8_t t = 0; t < 10; t++){
+		best[0][t] = best[1][t] = 0xFFFF;
+		worst[0][t] = worst[1][t] = 0;
+	}
+	for(uint16_t n = 0; n < NUM_FIXED + BENCH_DEALS; n++){
+		Card hand[7];
+		corpus_hand(n, hand);
+		uint16_t t[2];
+		t[0] = time_eval(evaluate_best_hand_const, hand) - overhead;
+		t[1] = time_showdown(hand) - overhead;
+		uint8_t type = evaluate_best_hand_const(hand).type;
+		for(uint8_t k = 0; k < 2; k++){
+			if(t[k] < best[k][type]) best[k][type] = t[k];
+			if(t[k] > worst[k][type]) worst[k][type] = t[k];
+			if(t[k] < lo[k]) lo[k] = t[k];
+			if(t[k] > hi[k]) hi[k] = t[k];
+		}
+	}
+	printf("per category best/worst     constant     showdown_rank\r\n");
+	for(uint8_t t = 0; t < 10; t++){
+		printf("  %-16s %5u %5u    %5u %5u\r\n", hand_type_to_string((HandRankType)t),
+			best[0][t], worst[0][t], best[1][t], worst[1][t]);
+	}
+	printf("  spread/worst     %5u %5u    %5u %5u\r\n", hi[0] - lo[0], hi[0], hi[1] - lo[1], hi[1]);
+}
+
+static void draws_bench_run(void){
+	//draw_classify() on the flop and the turn of each shuffled deal, board accumulator built outside the timing
+	uint32_t total[2] = {0, 0};
+	uint16_t worst[2] = {0, 0};
+	for(uint16_t n = 0; n < BENCH_DEALS; n++){
+		card_init();
+		card_shuffle(n + 2000);
+		Card hole1 = get_card(0), hole2 = get_card(1);
+		HandAccumulator board;
+		hand_acc_init(&board);
+		for(uint8_t i = 2; i < 6; i++){
+			hand_acc_add(&board, get_card(i));
+			if(i < 4){
+				continue;
+			}
+			DrawInfo di;
+			uint8_t sreg = SREG;
+			cli();
+			TCB1.CNT = 0;
+			draw_classify(&board, hole1, hole2, &di);
+			uint16_t t = TCB1.CNT;
+			SREG = sreg;
+			sink = di.outs;
+			total[i - 4] += t;
+			if(t > worst[i - 4]) worst[i - 4] = t;
+		}
+	}
+	printf("draws     flop avg %5lu worst %5u, turn avg %5lu worst %5u\r\n",
+		(unsigned long)(total[0] / BENCH_DEALS), worst[0], (unsigned long)(total[1] / BENCH_DEALS), worst[1]);
+}
+
+uint16_t ticks_now(void); //main.c, 1 ms tick count read atomically
+
+static void equity_mc_bench_run(void){
+	//Preflop Monte Carlo samples per 100 ms slice, what live_equity_step() gets through per 100 ms
+	Card d[4];
+	EquityMc mc;
+	card_init();
+	card_shuffle(4000);
+	for(uint8_t i = 0; i < 4; i++){
+		d[i] = get_card(i);
+	}
+	equity_mc_start(&mc, &d[0], &d[2], d, 0, 1);
+	uint16_t samples = equity_mc_run(&mc, ticks_now, 100);
+	printf("equity mc %u preflop runouts per 100 ms\r\n", samples);
+}
+
+static void equity_bench_run(void){
+	//Exact equity takes well over 65535 cycles on the flop, so TCB1 counts TCA0 clocks (CLK_PER / 64, 4 us)
+	//here with interrupts left on, the way the game runs it
+	uint32_t total[2] = {0, 0};
+	uint16_t worst[2] = {0, 0};
+	TCB1.CTRLA = TCB_CLKSEL_TCA0_gc | TCB_ENABLE_bm;
+	for(uint16_t n = 0; n < EQUITY_DEALS; n++){
+		Card d[8];
+		card_init();
+		card_shuffle(n + 3000);
+		for(uint8_t i = 0; i < 8; i++){
+			d[i] = get_card(i);
+		}
+		for(uint8_t street = 0; street < 2; street++){
+			EquityResult er;
+			TCB1.CNT = 0;
+			equity_exact(&d[0], &d[2], &d[4], 3 + street, &er);
+			uint16_t t = TCB1.CNT;
+			sink = (uint8_t)er.win;
+			total[street] += t;
+			if(t > worst[street]) worst[street] = t;
+		}
+	}
+	TCB1.CTRLA = TCB_CLKSEL_DIV1_gc | TCB_ENABLE_bm;
+	printf("equity    flop avg %lu us worst %lu us, turn avg %lu us worst %lu us\r\n",
+		(unsigned long)(total[0] * 4 / EQUITY_DEALS), (unsigned long)worst[0] * 4,
+		(unsigned long)(total[1] * 4 / EQUITY_DEALS), (unsigned long)worst[1] * 4);
+}
+
+#ifdef GAME_OMAHA
+static void omaha_bench_run(void){
+	//One board and one 4 card hand per shuffled deal. The brute force can pass 65535 cycles,
+	//so TCB1 runs at CLK_PER / 2 for it and the count is doubled
+	uint32_t board = 0, fast = 0, brute = 0;
+	uint16_t worstFast = 0, mismatches = 0;
+	for(uint16_t n = 0; n < BENCH_DEALS; n++){
+		Card d[9];
+		card_init();
+		card_shuffle(n + 1000);
+		for(uint8_t i = 0; i < 9; i++){
+			d[i] = get_card(i);
+		}
+		OmahaBoard ob;
+		uint8_t sreg = SREG;
+		cli();
+		TCB1.CNT = 0;
+		omaha_board_init(&ob, d, 5);
+		uint16_t t0 = TCB1.CNT;
+		HandValue hv = omaha_best(&ob, &d[5]);
+		uint16_t t1 = TCB1.CNT;
+		SREG = sreg;
+		board += t0;
+		fast += t1 - t0;
+		if(t1 - t0 > worstFast) worstFast = t1 - t0;
+
+		TCB1.CTRLA = TCB_CLKSEL_DIV2_gc | TCB_ENABLE_bm;
+		cli();
+		TCB1.CNT = 0;
+		HandValue ref = omaha_best_brute(d, 5, &d[5]);
+		uint16_t t2 = TCB1.CNT;
+		SREG = sreg;
+		TCB1.CTRLA = TCB_CLKSEL_DIV1_gc | TCB_ENABLE_bm;
+		brute += 2ul * t2;
+		if(compare_hands(&hv, &ref) != 0){
+			mismatches++;
+		}
+	}
+	printf("omaha     board init avg %5lu, hand avg %5lu worst %5u, brute force avg %6lu, mismatches %u\r\n",
+		(unsigned long)(board / BENCH_DEALS), (unsigned long)(fast / BENCH_DEALS), worstFast,
+		(unsigned long)(brute / BENCH_DEALS), mismatches);
+}
+#endif
+
+void eval_bench_run(void){
+	Card hand[7];
+	cycle_timer_init();
+	hand[0].rank = 1; hand[0].suit = 0;
+	uint16_t overhead = time_eval(eval_nothing, hand); //Call + timer read cost, removed from every sample
+
+	printf("\r\nEvaluator cycles over %u hands (overhead %u removed), EVAL_BACKEND = %s\r\n",
+		(unsigned)(NUM_FIXED + BENCH_DEALS), overhead, eval_backend_name());
+	for(uint8_t b = 0; b < NUM_BACKENDS; b++){
+		uint16_t best = 0xFFFF, worst = 0;
+		uint32_t total = 0;
+		uint16_t mismatches = 0;
+		uint16_t stack = 0;
+		for(uint16_t n = 0; n < NUM_FIXED + BENCH_DEALS; n++){
+			corpus_hand(n, hand);
+			uint16_t t = time_eval(backends[b].eval, hand) - overhead;
+			if(t < best) best = t;
+			if(t > worst) worst = t;
+			total += t;
+
+			HandValue ref = evaluate_best_hand_counting(hand);
+			HandValue got = backends[b].eval(hand);
+			if(compare_hands(&ref, &got) != 0){
+				mismatches++;
+			}
+			uint16_t used = stack_peak(backends[b].eval, hand);
+			if(used > stack) stack = used;
+		}
+		printf("%-9s best %5u avg %5lu worst %5u stack %3u mismatches %u\r\n", backends[b].name,
+			best, (unsigned long)(total / (NUM_FIXED + BENCH_DEALS)), worst, stack, mismatches);
+	}
+	const_bench_run(overhead);
+	draws_bench_run();
+	equity_bench_run();
+	equity_mc_bench_run();
+#ifdef GAME_OMAHA
+	omaha_bench_run();
+#endif
+}
+
+#endif /* EVAL_BENCH */
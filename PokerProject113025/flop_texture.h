@@ -0,0 +1,40 @@
+/*
+ * flop_texture.h
+ *
+ * 22,100 flops, 1,755 of them distinct once suits are renamed. flop_canonical() maps a
+ * flop to its class in O(1) and flopTexture holds precomputed board features per class,
+ * written by tools/gen_flop_texture.c into flop_texture_table.c, for bot decisions and hints.
+ */ 
+
+#ifndef FLOP_TEXTURE_H
+#define FLOP_TEXTURE_H
+
+#include <stdint.h>
+#include "card.h"
+#include "rank_tables.h" //FLASH_TABLE placement and readers
+
+#define FLOP_CANONICAL 1755
+//Class layout: unpaired rank set * 5 + suit pattern, then pair * 12 + kicker, * 2 for a kicker sharing a pair suit, then trips
+#define FLOP_PAIRED_BASE 1430
+#define FLOP_TRIPS_BASE 1742
+
+//Fields of a flopTexture entry
+#define FLOP_HIGH(t) ((uint8_t)((t) & 0x0F)) //Highest rank value, 2..14
+#define FLOP_SUITS(t) ((uint8_t)(((t) >> 4) & 3)) //FLOP_RAINBOW, FLOP_TWO_TONE or FLOP_MONOTONE
+#define FLOP_PAIRING(t) ((uint8_t)(((t) >> 6) & 3)) //FLOP_UNPAIRED, FLOP_PAIRED or FLOP_TRIPS
+#define FLOP_STRAIGHTS(t) ((uint8_t)(((t) >> 8) & 7)) //Straights (5 rank windows, Ace also low) holding every flop rank, 0..5
+#define FLOP_SPAN(t) ((uint8_t)(((t) >> 11) & 15)) //Highest minus lowest rank, Ace high, 0 when trips
+#define FLOP_RAINBOW 0
+#define FLOP_TWO_TONE 1
+#define FLOP_MONOTONE 2
+#define FLOP_UNPAIRED 0
+#define FLOP_PAIRED 1
+#define FLOP_TRIPS 2
+
+extern const uint16_t flopTexture[FLOP_CANONICAL] FLASH_TABLE;
+
+uint16_t flop_canonical(const Card flop[3]); //0..1754, same for flops that differ only by suit names
+uint16_t flop_texture(const Card flop[3]); //flopTexture entry of the flop's class
+const char* flop_suits_to_string(uint8_t suits);
+
+#endif
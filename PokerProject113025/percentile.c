@@ -0,0 +1,52 @@
+/*
+ * percentile.c
+ *
+ * Percentile is a binary search over the 1000 step table, 10 flash reads.
+ * Rank index in the preflop grid is 0 = 2 ... 12 = Ace.
+ * The matchup matrix keeps one triangle: a class against itself is 50 % by symmetry and
+ * b against a is 100 % minus a against b.
+ */ 
+
+#include "percentile.h"
+
+uint16_t strength_permille(uint16_t strength){
+	//Last step whose strength is at or below this one, step 0 is strength 1
+	uint16_t lo = 0, hi = PERCENTILE_STEPS - 1;
+	while(lo < hi){
+		uint16_t mid = (lo + hi + 1) / 2;
+		if(rank_table_word(&percentileStrength[mid]) <= strength){
+			lo = mid;
+		}
+		else{
+			hi = mid - 1;
+		}
+	}
+	return lo;
+}
+
+uint16_t strength_top_permille(uint16_t strength){
+	return PERCENTILE_STEPS - strength_permille(strength);
+}
+
+uint8_t preflop_class(Card a, Card b){
+	uint8_t ra = card_rank_index(a.rank);
+	uint8_t rb = card_rank_index(b.rank);
+	uint8_t hi = (ra > rb) ? ra : rb;
+	uint8_t lo = (ra > rb) ? rb : ra;
+	return (a.suit == b.suit) ? hi * 13 + lo : lo * 13 + hi;
+}
+
+uint16_t preflop_equity(Card a, Card b){
+	return rank_table_word(&preflopEquity[preflop_class(a, b)]);
+}
+
+uint16_t preflop_matchup(uint8_t classA, uint8_t classB){
+	if(classA == classB){
+		return 5000;
+	}
+	uint8_t lo = (classA < classB) ? classA : classB;
+	uint8_t hi = (classA < classB) ? classB : classA;
+	uint8_t q = flash_table_byte(&preflopMatrix[(uint16_t)hi * (hi - 1) / 2 + lo]);
+	uint16_t e = (uint16_t)(((uint32_t)q * 10000 + 127) / 255);
+	return (classA == lo) ? e : 10000 - e;
+}
@@ -0,0 +1,36 @@
+/*
+ * percentile.h
+ *
+ * How good a hand is without simulating anything on the board: the share of all
+ * 133,784,560 seven card hands a hand strength beats, and each starting hand's equity
+ * against one random hand. Both are flash tables written by tools/gen_percentile.c into
+ * percentile_tables.c. preflopMatrix holds every class against every other class,
+ * written by tools/gen_preflop_matrix.c into preflop_matrix.c.
+ */ 
+
+#ifndef PERCENTILE_H
+#define PERCENTILE_H
+
+#include <stdint.h>
+#include "card.h"
+#include "rank_tables.h" //RANK_TABLE / FLASH_TABLE placement and readers
+
+#define PERCENTILE_STEPS 1000 //Per mille resolution
+#define PREFLOP_CLASSES 169
+#define PREFLOP_PAIRS 14196 //Class pairs a < b, the matrix is stored as one triangle
+
+//Entry p is the weakest strength that beats at least p / 10 % of all 7 card hands
+extern const uint16_t percentileStrength[PERCENTILE_STEPS] RANK_TABLE;
+//Equity against a random hand in 0.01 %, ties count half, indexed by preflop_class()
+extern const uint16_t preflopEquity[PREFLOP_CLASSES] RANK_TABLE;
+//All-in equity of class a against class b > a in 1/255 steps, at b * (b - 1) / 2 + a.
+//Averaged over the suit combos of a and b that share no card
+extern const uint8_t preflopMatrix[PREFLOP_PAIRS] FLASH_TABLE;
+
+uint16_t strength_permille(uint16_t strength); //0..999, share of 7 card hands this strength beats
+uint16_t strength_top_permille(uint16_t strength); //1..1000, "top x %" in tenths of a percent
+uint8_t preflop_class(Card a, Card b); //13 x 13 grid, higher rank * 13 + lower if suited, lower * 13 + higher if not
+uint16_t preflop_equity(Card a, Card b); //preflopEquity of the pair's class
+uint16_t preflop_matchup(uint8_t classA, uint8_t classB); //Equity of class A against class B in 0.01 %, O(1)
+
+#endif
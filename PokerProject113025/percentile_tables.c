@@ -0,0 +1,110 @@
+/*
+ * percentile_tables.c
+ *
+ * Generated by tools/gen_percentile.c, do not edit.
+ */ 
+
+#include "percentile.h"
+
+const uint16_t percentileStrength[PERCENTILE_STEPS] RANK_TABLE = {
+	1, 108, 122, 183, 192, 222, 227, 240, 242, 247, 302, 316,
+	343, 351, 362, 367, 372, 373, 403, 408, 422, 423, 428, 429,
+	443, 447, 449, 450, 455, 456, 507, 521, 545, 560, 567, 576,
+	580, 582, 608, 616, 627, 632, 637, 638, 648, 653, 658, 659,
+	663, 665, 666, 666, 696, 701, 715, 719, 721, 722, 736, 740,
+	742, 743, 748, 749, 750, 750, 764, 768, 770, 771, 776, 777,
+	778, 778, 783, 784, 785, 785, 848, 854, 884, 889, 903, 908,
+	910, 939, 945, 958, 960, 965, 966, 980, 985, 986, 987, 992,
+	993, 994, 1014, 1029, 1039, 1044, 1049, 1050, 1064, 1065, 1070, 1071,
+	1076, 1077, 1078, 1078, 1092, 1096, 1098, 1099, 1104, 1105, 1106, 1106,
+	1111, 1112, 1113, 1113, 1114, 1114, 1147, 1158, 1164, 1168, 1170, 1180,
+	1185, 1190, 1191, 1195, 1197, 1197, 1198, 1208, 1213, 1218, 1219, 1223,
+	1225, 1226, 1226, 1230, 1232, 1232, 1233, 1234, 1234, 1234, 1248, 1253,
+	1255, 1255, 1260, 1261, 1262, 1262, 1267, 1268, 1269, 1269, 1270, 1270,
+	1274, 1276, 1277, 1277, 1278, 1278, 1278, 1323, 1334, 1353, 1360, 1362,
+	1381, 1387, 1390, 1396, 1398, 1411, 1419, 1425, 1430, 1433, 1434, 1440,
+	1442, 1443, 1443, 1464, 1470, 1475, 1478, 1479, 1485, 1487, 1488, 1488,
+	1495, 1496, 1497, 1498, 1498, 1542, 1554, 1572, 1579, 1582, 1601, 1607,
+	1610, 1616, 1618, 1631, 1639, 1645, 1650, 1653, 1654, 1660, 1662, 1663,
+	1663, 1684, 1690, 1696, 1698, 1699, 1705, 1707, 1708, 1712, 1715, 1716,
+	1717, 1718, 1718, 1766, 1774, 1794, 1800, 1802, 1822, 1828, 1830, 1836,
+	1838, 1853, 1862, 1866, 1872, 1873, 1874, 1881, 1882, 1883, 1898, 1904,
+	1911, 1917, 1918, 1923, 1926, 1927, 1928, 1933, 1935, 1936, 1937, 1938,
+	1967, 1992, 2008, 2015, 2021, 2037, 2043, 2050, 2055, 2057, 2058, 2078,
+	2085, 2089, 2093, 2094, 2100, 2101, 2103, 2103, 2124, 2130, 2135, 2138,
+	2139, 2145, 2147, 2148, 2148, 2155, 2156, 2157, 2158, 2158, 2207, 2214,
+	2234, 2241, 2252, 2263, 2269, 2275, 2277, 2278, 2298, 2304, 2306, 2312,
+	2314, 2319, 2321, 2322, 2323, 2342, 2349, 2351, 2357, 2359, 2364, 2366,
+	2367, 2368, 2374, 2376, 2377, 2377, 2378, 2408, 2432, 2449, 2455, 2462,
+	2481, 2488, 2490, 2496, 2498, 2512, 2519, 2525, 2531, 2533, 2534, 2541,
+	2542, 2543, 2557, 2564, 2570, 2576, 2578, 2579, 2585, 2587, 2588, 2592,
+	2595, 2596, 2597, 2598, 2598, 2643, 2654, 2674, 2680, 2691, 2703, 2709,
+	2714, 2717, 2718, 2738, 2744, 2746, 2753, 2754, 2760, 2761, 2762, 2763,
+	2783, 2789, 2791, 2797, 2799, 2804, 2806, 2807, 2808, 2814, 2816, 2817,
+	2817, 2818, 2851, 2872, 2888, 2895, 2901, 2917, 2923, 2930, 2936, 2937,
+	2951, 2959, 2965, 2971, 2973, 2974, 2980, 2982, 2983, 2998, 3004, 3011,
+	3016, 3018, 3019, 3026, 3027, 3028, 3033, 3035, 3036, 3037, 3038, 3038,
+	3083, 3094, 3113, 3120, 3122, 3142, 3148, 3150, 3156, 3158, 3173, 3183,
+	3186, 3192, 3194, 3198, 3201, 3202, 3203, 3222, 3229, 3231, 3237, 3239,
+	3244, 3246, 3247, 3248, 3254, 3256, 3257, 3257, 3258, 3293, 3312, 3328,
+	3335, 3341, 3357, 3363, 3369, 3375, 3377, 3387, 3398, 3405, 3406, 3413,
+	3414, 3420, 3421, 3423, 3433, 3444, 3450, 3455, 3458, 3459, 3465, 3467,
+	3468, 3468, 3475, 3476, 3477, 3478, 3478, 3523, 3534, 3549, 3559, 3562,
+	3577, 3586, 3590, 3596, 3597, 3611, 3619, 3625, 3630, 3633, 3634, 3640,
+	3642, 3643, 3657, 3664, 3670, 3675, 3678, 3679, 3685, 3687, 3688, 3691,
+	3695, 3696, 3697, 3698, 3714, 3746, 3754, 3773, 3779, 3782, 3797, 3807,
+	3810, 3816, 3817, 3828, 3838, 3845, 3849, 3853, 3854, 3860, 3861, 3863,
+	3873, 3884, 3890, 3894, 3898, 3899, 3905, 3906, 3908, 3908, 3914, 3916,
+	3917, 3918, 3918, 3963, 3974, 3993, 3999, 4002, 4020, 4027, 4030, 4036,
+	4038, 4048, 4059, 4065, 4070, 4073, 4074, 4080, 4082, 4083, 4083, 4103,
+	4109, 4111, 4117, 4119, 4124, 4126, 4127, 4128, 4134, 4136, 4137, 4137,
+	4138, 4146, 4148, 4149, 4157, 4159, 4165, 4169, 4171, 4177, 4180, 4182,
+	4189, 4192, 4193, 4201, 4203, 4204, 4212, 4214, 4220, 4224, 4226, 4232,
+	4235, 4237, 4244, 4246, 4248, 4255, 4258, 4259, 4267, 4269, 4270, 4278,
+	4280, 4281, 4289, 4291, 4294, 4300, 4302, 4306, 4312, 4313, 4320, 4323,
+	4325, 4331, 4334, 4336, 4343, 4345, 4347, 4354, 4356, 4358, 4365, 4367,
+	4369, 4376, 4379, 4380, 4388, 4390, 4391, 4399, 4401, 4402, 4410, 4412,
+	4413, 4421, 4423, 4424, 4432, 4434, 4435, 4442, 4445, 4446, 4454, 4456,
+	4457, 4465, 4467, 4470, 4476, 4478, 4483, 4487, 4489, 4494, 4498, 4500,
+	4504, 4509, 4511, 4512, 4520, 4522, 4523, 4530, 4533, 4534, 4542, 4544,
+	4545, 4553, 4555, 4556, 4564, 4566, 4571, 4575, 4577, 4582, 4586, 4588,
+	4592, 4597, 4599, 4600, 4608, 4610, 4611, 4618, 4621, 4622, 4629, 4631,
+	4633, 4639, 4642, 4644, 4651, 4654, 4655, 4662, 4665, 4666, 4674, 4676,
+	4677, 4684, 4687, 4688, 4695, 4698, 4699, 4706, 4708, 4710, 4716, 4719,
+	4720, 4726, 4729, 4731, 4732, 4740, 4742, 4743, 4751, 4753, 4754, 4762,
+	4764, 4765, 4773, 4775, 4778, 4784, 4786, 4790, 4795, 4797, 4798, 4806,
+	4808, 4809, 4817, 4819, 4820, 4827, 4829, 4831, 4837, 4840, 4841, 4847,
+	4850, 4852, 4853, 4860, 4862, 4864, 4871, 4873, 4875, 4882, 4885, 4886,
+	4894, 4896, 4897, 4905, 4907, 4908, 4916, 4918, 4919, 4927, 4929, 4930,
+	4937, 4939, 4941, 4947, 4950, 4952, 4957, 4960, 4962, 4963, 4971, 4973,
+	4974, 4981, 4983, 4985, 4990, 4993, 4995, 4996, 5031, 5047, 5058, 5062,
+	5103, 5115, 5126, 5152, 5172, 5183, 5193, 5227, 5239, 5255, 5260, 5296,
+	5313, 5323, 5345, 5369, 5380, 5391, 5420, 5437, 5447, 5458, 5493, 5509,
+	5520, 5530, 5565, 5578, 5588, 5616, 5634, 5645, 5655, 5689, 5704, 5717,
+	5722, 5758, 5775, 5785, 5807, 5831, 5842, 5853, 5855, 5855, 5855, 5855,
+	5855, 5856, 5856, 5856, 5856, 5857, 5857, 5857, 5857, 5857, 5858, 5858,
+	5858, 5858, 5859, 5859, 5859, 5859, 5859, 5860, 5860, 5860, 5860, 5861,
+	5861, 5861, 5861, 5861, 5862, 5862, 5862, 5862, 5863, 5863, 5863, 5863,
+	5863, 5864, 5864, 5864, 5864, 5864, 5874, 5918, 5962, 6005, 6049, 6091,
+	6134, 6178, 6220, 6263, 6305, 6347, 6390, 6433, 6475, 6517, 6559, 6600,
+	6641, 6684, 6727, 6769, 6812, 6853, 6895, 6937, 6977, 7019, 7060, 7100,
+	7140, 7147, 7153, 7160, 7166, 7172, 7178, 7184, 7190, 7196, 7202, 7208,
+	7214, 7220, 7226, 7232, 7238, 7244, 7250, 7256, 7262, 7268, 7274, 7280,
+	7286, 7292, 7297, 7392,
+};
+
+const uint16_t preflopEquity[PREFLOP_CLASSES] RANK_TABLE = { //13 x 13, 0 = 2 ... 12 = Ace: pairs on the diagonal, suited below it, offsuit above
+	5033, 3230, 3320, 3428, 3408, 3458, 3683, 3910, 4167, 4435, 4730, 5051, 5493,
+	3598, 5369, 3515, 3626, 3608, 3660, 3748, 4002, 4259, 4528, 4822, 5143, 5584,
+	3683, 3864, 5702, 3816, 3801, 3855, 3945, 4067, 4350, 4619, 4913, 5233, 5673,
+	3785, 3969, 4145, 6032, 3994, 4051, 4143, 4267, 4425, 4718, 5012, 5331, 5770,
+	3767, 3953, 4133, 4313, 6328, 4232, 4324, 4449, 4609, 4784, 5102, 5422, 5768,
+	3816, 4004, 4185, 4368, 4537, 6624, 4505, 4630, 4791, 4968, 5177, 5519, 5884,
+	4027, 4087, 4270, 4454, 4624, 4794, 6916, 4810, 4972, 5149, 5360, 5602, 5987,
+	4242, 4326, 4386, 4572, 4743, 4912, 5080, 7206, 5153, 5325, 5536, 5781, 6077,
+	4484, 4569, 4653, 4722, 4894, 5064, 5233, 5403, 7501, 5525, 5729, 5974, 6272,
+	4738, 4823, 4907, 4999, 5061, 5232, 5402, 5566, 5753, 7747, 5813, 6057, 6356,
+	5017, 5102, 5186, 5277, 5361, 5430, 5602, 5766, 5947, 6026, 7993, 6146, 6443,
+	5321, 5405, 5488, 5579, 5664, 5754, 5831, 5999, 6179, 6257, 6340, 8240, 6532,
+	5738, 5822, 5903, 5992, 5991, 6098, 6194, 6278, 6460, 6539, 6621, 6704, 8520,
+};
@@ -0,0 +1,965 @@
+/*
+ * rank_tables.c
+ *
+ * Generated by tools/gen_tables.cpp, do not edit.
+ */ 
+
+#include "rank_tables.h"
+#include "colex.h"
+
+const uint16_t rankMaskInfo[8192] RANK_TABLE = {
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x67FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0000,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0001, 0x07FF, 0x07FF, 0x07FF, 0x0002,
+	0x07FF, 0x0003, 0x77FF, 0x77FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0004, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x0005, 0x07FF, 0x07FF, 0x07FF, 0x0006, 0x07FF, 0x0007, 0x0008, 0x6008,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0009, 0x07FF, 0x07FF, 0x07FF, 0x000A,
+	0x07FF, 0x000B, 0x000C, 0x000C, 0x07FF, 0x07FF, 0x07FF, 0x000D, 0x07FF, 0x000E, 0x000F, 0x000F,
+	0x07FF, 0x0010, 0x0011, 0x0011, 0x87FF, 0x87FF, 0x87FF, 0x87FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0012,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0013, 0x07FF, 0x07FF, 0x07FF, 0x0014,
+	0x07FF, 0x0015, 0x0016, 0x6016, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0017,
+	0x07FF, 0x07FF, 0x07FF, 0x0018, 0x07FF, 0x0019, 0x001A, 0x001A, 0x07FF, 0x07FF, 0x07FF, 0x001B,
+	0x07FF, 0x001C, 0x001D, 0x001D, 0x07FF, 0x001E, 0x001F, 0x001F, 0x0020, 0x0020, 0x7020, 0x7020,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0021, 0x07FF, 0x07FF, 0x07FF, 0x0022,
+	0x07FF, 0x0023, 0x0024, 0x0024, 0x07FF, 0x07FF, 0x07FF, 0x0025, 0x07FF, 0x0026, 0x0027, 0x0027,
+	0x07FF, 0x0028, 0x0029, 0x0029, 0x002A, 0x002A, 0x002A, 0x602A, 0x07FF, 0x07FF, 0x07FF, 0x002B,
+	0x07FF, 0x002C, 0x002D, 0x002D, 0x07FF, 0x002E, 0x002F, 0x002F, 0x0030, 0x0030, 0x0030, 0x0030,
+	0x07FF, 0x0031, 0x0032, 0x0032, 0x0033, 0x0033, 0x0033, 0x0033, 0x97FF, 0x97FF, 0x97FF, 0x97FF,
+	0x97FF, 0x97FF, 0x97FF, 0x97FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0034, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x0035, 0x07FF, 0x07FF, 0x07FF, 0x0036, 0x07FF, 0x0037, 0x0038, 0x6038,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0039, 0x07FF, 0x07FF, 0x07FF, 0x003A,
+	0x07FF, 0x003B, 0x003C, 0x003C, 0x07FF, 0x07FF, 0x07FF, 0x003D, 0x07FF, 0x003E, 0x003F, 0x003F,
+	0x07FF, 0x0040, 0x0041, 0x0041, 0x0042, 0x0042, 0x7042, 0x7042, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x0043, 0x07FF, 0x07FF, 0x07FF, 0x0044, 0x07FF, 0x0045, 0x0046, 0x0046,
+	0x07FF, 0x07FF, 0x07FF, 0x0047, 0x07FF, 0x0048, 0x0049, 0x0049, 0x07FF, 0x004A, 0x004B, 0x004B,
+	0x004C, 0x004C, 0x004C, 0x604C, 0x07FF, 0x07FF, 0x07FF, 0x004D, 0x07FF, 0x004E, 0x004F, 0x004F,
+	0x07FF, 0x0050, 0x0051, 0x0051, 0x0052, 0x0052, 0x0052, 0x0052, 0x07FF, 0x0053, 0x0054, 0x0054,
+	0x0055, 0x0055, 0x0055, 0x0055, 0x0056, 0x0056, 0x0056, 0x0056, 0x8056, 0x8056, 0x8056, 0x8056,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0057, 0x07FF, 0x07FF, 0x07FF, 0x0058,
+	0x07FF, 0x0059, 0x005A, 0x005A, 0x07FF, 0x07FF, 0x07FF, 0x005B, 0x07FF, 0x005C, 0x005D, 0x005D,
+	0x07FF, 0x005E, 0x005F, 0x005F, 0x0060, 0x0060, 0x0060, 0x6060, 0x07FF, 0x07FF, 0x07FF, 0x0061,
+	0x07FF, 0x0062, 0x0063, 0x0063, 0x07FF, 0x0064, 0x0065, 0x0065, 0x0066, 0x0066, 0x0066, 0x0066,
+	0x07FF, 0x0067, 0x0068, 0x0068, 0x0069, 0x0069, 0x0069, 0x0069, 0x006A, 0x006A, 0x006A, 0x006A,
+	0x006A, 0x006A, 0x706A, 0x706A, 0x07FF, 0x07FF, 0x07FF, 0x006B, 0x07FF, 0x006C, 0x006D, 0x006D,
+	0x07FF, 0x006E, 0x006F, 0x006F, 0x0070, 0x0070, 0x0070, 0x0070, 0x07FF, 0x0071, 0x0072, 0x0072,
+	0x0073, 0x0073, 0x0073, 0x0073, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x6074,
+	0x07FF, 0x0075, 0x0076, 0x0076, 0x0077, 0x0077, 0x0077, 0x0077, 0x0078, 0x0078, 0x0078, 0x0078,
+	0x0078, 0x0078, 0x0078, 0x0078, 0xA7FF, 0xA7FF, 0xA7FF, 0xA7FF, 0xA7FF, 0xA7FF, 0xA7FF, 0xA7FF,
+	0xA7FF, 0xA7FF, 0xA7FF, 0xA7FF, 0xA7FF, 0xA7FF, 0xA7FF, 0xA7FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0079,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x007A, 0x07FF, 0x07FF, 0x07FF, 0x007B,
+	0x07FF, 0x007C, 0x007D, 0x607D, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x007E,
+	0x07FF, 0x07FF, 0x07FF, 0x007F, 0x07FF, 0x0080, 0x0081, 0x0081, 0x07FF, 0x07FF, 0x07FF, 0x0082,
+	0x07FF, 0x0083, 0x0084, 0x0084, 0x07FF, 0x0085, 0x0086, 0x0086, 0x0087, 0x0087, 0x7087, 0x7087,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0088, 0x07FF, 0x07FF, 0x07FF, 0x0089,
+	0x07FF, 0x008A, 0x008B, 0x008B, 0x07FF, 0x07FF, 0x07FF, 0x008C, 0x07FF, 0x008D, 0x008E, 0x008E,
+	0x07FF, 0x008F, 0x0090, 0x0090, 0x0091, 0x0091, 0x0091, 0x6091, 0x07FF, 0x07FF, 0x07FF, 0x0092,
+	0x07FF, 0x0093, 0x0094, 0x0094, 0x07FF, 0x0095, 0x0096, 0x0096, 0x0097, 0x0097, 0x0097, 0x0097,
+	0x07FF, 0x0098, 0x0099, 0x0099, 0x009A, 0x009A, 0x009A, 0x009A, 0x009B, 0x009B, 0x009B, 0x009B,
+	0x809B, 0x809B, 0x809B, 0x809B, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x009C,
+	0x07FF, 0x07FF, 0x07FF, 0x009D, 0x07FF, 0x009E, 0x009F, 0x009F, 0x07FF, 0x07FF, 0x07FF, 0x00A0,
+	0x07FF, 0x00A1, 0x00A2, 0x00A2, 0x07FF, 0x00A3, 0x00A4, 0x00A4, 0x00A5, 0x00A5, 0x00A5, 0x60A5,
+	0x07FF, 0x07FF, 0x07FF, 0x00A6, 0x07FF, 0x00A7, 0x00A8, 0x00A8, 0x07FF, 0x00A9, 0x00AA, 0x00AA,
+	0x00AB, 0x00AB, 0x00AB, 0x00AB, 0x07FF, 0x00AC, 0x00AD, 0x00AD, 0x00AE, 0x00AE, 0x00AE, 0x00AE,
+	0x00AF, 0x00AF, 0x00AF, 0x00AF, 0x00AF, 0x00AF, 0x70AF, 0x70AF, 0x07FF, 0x07FF, 0x07FF, 0x00B0,
+	0x07FF, 0x00B1, 0x00B2, 0x00B2, 0x07FF, 0x00B3, 0x00B4, 0x00B4, 0x00B5, 0x00B5, 0x00B5, 0x00B5,
+	0x07FF, 0x00B6, 0x00B7, 0x00B7, 0x00B8, 0x00B8, 0x00B8, 0x00B8, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+	0x00B9, 0x00B9, 0x00B9, 0x60B9, 0x07FF, 0x00BA, 0x00BB, 0x00BB, 0x00BC, 0x00BC, 0x00BC, 0x00BC,
+	0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BD, 0x00BE, 0x00BE, 0x00BE, 0x00BE,
+	0x00BE, 0x00BE, 0x00BE, 0x00BE, 0x90BE, 0x90BE, 0x90BE, 0x90BE, 0x90BE, 0x90BE, 0x90BE, 0x90BE,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x00BF, 0x07FF, 0x07FF, 0x07FF, 0x00C0,
+	0x07FF, 0x00C1, 0x00C2, 0x00C2, 0x07FF, 0x07FF, 0x07FF, 0x00C3, 0x07FF, 0x00C4, 0x00C5, 0x00C5,
+	0x07FF, 0x00C6, 0x00C7, 0x00C7, 0x00C8, 0x00C8, 0x00C8, 0x60C8, 0x07FF, 0x07FF, 0x07FF, 0x00C9,
+	0x07FF, 0x00CA, 0x00CB, 0x00CB, 0x07FF, 0x00CC, 0x00CD, 0x00CD, 0x00CE, 0x00CE, 0x00CE, 0x00CE,
+	0x07FF, 0x00CF, 0x00D0, 0x00D0, 0x00D1, 0x00D1, 0x00D1, 0x00D1, 0x00D2, 0x00D2, 0x00D2, 0x00D2,
+	0x00D2, 0x00D2, 0x70D2, 0x70D2, 0x07FF, 0x07FF, 0x07FF, 0x00D3, 0x07FF, 0x00D4, 0x00D5, 0x00D5,
+	0x07FF, 0x00D6, 0x00D7, 0x00D7, 0x00D8, 0x00D8, 0x00D8, 0x00D8, 0x07FF, 0x00D9, 0x00DA, 0x00DA,
+	0x00DB, 0x00DB, 0x00DB, 0x00DB, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x60DC,
+	0x07FF, 0x00DD, 0x00DE, 0x00DE, 0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00E0, 0x00E0, 0x00E0, 0x00E0,
+	0x00E0, 0x00E0, 0x00E0, 0x00E0, 0x00E1, 0x00E1, 0x00E1, 0x00E1, 0x00E1, 0x00E1, 0x00E1, 0x00E1,
+	0x00E1, 0x00E1, 0x00E1, 0x00E1, 0x80E1, 0x80E1, 0x80E1, 0x80E1, 0x07FF, 0x07FF, 0x07FF, 0x00E2,
+	0x07FF, 0x00E3, 0x00E4, 0x00E4, 0x07FF, 0x00E5, 0x00E6, 0x00E6, 0x00E7, 0x00E7, 0x00E7, 0x00E7,
+	0x07FF, 0x00E8, 0x00E9, 0x00E9, 0x00EA, 0x00EA, 0x00EA, 0x00EA, 0x00EB, 0x00EB, 0x00EB, 0x00EB,
+	0x00EB, 0x00EB, 0x00EB, 0x60EB, 0x07FF, 0x00EC, 0x00ED, 0x00ED, 0x00EE, 0x00EE, 0x00EE, 0x00EE,
+	0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00F0, 0x00F0, 0x00F0, 0x00F0,
+	0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x70F0, 0x70F0,
+	0x07FF, 0x00F1, 0x00F2, 0x00F2, 0x00F3, 0x00F3, 0x00F3, 0x00F3, 0x00F4, 0x00F4, 0x00F4, 0x00F4,
+	0x00F4, 0x00F4, 0x00F4, 0x00F4, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5,
+	0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x00F5, 0x60F5, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF,
+	0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF,
+	0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF,
+	0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x00F6, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x00F7, 0x07FF, 0x07FF, 0x07FF, 0x00F8, 0x07FF, 0x00F9, 0x00FA, 0x60FA,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x00FB, 0x07FF, 0x07FF, 0x07FF, 0x00FC,
+	0x07FF, 0x00FD, 0x00FE, 0x00FE, 0x07FF, 0x07FF, 0x07FF, 0x00FF, 0x07FF, 0x0100, 0x0101, 0x0101,
+	0x07FF, 0x0102, 0x0103, 0x0103, 0x0104, 0x0104, 0x7104, 0x7104, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x0105, 0x07FF, 0x07FF, 0x07FF, 0x0106, 0x07FF, 0x0107, 0x0108, 0x0108,
+	0x07FF, 0x07FF, 0x07FF, 0x0109, 0x07FF, 0x010A, 0x010B, 0x010B, 0x07FF, 0x010C, 0x010D, 0x010D,
+	0x010E, 0x010E, 0x010E, 0x610E, 0x07FF, 0x07FF, 0x07FF, 0x010F, 0x07FF, 0x0110, 0x0111, 0x0111,
+	0x07FF, 0x0112, 0x0113, 0x0113, 0x0114, 0x0114, 0x0114, 0x0114, 0x07FF, 0x0115, 0x0116, 0x0116,
+	0x0117, 0x0117, 0x0117, 0x0117, 0x0118, 0x0118, 0x0118, 0x0118, 0x8118, 0x8118, 0x8118, 0x8118,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0119, 0x07FF, 0x07FF, 0x07FF, 0x011A,
+	0x07FF, 0x011B, 0x011C, 0x011C, 0x07FF, 0x07FF, 0x07FF, 0x011D, 0x07FF, 0x011E, 0x011F, 0x011F,
+	0x07FF, 0x0120, 0x0121, 0x0121, 0x0122, 0x0122, 0x0122, 0x6122, 0x07FF, 0x07FF, 0x07FF, 0x0123,
+	0x07FF, 0x0124, 0x0125, 0x0125, 0x07FF, 0x0126, 0x0127, 0x0127, 0x0128, 0x0128, 0x0128, 0x0128,
+	0x07FF, 0x0129, 0x012A, 0x012A, 0x012B, 0x012B, 0x012B, 0x012B, 0x012C, 0x012C, 0x012C, 0x012C,
+	0x012C, 0x012C, 0x712C, 0x712C, 0x07FF, 0x07FF, 0x07FF, 0x012D, 0x07FF, 0x012E, 0x012F, 0x012F,
+	0x07FF, 0x0130, 0x0131, 0x0131, 0x0132, 0x0132, 0x0132, 0x0132, 0x07FF, 0x0133, 0x0134, 0x0134,
+	0x0135, 0x0135, 0x0135, 0x0135, 0x0136, 0x0136, 0x0136, 0x0136, 0x0136, 0x0136, 0x0136, 0x6136,
+	0x07FF, 0x0137, 0x0138, 0x0138, 0x0139, 0x0139, 0x0139, 0x0139, 0x013A, 0x013A, 0x013A, 0x013A,
+	0x013A, 0x013A, 0x013A, 0x013A, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B, 0x013B,
+	0x913B, 0x913B, 0x913B, 0x913B, 0x913B, 0x913B, 0x913B, 0x913B, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x013C, 0x07FF, 0x07FF, 0x07FF, 0x013D, 0x07FF, 0x013E, 0x013F, 0x013F,
+	0x07FF, 0x07FF, 0x07FF, 0x0140, 0x07FF, 0x0141, 0x0142, 0x0142, 0x07FF, 0x0143, 0x0144, 0x0144,
+	0x0145, 0x0145, 0x0145, 0x6145, 0x07FF, 0x07FF, 0x07FF, 0x0146, 0x07FF, 0x0147, 0x0148, 0x0148,
+	0x07FF, 0x0149, 0x014A, 0x014A, 0x014B, 0x014B, 0x014B, 0x014B, 0x07FF, 0x014C, 0x014D, 0x014D,
+	0x014E, 0x014E, 0x014E, 0x014E, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x014F, 0x714F, 0x714F,
+	0x07FF, 0x07FF, 0x07FF, 0x0150, 0x07FF, 0x0151, 0x0152, 0x0152, 0x07FF, 0x0153, 0x0154, 0x0154,
+	0x0155, 0x0155, 0x0155, 0x0155, 0x07FF, 0x0156, 0x0157, 0x0157, 0x0158, 0x0158, 0x0158, 0x0158,
+	0x0159, 0x0159, 0x0159, 0x0159, 0x0159, 0x0159, 0x0159, 0x6159, 0x07FF, 0x015A, 0x015B, 0x015B,
+	0x015C, 0x015C, 0x015C, 0x015C, 0x015D, 0x015D, 0x015D, 0x015D, 0x015D, 0x015D, 0x015D, 0x015D,
+	0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E,
+	0x815E, 0x815E, 0x815E, 0x815E, 0x07FF, 0x07FF, 0x07FF, 0x015F, 0x07FF, 0x0160, 0x0161, 0x0161,
+	0x07FF, 0x0162, 0x0163, 0x0163, 0x0164, 0x0164, 0x0164, 0x0164, 0x07FF, 0x0165, 0x0166, 0x0166,
+	0x0167, 0x0167, 0x0167, 0x0167, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x0168, 0x6168,
+	0x07FF, 0x0169, 0x016A, 0x016A, 0x016B, 0x016B, 0x016B, 0x016B, 0x016C, 0x016C, 0x016C, 0x016C,
+	0x016C, 0x016C, 0x016C, 0x016C, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D,
+	0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x016D, 0x716D, 0x716D, 0x07FF, 0x016E, 0x016F, 0x016F,
+	0x0170, 0x0170, 0x0170, 0x0170, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171, 0x0171,
+	0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172, 0x0172,
+	0x0172, 0x0172, 0x0172, 0x6172, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173,
+	0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0x0173, 0xA173, 0xA173, 0xA173, 0xA173,
+	0xA173, 0xA173, 0xA173, 0xA173, 0xA173, 0xA173, 0xA173, 0xA173, 0xA173, 0xA173, 0xA173, 0xA173,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0174, 0x07FF, 0x07FF, 0x07FF, 0x0175,
+	0x07FF, 0x0176, 0x0177, 0x0177, 0x07FF, 0x07FF, 0x07FF, 0x0178, 0x07FF, 0x0179, 0x017A, 0x017A,
+	0x07FF, 0x017B, 0x017C, 0x017C, 0x017D, 0x017D, 0x017D, 0x617D, 0x07FF, 0x07FF, 0x07FF, 0x017E,
+	0x07FF, 0x017F, 0x0180, 0x0180, 0x07FF, 0x0181, 0x0182, 0x0182, 0x0183, 0x0183, 0x0183, 0x0183,
+	0x07FF, 0x0184, 0x0185, 0x0185, 0x0186, 0x0186, 0x0186, 0x0186, 0x0187, 0x0187, 0x0187, 0x0187,
+	0x0187, 0x0187, 0x7187, 0x7187, 0x07FF, 0x07FF, 0x07FF, 0x0188, 0x07FF, 0x0189, 0x018A, 0x018A,
+	0x07FF, 0x018B, 0x018C, 0x018C, 0x018D, 0x018D, 0x018D, 0x018D, 0x07FF, 0x018E, 0x018F, 0x018F,
+	0x0190, 0x0190, 0x0190, 0x0190, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x6191,
+	0x07FF, 0x0192, 0x0193, 0x0193, 0x0194, 0x0194, 0x0194, 0x0194, 0x0195, 0x0195, 0x0195, 0x0195,
+	0x0195, 0x0195, 0x0195, 0x0195, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196, 0x0196,
+	0x0196, 0x0196, 0x0196, 0x0196, 0x8196, 0x8196, 0x8196, 0x8196, 0x07FF, 0x07FF, 0x07FF, 0x0197,
+	0x07FF, 0x0198, 0x0199, 0x0199, 0x07FF, 0x019A, 0x019B, 0x019B, 0x019C, 0x019C, 0x019C, 0x019C,
+	0x07FF, 0x019D, 0x019E, 0x019E, 0x019F, 0x019F, 0x019F, 0x019F, 0x01A0, 0x01A0, 0x01A0, 0x01A0,
+	0x01A0, 0x01A0, 0x01A0, 0x61A0, 0x07FF, 0x01A1, 0x01A2, 0x01A2, 0x01A3, 0x01A3, 0x01A3, 0x01A3,
+	0x01A4, 0x01A4, 0x01A4, 0x01A4, 0x01A4, 0x01A4, 0x01A4, 0x01A4, 0x01A5, 0x01A5, 0x01A5, 0x01A5,
+	0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x01A5, 0x71A5, 0x71A5,
+	0x07FF, 0x01A6, 0x01A7, 0x01A7, 0x01A8, 0x01A8, 0x01A8, 0x01A8, 0x01A9, 0x01A9, 0x01A9, 0x01A9,
+	0x01A9, 0x01A9, 0x01A9, 0x01A9, 0x01AA, 0x01AA, 0x01AA, 0x01AA, 0x01AA, 0x01AA, 0x01AA, 0x01AA,
+	0x01AA, 0x01AA, 0x01AA, 0x01AA, 0x01AA, 0x01AA, 0x01AA, 0x61AA, 0x01AB, 0x01AB, 0x01AB, 0x01AB,
+	0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB,
+	0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x01AB, 0x91AB, 0x91AB, 0x91AB, 0x91AB,
+	0x91AB, 0x91AB, 0x91AB, 0x91AB, 0x07FF, 0x07FF, 0x07FF, 0x01AC, 0x07FF, 0x01AD, 0x01AE, 0x01AE,
+	0x07FF, 0x01AF, 0x01B0, 0x01B0, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x07FF, 0x01B2, 0x01B3, 0x01B3,
+	0x01B4, 0x01B4, 0x01B4, 0x01B4, 0x01B5, 0x01B5, 0x01B5, 0x01B5, 0x01B5, 0x01B5, 0x01B5, 0x61B5,
+	0x07FF, 0x01B6, 0x01B7, 0x01B7, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B9, 0x01B9, 0x01B9, 0x01B9,
+	0x01B9, 0x01B9, 0x01B9, 0x01B9, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA,
+	0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x01BA, 0x71BA, 0x71BA, 0x07FF, 0x01BB, 0x01BC, 0x01BC,
+	0x01BD, 0x01BD, 0x01BD, 0x01BD, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE,
+	0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF,
+	0x01BF, 0x01BF, 0x01BF, 0x61BF, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+	0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+	0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x81C0, 0x81C0, 0x81C0, 0x81C0,
+	0x07FF, 0x01C1, 0x01C2, 0x01C2, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C4, 0x01C4, 0x01C4, 0x01C4,
+	0x01C4, 0x01C4, 0x01C4, 0x01C4, 0x01C5, 0x01C5, 0x01C5, 0x01C5, 0x01C5, 0x01C5, 0x01C5, 0x01C5,
+	0x01C5, 0x01C5, 0x01C5, 0x01C5, 0x01C5, 0x01C5, 0x01C5, 0x61C5, 0x01C6, 0x01C6, 0x01C6, 0x01C6,
+	0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6,
+	0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6,
+	0x01C6, 0x01C6, 0x71C6, 0x71C6, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF,
+	0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF,
+	0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF,
+	0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF,
+	0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF,
+	0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x01C7,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x01C8, 0x07FF, 0x07FF, 0x07FF, 0x01C9,
+	0x07FF, 0x01CA, 0x01CB, 0x61CB, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x01CC,
+	0x07FF, 0x07FF, 0x07FF, 0x01CD, 0x07FF, 0x01CE, 0x01CF, 0x01CF, 0x07FF, 0x07FF, 0x07FF, 0x01D0,
+	0x07FF, 0x01D1, 0x01D2, 0x01D2, 0x07FF, 0x01D3, 0x01D4, 0x01D4, 0x01D5, 0x01D5, 0x71D5, 0x71D5,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x01D6, 0x07FF, 0x07FF, 0x07FF, 0x01D7,
+	0x07FF, 0x01D8, 0x01D9, 0x01D9, 0x07FF, 0x07FF, 0x07FF, 0x01DA, 0x07FF, 0x01DB, 0x01DC, 0x01DC,
+	0x07FF, 0x01DD, 0x01DE, 0x01DE, 0x01DF, 0x01DF, 0x01DF, 0x61DF, 0x07FF, 0x07FF, 0x07FF, 0x01E0,
+	0x07FF, 0x01E1, 0x01E2, 0x01E2, 0x07FF, 0x01E3, 0x01E4, 0x01E4, 0x01E5, 0x01E5, 0x01E5, 0x01E5,
+	0x07FF, 0x01E6, 0x01E7, 0x01E7, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E9, 0x01E9, 0x01E9, 0x01E9,
+	0x81E9, 0x81E9, 0x81E9, 0x81E9, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x01EA,
+	0x07FF, 0x07FF, 0x07FF, 0x01EB, 0x07FF, 0x01EC, 0x01ED, 0x01ED, 0x07FF, 0x07FF, 0x07FF, 0x01EE,
+	0x07FF, 0x01EF, 0x01F0, 0x01F0, 0x07FF, 0x01F1, 0x01F2, 0x01F2, 0x01F3, 0x01F3, 0x01F3, 0x61F3,
+	0x07FF, 0x07FF, 0x07FF, 0x01F4, 0x07FF, 0x01F5, 0x01F6, 0x01F6, 0x07FF, 0x01F7, 0x01F8, 0x01F8,
+	0x01F9, 0x01F9, 0x01F9, 0x01F9, 0x07FF, 0x01FA, 0x01FB, 0x01FB, 0x01FC, 0x01FC, 0x01FC, 0x01FC,
+	0x01FD, 0x01FD, 0x01FD, 0x01FD, 0x01FD, 0x01FD, 0x71FD, 0x71FD, 0x07FF, 0x07FF, 0x07FF, 0x01FE,
+	0x07FF, 0x01FF, 0x0200, 0x0200, 0x07FF, 0x0201, 0x0202, 0x0202, 0x0203, 0x0203, 0x0203, 0x0203,
+	0x07FF, 0x0204, 0x0205, 0x0205, 0x0206, 0x0206, 0x0206, 0x0206, 0x0207, 0x0207, 0x0207, 0x0207,
+	0x0207, 0x0207, 0x0207, 0x6207, 0x07FF, 0x0208, 0x0209, 0x0209, 0x020A, 0x020A, 0x020A, 0x020A,
+	0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020B, 0x020C, 0x020C, 0x020C, 0x020C,
+	0x020C, 0x020C, 0x020C, 0x020C, 0x920C, 0x920C, 0x920C, 0x920C, 0x920C, 0x920C, 0x920C, 0x920C,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x020D, 0x07FF, 0x07FF, 0x07FF, 0x020E,
+	0x07FF, 0x020F, 0x0210, 0x0210, 0x07FF, 0x07FF, 0x07FF, 0x0211, 0x07FF, 0x0212, 0x0213, 0x0213,
+	0x07FF, 0x0214, 0x0215, 0x0215, 0x0216, 0x0216, 0x0216, 0x6216, 0x07FF, 0x07FF, 0x07FF, 0x0217,
+	0x07FF, 0x0218, 0x0219, 0x0219, 0x07FF, 0x021A, 0x021B, 0x021B, 0x021C, 0x021C, 0x021C, 0x021C,
+	0x07FF, 0x021D, 0x021E, 0x021E, 0x021F, 0x021F, 0x021F, 0x021F, 0x0220, 0x0220, 0x0220, 0x0220,
+	0x0220, 0x0220, 0x7220, 0x7220, 0x07FF, 0x07FF, 0x07FF, 0x0221, 0x07FF, 0x0222, 0x0223, 0x0223,
+	0x07FF, 0x0224, 0x0225, 0x0225, 0x0226, 0x0226, 0x0226, 0x0226, 0x07FF, 0x0227, 0x0228, 0x0228,
+	0x0229, 0x0229, 0x0229, 0x0229, 0x022A, 0x022A, 0x022A, 0x022A, 0x022A, 0x022A, 0x022A, 0x622A,
+	0x07FF, 0x022B, 0x022C, 0x022C, 0x022D, 0x022D, 0x022D, 0x022D, 0x022E, 0x022E, 0x022E, 0x022E,
+	0x022E, 0x022E, 0x022E, 0x022E, 0x022F, 0x022F, 0x022F, 0x022F, 0x022F, 0x022F, 0x022F, 0x022F,
+	0x022F, 0x022F, 0x022F, 0x022F, 0x822F, 0x822F, 0x822F, 0x822F, 0x07FF, 0x07FF, 0x07FF, 0x0230,
+	0x07FF, 0x0231, 0x0232, 0x0232, 0x07FF, 0x0233, 0x0234, 0x0234, 0x0235, 0x0235, 0x0235, 0x0235,
+	0x07FF, 0x0236, 0x0237, 0x0237, 0x0238, 0x0238, 0x0238, 0x0238, 0x0239, 0x0239, 0x0239, 0x0239,
+	0x0239, 0x0239, 0x0239, 0x6239, 0x07FF, 0x023A, 0x023B, 0x023B, 0x023C, 0x023C, 0x023C, 0x023C,
+	0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023E, 0x023E, 0x023E, 0x023E,
+	0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x023E, 0x723E, 0x723E,
+	0x07FF, 0x023F, 0x0240, 0x0240, 0x0241, 0x0241, 0x0241, 0x0241, 0x0242, 0x0242, 0x0242, 0x0242,
+	0x0242, 0x0242, 0x0242, 0x0242, 0x0243, 0x0243, 0x0243, 0x0243, 0x0243, 0x0243, 0x0243, 0x0243,
+	0x0243, 0x0243, 0x0243, 0x0243, 0x0243, 0x0243, 0x0243, 0x6243, 0x0244, 0x0244, 0x0244, 0x0244,
+	0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244, 0x0244,
+	0xA244, 0xA244, 0xA244, 0xA244, 0xA244, 0xA244, 0xA244, 0xA244, 0xA244, 0xA244, 0xA244, 0xA244,
+	0xA244, 0xA244, 0xA244, 0xA244, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0245,
+	0x07FF, 0x07FF, 0x07FF, 0x0246, 0x07FF, 0x0247, 0x0248, 0x0248, 0x07FF, 0x07FF, 0x07FF, 0x0249,
+	0x07FF, 0x024A, 0x024B, 0x024B, 0x07FF, 0x024C, 0x024D, 0x024D, 0x024E, 0x024E, 0x024E, 0x624E,
+	0x07FF, 0x07FF, 0x07FF, 0x024F, 0x07FF, 0x0250, 0x0251, 0x0251, 0x07FF, 0x0252, 0x0253, 0x0253,
+	0x0254, 0x0254, 0x0254, 0x0254, 0x07FF, 0x0255, 0x0256, 0x0256, 0x0257, 0x0257, 0x0257, 0x0257,
+	0x0258, 0x0258, 0x0258, 0x0258, 0x0258, 0x0258, 0x7258, 0x7258, 0x07FF, 0x07FF, 0x07FF, 0x0259,
+	0x07FF, 0x025A, 0x025B, 0x025B, 0x07FF, 0x025C, 0x025D, 0x025D, 0x025E, 0x025E, 0x025E, 0x025E,
+	0x07FF, 0x025F, 0x0260, 0x0260, 0x0261, 0x0261, 0x0261, 0x0261, 0x0262, 0x0262, 0x0262, 0x0262,
+	0x0262, 0x0262, 0x0262, 0x6262, 0x07FF, 0x0263, 0x0264, 0x0264, 0x0265, 0x0265, 0x0265, 0x0265,
+	0x0266, 0x0266, 0x0266, 0x0266, 0x0266, 0x0266, 0x0266, 0x0266, 0x0267, 0x0267, 0x0267, 0x0267,
+	0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x0267, 0x8267, 0x8267, 0x8267, 0x8267,
+	0x07FF, 0x07FF, 0x07FF, 0x0268, 0x07FF, 0x0269, 0x026A, 0x026A, 0x07FF, 0x026B, 0x026C, 0x026C,
+	0x026D, 0x026D, 0x026D, 0x026D, 0x07FF, 0x026E, 0x026F, 0x026F, 0x0270, 0x0270, 0x0270, 0x0270,
+	0x0271, 0x0271, 0x0271, 0x0271, 0x0271, 0x0271, 0x0271, 0x6271, 0x07FF, 0x0272, 0x0273, 0x0273,
+	0x0274, 0x0274, 0x0274, 0x0274, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275, 0x0275,
+	0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276, 0x0276,
+	0x0276, 0x0276, 0x7276, 0x7276, 0x07FF, 0x0277, 0x0278, 0x0278, 0x0279, 0x0279, 0x0279, 0x0279,
+	0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027A, 0x027B, 0x027B, 0x027B, 0x027B,
+	0x027B, 0x027B, 0x027B, 0x027B, 0x027B, 0x027B, 0x027B, 0x027B, 0x027B, 0x027B, 0x027B, 0x627B,
+	0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C,
+	0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C, 0x027C,
+	0x927C, 0x927C, 0x927C, 0x927C, 0x927C, 0x927C, 0x927C, 0x927C, 0x07FF, 0x07FF, 0x07FF, 0x027D,
+	0x07FF, 0x027E, 0x027F, 0x027F, 0x07FF, 0x0280, 0x0281, 0x0281, 0x0282, 0x0282, 0x0282, 0x0282,
+	0x07FF, 0x0283, 0x0284, 0x0284, 0x0285, 0x0285, 0x0285, 0x0285, 0x0286, 0x0286, 0x0286, 0x0286,
+	0x0286, 0x0286, 0x0286, 0x6286, 0x07FF, 0x0287, 0x0288, 0x0288, 0x0289, 0x0289, 0x0289, 0x0289,
+	0x028A, 0x028A, 0x028A, 0x028A, 0x028A, 0x028A, 0x028A, 0x028A, 0x028B, 0x028B, 0x028B, 0x028B,
+	0x028B, 0x028B, 0x028B, 0x028B, 0x028B, 0x028B, 0x028B, 0x028B, 0x028B, 0x028B, 0x728B, 0x728B,
+	0x07FF, 0x028C, 0x028D, 0x028D, 0x028E, 0x028E, 0x028E, 0x028E, 0x028F, 0x028F, 0x028F, 0x028F,
+	0x028F, 0x028F, 0x028F, 0x028F, 0x0290, 0x0290, 0x0290, 0x0290, 0x0290, 0x0290, 0x0290, 0x0290,
+	0x0290, 0x0290, 0x0290, 0x0290, 0x0290, 0x0290, 0x0290, 0x6290, 0x0291, 0x0291, 0x0291, 0x0291,
+	0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291,
+	0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291, 0x0291,
+	0x8291, 0x8291, 0x8291, 0x8291, 0x07FF, 0x0292, 0x0293, 0x0293, 0x0294, 0x0294, 0x0294, 0x0294,
+	0x0295, 0x0295, 0x0295, 0x0295, 0x0295, 0x0295, 0x0295, 0x0295, 0x0296, 0x0296, 0x0296, 0x0296,
+	0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x0296, 0x6296,
+	0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297,
+	0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297,
+	0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x0297, 0x7297, 0x7297, 0x0298, 0x0298, 0x0298, 0x0298,
+	0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298,
+	0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298, 0x0298,
+	0x0298, 0x0298, 0x0298, 0x6298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298,
+	0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298,
+	0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298, 0xB298,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0299, 0x07FF, 0x07FF, 0x07FF, 0x029A,
+	0x07FF, 0x029B, 0x029C, 0x029C, 0x07FF, 0x07FF, 0x07FF, 0x029D, 0x07FF, 0x029E, 0x029F, 0x029F,
+	0x07FF, 0x02A0, 0x02A1, 0x02A1, 0x02A2, 0x02A2, 0x02A2, 0x62A2, 0x07FF, 0x07FF, 0x07FF, 0x02A3,
+	0x07FF, 0x02A4, 0x02A5, 0x02A5, 0x07FF, 0x02A6, 0x02A7, 0x02A7, 0x02A8, 0x02A8, 0x02A8, 0x02A8,
+	0x07FF, 0x02A9, 0x02AA, 0x02AA, 0x02AB, 0x02AB, 0x02AB, 0x02AB, 0x02AC, 0x02AC, 0x02AC, 0x02AC,
+	0x02AC, 0x02AC, 0x72AC, 0x72AC, 0x07FF, 0x07FF, 0x07FF, 0x02AD, 0x07FF, 0x02AE, 0x02AF, 0x02AF,
+	0x07FF, 0x02B0, 0x02B1, 0x02B1, 0x02B2, 0x02B2, 0x02B2, 0x02B2, 0x07FF, 0x02B3, 0x02B4, 0x02B4,
+	0x02B5, 0x02B5, 0x02B5, 0x02B5, 0x02B6, 0x02B6, 0x02B6, 0x02B6, 0x02B6, 0x02B6, 0x02B6, 0x62B6,
+	0x07FF, 0x02B7, 0x02B8, 0x02B8, 0x02B9, 0x02B9, 0x02B9, 0x02B9, 0x02BA, 0x02BA, 0x02BA, 0x02BA,
+	0x02BA, 0x02BA, 0x02BA, 0x02BA, 0x02BB, 0x02BB, 0x02BB, 0x02BB, 0x02BB, 0x02BB, 0x02BB, 0x02BB,
+	0x02BB, 0x02BB, 0x02BB, 0x02BB, 0x82BB, 0x82BB, 0x82BB, 0x82BB, 0x07FF, 0x07FF, 0x07FF, 0x02BC,
+	0x07FF, 0x02BD, 0x02BE, 0x02BE, 0x07FF, 0x02BF, 0x02C0, 0x02C0, 0x02C1, 0x02C1, 0x02C1, 0x02C1,
+	0x07FF, 0x02C2, 0x02C3, 0x02C3, 0x02C4, 0x02C4, 0x02C4, 0x02C4, 0x02C5, 0x02C5, 0x02C5, 0x02C5,
+	0x02C5, 0x02C5, 0x02C5, 0x62C5, 0x07FF, 0x02C6, 0x02C7, 0x02C7, 0x02C8, 0x02C8, 0x02C8, 0x02C8,
+	0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02C9, 0x02CA, 0x02CA, 0x02CA, 0x02CA,
+	0x02CA, 0x02CA, 0x02CA, 0x02CA, 0x02CA, 0x02CA, 0x02CA, 0x02CA, 0x02CA, 0x02CA, 0x72CA, 0x72CA,
+	0x07FF, 0x02CB, 0x02CC, 0x02CC, 0x02CD, 0x02CD, 0x02CD, 0x02CD, 0x02CE, 0x02CE, 0x02CE, 0x02CE,
+	0x02CE, 0x02CE, 0x02CE, 0x02CE, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF,
+	0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x62CF, 0x02D0, 0x02D0, 0x02D0, 0x02D0,
+	0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0,
+	0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x92D0, 0x92D0, 0x92D0, 0x92D0,
+	0x92D0, 0x92D0, 0x92D0, 0x92D0, 0x07FF, 0x07FF, 0x07FF, 0x02D1, 0x07FF, 0x02D2, 0x02D3, 0x02D3,
+	0x07FF, 0x02D4, 0x02D5, 0x02D5, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x07FF, 0x02D7, 0x02D8, 0x02D8,
+	0x02D9, 0x02D9, 0x02D9, 0x02D9, 0x02DA, 0x02DA, 0x02DA, 0x02DA, 0x02DA, 0x02DA, 0x02DA, 0x62DA,
+	0x07FF, 0x02DB, 0x02DC, 0x02DC, 0x02DD, 0x02DD, 0x02DD, 0x02DD, 0x02DE, 0x02DE, 0x02DE, 0x02DE,
+	0x02DE, 0x02DE, 0x02DE, 0x02DE, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF,
+	0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x72DF, 0x72DF, 0x07FF, 0x02E0, 0x02E1, 0x02E1,
+	0x02E2, 0x02E2, 0x02E2, 0x02E2, 0x02E3, 0x02E3, 0x02E3, 0x02E3, 0x02E3, 0x02E3, 0x02E3, 0x02E3,
+	0x02E4, 0x02E4, 0x02E4, 0x02E4, 0x02E4, 0x02E4, 0x02E4, 0x02E4, 0x02E4, 0x02E4, 0x02E4, 0x02E4,
+	0x02E4, 0x02E4, 0x02E4, 0x62E4, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+	0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+	0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x82E5, 0x82E5, 0x82E5, 0x82E5,
+	0x07FF, 0x02E6, 0x02E7, 0x02E7, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E9, 0x02E9, 0x02E9, 0x02E9,
+	0x02E9, 0x02E9, 0x02E9, 0x02E9, 0x02EA, 0x02EA, 0x02EA, 0x02EA, 0x02EA, 0x02EA, 0x02EA, 0x02EA,
+	0x02EA, 0x02EA, 0x02EA, 0x02EA, 0x02EA, 0x02EA, 0x02EA, 0x62EA, 0x02EB, 0x02EB, 0x02EB, 0x02EB,
+	0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB,
+	0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB,
+	0x02EB, 0x02EB, 0x72EB, 0x72EB, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC,
+	0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC,
+	0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x62EC,
+	0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC,
+	0x02EC, 0x02EC, 0x02EC, 0x02EC, 0xA2EC, 0xA2EC, 0xA2EC, 0xA2EC, 0xA2EC, 0xA2EC, 0xA2EC, 0xA2EC,
+	0xA2EC, 0xA2EC, 0xA2EC, 0xA2EC, 0xA2EC, 0xA2EC, 0xA2EC, 0xA2EC, 0x07FF, 0x07FF, 0x07FF, 0x02ED,
+	0x07FF, 0x02EE, 0x02EF, 0x02EF, 0x07FF, 0x02F0, 0x02F1, 0x02F1, 0x02F2, 0x02F2, 0x02F2, 0x02F2,
+	0x07FF, 0x02F3, 0x02F4, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F6, 0x02F6, 0x02F6, 0x02F6,
+	0x02F6, 0x02F6, 0x02F6, 0x62F6, 0x07FF, 0x02F7, 0x02F8, 0x02F8, 0x02F9, 0x02F9, 0x02F9, 0x02F9,
+	0x02FA, 0x02FA, 0x02FA, 0x02FA, 0x02FA, 0x02FA, 0x02FA, 0x02FA, 0x02FB, 0x02FB, 0x02FB, 0x02FB,
+	0x02FB, 0x02FB, 0x02FB, 0x02FB, 0x02FB, 0x02FB, 0x02FB, 0x02FB, 0x02FB, 0x02FB, 0x72FB, 0x72FB,
+	0x07FF, 0x02FC, 0x02FD, 0x02FD, 0x02FE, 0x02FE, 0x02FE, 0x02FE, 0x02FF, 0x02FF, 0x02FF, 0x02FF,
+	0x02FF, 0x02FF, 0x02FF, 0x02FF, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+	0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x6300, 0x0301, 0x0301, 0x0301, 0x0301,
+	0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+	0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+	0x8301, 0x8301, 0x8301, 0x8301, 0x07FF, 0x0302, 0x0303, 0x0303, 0x0304, 0x0304, 0x0304, 0x0304,
+	0x0305, 0x0305, 0x0305, 0x0305, 0x0305, 0x0305, 0x0305, 0x0305, 0x0306, 0x0306, 0x0306, 0x0306,
+	0x0306, 0x0306, 0x0306, 0x0306, 0x0306, 0x0306, 0x0306, 0x0306, 0x0306, 0x0306, 0x0306, 0x6306,
+	0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307,
+	0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307,
+	0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x7307, 0x7307, 0x0308, 0x0308, 0x0308, 0x0308,
+	0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308,
+	0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308,
+	0x0308, 0x0308, 0x0308, 0x6308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308,
+	0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308,
+	0x0308, 0x0308, 0x0308, 0x0308, 0x9308, 0x9308, 0x9308, 0x9308, 0x9308, 0x9308, 0x9308, 0x9308,
+	0x07FF, 0x0309, 0x030A, 0x030A, 0x030B, 0x030B, 0x030B, 0x030B, 0x030C, 0x030C, 0x030C, 0x030C,
+	0x030C, 0x030C, 0x030C, 0x030C, 0x030D, 0x030D, 0x030D, 0x030D, 0x030D, 0x030D, 0x030D, 0x030D,
+	0x030D, 0x030D, 0x030D, 0x030D, 0x030D, 0x030D, 0x030D, 0x630D, 0x030E, 0x030E, 0x030E, 0x030E,
+	0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E,
+	0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E,
+	0x030E, 0x030E, 0x730E, 0x730E, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F,
+	0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F,
+	0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x630F,
+	0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F,
+	0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F, 0x030F,
+	0x030F, 0x030F, 0x030F, 0x030F, 0x830F, 0x830F, 0x830F, 0x830F, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
+	0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
+	0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
+	0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
+	0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
+	0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
+	0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
+	0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
+	0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
+	0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
+	0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
+	0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x57FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x0310, 0x07FF, 0x07FF, 0x07FF, 0x0311, 0x07FF, 0x0312, 0x0313, 0x6313,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0314, 0x07FF, 0x07FF, 0x07FF, 0x0315,
+	0x07FF, 0x0316, 0x0317, 0x5317, 0x07FF, 0x07FF, 0x07FF, 0x0318, 0x07FF, 0x0319, 0x031A, 0x031A,
+	0x07FF, 0x031B, 0x031C, 0x031C, 0x031D, 0x031D, 0x731D, 0x731D, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x031E, 0x07FF, 0x07FF, 0x07FF, 0x031F, 0x07FF, 0x0320, 0x0321, 0x5321,
+	0x07FF, 0x07FF, 0x07FF, 0x0322, 0x07FF, 0x0323, 0x0324, 0x0324, 0x07FF, 0x0325, 0x0326, 0x0326,
+	0x0327, 0x0327, 0x0327, 0x6327, 0x07FF, 0x07FF, 0x07FF, 0x0328, 0x07FF, 0x0329, 0x032A, 0x032A,
+	0x07FF, 0x032B, 0x032C, 0x032C, 0x032D, 0x032D, 0x032D, 0x532D, 0x07FF, 0x032E, 0x032F, 0x032F,
+	0x0330, 0x0330, 0x0330, 0x0330, 0x0331, 0x0331, 0x0331, 0x0331, 0x8331, 0x8331, 0x8331, 0x8331,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0332, 0x07FF, 0x07FF, 0x07FF, 0x0333,
+	0x07FF, 0x0334, 0x0335, 0x5335, 0x07FF, 0x07FF, 0x07FF, 0x0336, 0x07FF, 0x0337, 0x0338, 0x0338,
+	0x07FF, 0x0339, 0x033A, 0x033A, 0x033B, 0x033B, 0x033B, 0x633B, 0x07FF, 0x07FF, 0x07FF, 0x033C,
+	0x07FF, 0x033D, 0x033E, 0x033E, 0x07FF, 0x033F, 0x0340, 0x0340, 0x0341, 0x0341, 0x0341, 0x5341,
+	0x07FF, 0x0342, 0x0343, 0x0343, 0x0344, 0x0344, 0x0344, 0x0344, 0x0345, 0x0345, 0x0345, 0x0345,
+	0x0345, 0x0345, 0x7345, 0x7345, 0x07FF, 0x07FF, 0x07FF, 0x0346, 0x07FF, 0x0347, 0x0348, 0x0348,
+	0x07FF, 0x0349, 0x034A, 0x034A, 0x034B, 0x034B, 0x034B, 0x534B, 0x07FF, 0x034C, 0x034D, 0x034D,
+	0x034E, 0x034E, 0x034E, 0x034E, 0x034F, 0x034F, 0x034F, 0x034F, 0x034F, 0x034F, 0x034F, 0x634F,
+	0x07FF, 0x0350, 0x0351, 0x0351, 0x0352, 0x0352, 0x0352, 0x0352, 0x0353, 0x0353, 0x0353, 0x0353,
+	0x0353, 0x0353, 0x0353, 0x5353, 0x0354, 0x0354, 0x0354, 0x0354, 0x0354, 0x0354, 0x0354, 0x0354,
+	0x9354, 0x9354, 0x9354, 0x9354, 0x9354, 0x9354, 0x9354, 0x9354, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x0355, 0x07FF, 0x07FF, 0x07FF, 0x0356, 0x07FF, 0x0357, 0x0358, 0x5358,
+	0x07FF, 0x07FF, 0x07FF, 0x0359, 0x07FF, 0x035A, 0x035B, 0x035B, 0x07FF, 0x035C, 0x035D, 0x035D,
+	0x035E, 0x035E, 0x035E, 0x635E, 0x07FF, 0x07FF, 0x07FF, 0x035F, 0x07FF, 0x0360, 0x0361, 0x0361,
+	0x07FF, 0x0362, 0x0363, 0x0363, 0x0364, 0x0364, 0x0364, 0x5364, 0x07FF, 0x0365, 0x0366, 0x0366,
+	0x0367, 0x0367, 0x0367, 0x0367, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x7368, 0x7368,
+	0x07FF, 0x07FF, 0x07FF, 0x0369, 0x07FF, 0x036A, 0x036B, 0x036B, 0x07FF, 0x036C, 0x036D, 0x036D,
+	0x036E, 0x036E, 0x036E, 0x536E, 0x07FF, 0x036F, 0x0370, 0x0370, 0x0371, 0x0371, 0x0371, 0x0371,
+	0x0372, 0x0372, 0x0372, 0x0372, 0x0372, 0x0372, 0x0372, 0x6372, 0x07FF, 0x0373, 0x0374, 0x0374,
+	0x0375, 0x0375, 0x0375, 0x0375, 0x0376, 0x0376, 0x0376, 0x0376, 0x0376, 0x0376, 0x0376, 0x5376,
+	0x0377, 0x0377, 0x0377, 0x0377, 0x0377, 0x0377, 0x0377, 0x0377, 0x0377, 0x0377, 0x0377, 0x0377,
+	0x8377, 0x8377, 0x8377, 0x8377, 0x07FF, 0x07FF, 0x07FF, 0x0378, 0x07FF, 0x0379, 0x037A, 0x037A,
+	0x07FF, 0x037B, 0x037C, 0x037C, 0x037D, 0x037D, 0x037D, 0x537D, 0x07FF, 0x037E, 0x037F, 0x037F,
+	0x0380, 0x0380, 0x0380, 0x0380, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x0381, 0x6381,
+	0x07FF, 0x0382, 0x0383, 0x0383, 0x0384, 0x0384, 0x0384, 0x0384, 0x0385, 0x0385, 0x0385, 0x0385,
+	0x0385, 0x0385, 0x0385, 0x5385, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386,
+	0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x7386, 0x7386, 0x07FF, 0x0387, 0x0388, 0x0388,
+	0x0389, 0x0389, 0x0389, 0x0389, 0x038A, 0x038A, 0x038A, 0x038A, 0x038A, 0x038A, 0x038A, 0x538A,
+	0x038B, 0x038B, 0x038B, 0x038B, 0x038B, 0x038B, 0x038B, 0x038B, 0x038B, 0x038B, 0x038B, 0x038B,
+	0x038B, 0x038B, 0x038B, 0x638B, 0x038C, 0x038C, 0x038C, 0x038C, 0x038C, 0x038C, 0x038C, 0x038C,
+	0x038C, 0x038C, 0x038C, 0x038C, 0x038C, 0x038C, 0x038C, 0x538C, 0xA38C, 0xA38C, 0xA38C, 0xA38C,
+	0xA38C, 0xA38C, 0xA38C, 0xA38C, 0xA38C, 0xA38C, 0xA38C, 0xA38C, 0xA38C, 0xA38C, 0xA38C, 0xA38C,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x038D, 0x07FF, 0x07FF, 0x07FF, 0x038E,
+	0x07FF, 0x038F, 0x0390, 0x5390, 0x07FF, 0x07FF, 0x07FF, 0x0391, 0x07FF, 0x0392, 0x0393, 0x0393,
+	0x07FF, 0x0394, 0x0395, 0x0395, 0x0396, 0x0396, 0x0396, 0x6396, 0x07FF, 0x07FF, 0x07FF, 0x0397,
+	0x07FF, 0x0398, 0x0399, 0x0399, 0x07FF, 0x039A, 0x039B, 0x039B, 0x039C, 0x039C, 0x039C, 0x539C,
+	0x07FF, 0x039D, 0x039E, 0x039E, 0x039F, 0x039F, 0x039F, 0x039F, 0x03A0, 0x03A0, 0x03A0, 0x03A0,
+	0x03A0, 0x03A0, 0x73A0, 0x73A0, 0x07FF, 0x07FF, 0x07FF, 0x03A1, 0x07FF, 0x03A2, 0x03A3, 0x03A3,
+	0x07FF, 0x03A4, 0x03A5, 0x03A5, 0x03A6, 0x03A6, 0x03A6, 0x53A6, 0x07FF, 0x03A7, 0x03A8, 0x03A8,
+	0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x63AA,
+	0x07FF, 0x03AB, 0x03AC, 0x03AC, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AE, 0x03AE, 0x03AE, 0x03AE,
+	0x03AE, 0x03AE, 0x03AE, 0x53AE, 0x03AF, 0x03AF, 0x03AF, 0x03AF, 0x03AF, 0x03AF, 0x03AF, 0x03AF,
+	0x03AF, 0x03AF, 0x03AF, 0x03AF, 0x83AF, 0x83AF, 0x83AF, 0x83AF, 0x07FF, 0x07FF, 0x07FF, 0x03B0,
+	0x07FF, 0x03B1, 0x03B2, 0x03B2, 0x07FF, 0x03B3, 0x03B4, 0x03B4, 0x03B5, 0x03B5, 0x03B5, 0x53B5,
+	0x07FF, 0x03B6, 0x03B7, 0x03B7, 0x03B8, 0x03B8, 0x03B8, 0x03B8, 0x03B9, 0x03B9, 0x03B9, 0x03B9,
+	0x03B9, 0x03B9, 0x03B9, 0x63B9, 0x07FF, 0x03BA, 0x03BB, 0x03BB, 0x03BC, 0x03BC, 0x03BC, 0x03BC,
+	0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x53BD, 0x03BE, 0x03BE, 0x03BE, 0x03BE,
+	0x03BE, 0x03BE, 0x03BE, 0x03BE, 0x03BE, 0x03BE, 0x03BE, 0x03BE, 0x03BE, 0x03BE, 0x73BE, 0x73BE,
+	0x07FF, 0x03BF, 0x03C0, 0x03C0, 0x03C1, 0x03C1, 0x03C1, 0x03C1, 0x03C2, 0x03C2, 0x03C2, 0x03C2,
+	0x03C2, 0x03C2, 0x03C2, 0x53C2, 0x03C3, 0x03C3, 0x03C3, 0x03C3, 0x03C3, 0x03C3, 0x03C3, 0x03C3,
+	0x03C3, 0x03C3, 0x03C3, 0x03C3, 0x03C3, 0x03C3, 0x03C3, 0x63C3, 0x03C4, 0x03C4, 0x03C4, 0x03C4,
+	0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x53C4,
+	0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x93C4, 0x93C4, 0x93C4, 0x93C4,
+	0x93C4, 0x93C4, 0x93C4, 0x93C4, 0x07FF, 0x07FF, 0x07FF, 0x03C5, 0x07FF, 0x03C6, 0x03C7, 0x03C7,
+	0x07FF, 0x03C8, 0x03C9, 0x03C9, 0x03CA, 0x03CA, 0x03CA, 0x53CA, 0x07FF, 0x03CB, 0x03CC, 0x03CC,
+	0x03CD, 0x03CD, 0x03CD, 0x03CD, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x63CE,
+	0x07FF, 0x03CF, 0x03D0, 0x03D0, 0x03D1, 0x03D1, 0x03D1, 0x03D1, 0x03D2, 0x03D2, 0x03D2, 0x03D2,
+	0x03D2, 0x03D2, 0x03D2, 0x53D2, 0x03D3, 0x03D3, 0x03D3, 0x03D3, 0x03D3, 0x03D3, 0x03D3, 0x03D3,
+	0x03D3, 0x03D3, 0x03D3, 0x03D3, 0x03D3, 0x03D3, 0x73D3, 0x73D3, 0x07FF, 0x03D4, 0x03D5, 0x03D5,
+	0x03D6, 0x03D6, 0x03D6, 0x03D6, 0x03D7, 0x03D7, 0x03D7, 0x03D7, 0x03D7, 0x03D7, 0x03D7, 0x53D7,
+	0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8,
+	0x03D8, 0x03D8, 0x03D8, 0x63D8, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9,
+	0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x53D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9,
+	0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x83D9, 0x83D9, 0x83D9, 0x83D9,
+	0x07FF, 0x03DA, 0x03DB, 0x03DB, 0x03DC, 0x03DC, 0x03DC, 0x03DC, 0x03DD, 0x03DD, 0x03DD, 0x03DD,
+	0x03DD, 0x03DD, 0x03DD, 0x53DD, 0x03DE, 0x03DE, 0x03DE, 0x03DE, 0x03DE, 0x03DE, 0x03DE, 0x03DE,
+	0x03DE, 0x03DE, 0x03DE, 0x03DE, 0x03DE, 0x03DE, 0x03DE, 0x63DE, 0x03DF, 0x03DF, 0x03DF, 0x03DF,
+	0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x53DF,
+	0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x03DF, 0x03DF,
+	0x03DF, 0x03DF, 0x73DF, 0x73DF, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0,
+	0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x53E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0,
+	0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x63E0,
+	0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0,
+	0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0,
+	0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0xB3E0, 0x07FF, 0x07FF, 0x07FF, 0x07FF,
+	0x07FF, 0x07FF, 0x07FF, 0x03E1, 0x07FF, 0x07FF, 0x07FF, 0x03E2, 0x07FF, 0x03E3, 0x03E4, 0x53E4,
+	0x07FF, 0x07FF, 0x07FF, 0x03E5, 0x07FF, 0x03E6, 0x03E7, 0x03E7, 0x07FF, 0x03E8, 0x03E9, 0x03E9,
+	0x03EA, 0x03EA, 0x03EA, 0x63EA, 0x07FF, 0x07FF, 0x07FF, 0x03EB, 0x07FF, 0x03EC, 0x03ED, 0x03ED,
+	0x07FF, 0x03EE, 0x03EF, 0x03EF, 0x03F0, 0x03F0, 0x03F0, 0x53F0, 0x07FF, 0x03F1, 0x03F2, 0x03F2,
+	0x03F3, 0x03F3, 0x03F3, 0x03F3, 0x03F4, 0x03F4, 0x03F4, 0x03F4, 0x03F4, 0x03F4, 0x73F4, 0x73F4,
+	0x07FF, 0x07FF, 0x07FF, 0x03F5, 0x07FF, 0x03F6, 0x03F7, 0x03F7, 0x07FF, 0x03F8, 0x03F9, 0x03F9,
+	0x03FA, 0x03FA, 0x03FA, 0x53FA, 0x07FF, 0x03FB, 0x03FC, 0x03FC, 0x03FD, 0x03FD, 0x03FD, 0x03FD,
+	0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x63FE, 0x07FF, 0x03FF, 0x0400, 0x0400,
+	0x0401, 0x0401, 0x0401, 0x0401, 0x0402, 0x0402, 0x0402, 0x0402, 0x0402, 0x0402, 0x0402, 0x5402,
+	0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403,
+	0x8403, 0x8403, 0x8403, 0x8403, 0x07FF, 0x07FF, 0x07FF, 0x0404, 0x07FF, 0x0405, 0x0406, 0x0406,
+	0x07FF, 0x0407, 0x0408, 0x0408, 0x0409, 0x0409, 0x0409, 0x5409, 0x07FF, 0x040A, 0x040B, 0x040B,
+	0x040C, 0x040C, 0x040C, 0x040C, 0x040D, 0x040D, 0x040D, 0x040D, 0x040D, 0x040D, 0x040D, 0x640D,
+	0x07FF, 0x040E, 0x040F, 0x040F, 0x0410, 0x0410, 0x0410, 0x0410, 0x0411, 0x0411, 0x0411, 0x0411,
+	0x0411, 0x0411, 0x0411, 0x5411, 0x0412, 0x0412, 0x0412, 0x0412, 0x0412, 0x0412, 0x0412, 0x0412,
+	0x0412, 0x0412, 0x0412, 0x0412, 0x0412, 0x0412, 0x7412, 0x7412, 0x07FF, 0x0413, 0x0414, 0x0414,
+	0x0415, 0x0415, 0x0415, 0x0415, 0x0416, 0x0416, 0x0416, 0x0416, 0x0416, 0x0416, 0x0416, 0x5416,
+	0x0417, 0x0417, 0x0417, 0x0417, 0x0417, 0x0417, 0x0417, 0x0417, 0x0417, 0x0417, 0x0417, 0x0417,
+	0x0417, 0x0417, 0x0417, 0x6417, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418,
+	0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x5418, 0x0418, 0x0418, 0x0418, 0x0418,
+	0x0418, 0x0418, 0x0418, 0x0418, 0x9418, 0x9418, 0x9418, 0x9418, 0x9418, 0x9418, 0x9418, 0x9418,
+	0x07FF, 0x07FF, 0x07FF, 0x0419, 0x07FF, 0x041A, 0x041B, 0x041B, 0x07FF, 0x041C, 0x041D, 0x041D,
+	0x041E, 0x041E, 0x041E, 0x541E, 0x07FF, 0x041F, 0x0420, 0x0420, 0x0421, 0x0421, 0x0421, 0x0421,
+	0x0422, 0x0422, 0x0422, 0x0422, 0x0422, 0x0422, 0x0422, 0x6422, 0x07FF, 0x0423, 0x0424, 0x0424,
+	0x0425, 0x0425, 0x0425, 0x0425, 0x0426, 0x0426, 0x0426, 0x0426, 0x0426, 0x0426, 0x0426, 0x5426,
+	0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427,
+	0x0427, 0x0427, 0x7427, 0x7427, 0x07FF, 0x0428, 0x0429, 0x0429, 0x042A, 0x042A, 0x042A, 0x042A,
+	0x042B, 0x042B, 0x042B, 0x042B, 0x042B, 0x042B, 0x042B, 0x542B, 0x042C, 0x042C, 0x042C, 0x042C,
+	0x042C, 0x042C, 0x042C, 0x042C, 0x042C, 0x042C, 0x042C, 0x042C, 0x042C, 0x042C, 0x042C, 0x642C,
+	0x042D, 0x042D, 0x042D, 0x042D, 0x042D, 0x042D, 0x042D, 0x042D, 0x042D, 0x042D, 0x042D, 0x042D,
+	0x042D, 0x042D, 0x042D, 0x542D, 0x042D, 0x042D, 0x042D, 0x042D, 0x042D, 0x042D, 0x042D, 0x042D,
+	0x042D, 0x042D, 0x042D, 0x042D, 0x842D, 0x842D, 0x842D, 0x842D, 0x07FF, 0x042E, 0x042F, 0x042F,
+	0x0430, 0x0430, 0x0430, 0x0430, 0x0431, 0x0431, 0x0431, 0x0431, 0x0431, 0x0431, 0x0431, 0x5431,
+	0x0432, 0x0432, 0x0432, 0x0432, 0x0432, 0x0432, 0x0432, 0x0432, 0x0432, 0x0432, 0x0432, 0x0432,
+	0x0432, 0x0432, 0x0432, 0x6432, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433,
+	0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x5433, 0x0433, 0x0433, 0x0433, 0x0433,
+	0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x7433, 0x7433,
+	0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434,
+	0x0434, 0x0434, 0x0434, 0x5434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434,
+	0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x6434, 0x0434, 0x0434, 0x0434, 0x0434,
+	0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x5434,
+	0xA434, 0xA434, 0xA434, 0xA434, 0xA434, 0xA434, 0xA434, 0xA434, 0xA434, 0xA434, 0xA434, 0xA434,
+	0xA434, 0xA434, 0xA434, 0xA434, 0x07FF, 0x07FF, 0x07FF, 0x0435, 0x07FF, 0x0436, 0x0437, 0x0437,
+	0x07FF, 0x0438, 0x0439, 0x0439, 0x043A, 0x043A, 0x043A, 0x543A, 0x07FF, 0x043B, 0x043C, 0x043C,
+	0x043D, 0x043D, 0x043D, 0x043D, 0x043E, 0x043E, 0x043E, 0x043E, 0x043E, 0x043E, 0x043E, 0x643E,
+	0x07FF, 0x043F, 0x0440, 0x0440, 0x0441, 0x0441, 0x0441, 0x0441, 0x0442, 0x0442, 0x0442, 0x0442,
+	0x0442, 0x0442, 0x0442, 0x5442, 0x0443, 0x0443, 0x0443, 0x0443, 0x0443, 0x0443, 0x0443, 0x0443,
+	0x0443, 0x0443, 0x0443, 0x0443, 0x0443, 0x0443, 0x7443, 0x7443, 0x07FF, 0x0444, 0x0445, 0x0445,
+	0x0446, 0x0446, 0x0446, 0x0446, 0x0447, 0x0447, 0x0447, 0x0447, 0x0447, 0x0447, 0x0447, 0x5447,
+	0x0448, 0x0448, 0x0448, 0x0448, 0x0448, 0x0448, 0x0448, 0x0448, 0x0448, 0x0448, 0x0448, 0x0448,
+	0x0448, 0x0448, 0x0448, 0x6448, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449,
+	0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x5449, 0x0449, 0x0449, 0x0449, 0x0449,
+	0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x0449, 0x8449, 0x8449, 0x8449, 0x8449,
+	0x07FF, 0x044A, 0x044B, 0x044B, 0x044C, 0x044C, 0x044C, 0x044C, 0x044D, 0x044D, 0x044D, 0x044D,
+	0x044D, 0x044D, 0x044D, 0x544D, 0x044E, 0x044E, 0x044E, 0x044E, 0x044E, 0x044E, 0x044E, 0x044E,
+	0x044E, 0x044E, 0x044E, 0x044E, 0x044E, 0x044E, 0x044E, 0x644E, 0x044F, 0x044F, 0x044F, 0x044F,
+	0x044F, 0x044F, 0x044F, 0x044F, 0x044F, 0x044F, 0x044F, 0x044F, 0x044F, 0x044F, 0x044F, 0x544F,
+	0x044F, 0x044F, 0x044F, 0x044F, 0x044F, 0x044F, 0x044F, 0x044F, 0x044F, 0x044F, 0x044F, 0x044F,
+	0x044F, 0x044F, 0x744F, 0x744F, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450,
+	0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x5450, 0x0450, 0x0450, 0x0450, 0x0450,
+	0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x6450,
+	0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450,
+	0x0450, 0x0450, 0x0450, 0x5450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450, 0x0450,
+	0x9450, 0x9450, 0x9450, 0x9450, 0x9450, 0x9450, 0x9450, 0x9450, 0x07FF, 0x0451, 0x0452, 0x0452,
+	0x0453, 0x0453, 0x0453, 0x0453, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454, 0x5454,
+	0x0455, 0x0455, 0x0455, 0x0455, 0x0455, 0x0455, 0x0455, 0x0455, 0x0455, 0x0455, 0x0455, 0x0455,
+	0x0455, 0x0455, 0x0455, 0x6455, 0x0456, 0x0456, 0x0456, 0x0456, 0x0456, 0x0456, 0x0456, 0x0456,
+	0x0456, 0x0456, 0x0456, 0x0456, 0x0456, 0x0456, 0x0456, 0x5456, 0x0456, 0x0456, 0x0456, 0x0456,
+	0x0456, 0x0456, 0x0456, 0x0456, 0x0456, 0x0456, 0x0456, 0x0456, 0x0456, 0x0456, 0x7456, 0x7456,
+	0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457,
+	0x0457, 0x0457, 0x0457, 0x5457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457,
+	0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x6457, 0x0457, 0x0457, 0x0457, 0x0457,
+	0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x5457,
+	0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457,
+	0x8457, 0x8457, 0x8457, 0x8457, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458,
+	0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x5458, 0x0458, 0x0458, 0x0458, 0x0458,
+	0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x6458,
+	0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458,
+	0x0458, 0x0458, 0x0458, 0x5458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458,
+	0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x0458, 0x7458, 0x7458, 0xC458, 0xC458, 0xC458, 0xC458,
+	0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458,
+	0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458,
+	0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458,
+	0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458,
+	0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458, 0xC458,
+	0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0459, 0x07FF, 0x07FF, 0x07FF, 0x045A,
+	0x07FF, 0x045B, 0x045C, 0x545C, 0x07FF, 0x07FF, 0x07FF, 0x045D, 0x07FF, 0x045E, 0x045F, 0x045F,
+	0x07FF, 0x0460, 0x0461, 0x0461, 0x0462, 0x0462, 0x0462, 0x6462, 0x07FF, 0x07FF, 0x07FF, 0x0463,
+	0x07FF, 0x0464, 0x0465, 0x0465, 0x07FF, 0x0466, 0x0467, 0x0467, 0x0468, 0x0468, 0x0468, 0x5468,
+	0x07FF, 0x0469, 0x046A, 0x046A, 0x046B, 0x046B, 0x046B, 0x046B, 0x046C, 0x046C, 0x046C, 0x046C,
+	0x046C, 0x046C, 0x746C, 0x746C, 0x07FF, 0x07FF, 0x07FF, 0x046D, 0x07FF, 0x046E, 0x046F, 0x046F,
+	0x07FF, 0x0470, 0x0471, 0x0471, 0x0472, 0x0472, 0x0472, 0x5472, 0x07FF, 0x0473, 0x0474, 0x0474,
+	0x0475, 0x0475, 0x0475, 0x0475, 0x0476, 0x0476, 0x0476, 0x0476, 0x0476, 0x0476, 0x0476, 0x6476,
+	0x07FF, 0x0477, 0x0478, 0x0478, 0x0479, 0x0479, 0x0479, 0x0479, 0x047A, 0x047A, 0x047A, 0x047A,
+	0x047A, 0x047A, 0x047A, 0x547A, 0x047B, 0x047B, 0x047B, 0x047B, 0x047B, 0x047B, 0x047B, 0x047B,
+	0x047B, 0x047B, 0x047B, 0x047B, 0x847B, 0x847B, 0x847B, 0x847B, 0x07FF, 0x07FF, 0x07FF, 0x047C,
+	0x07FF, 0x047D, 0x047E, 0x047E, 0x07FF, 0x047F, 0x0480, 0x0480, 0x0481, 0x0481, 0x0481, 0x5481,
+	0x07FF, 0x0482, 0x0483, 0x0483, 0x0484, 0x0484, 0x0484, 0x0484, 0x0485, 0x0485, 0x0485, 0x0485,
+	0x0485, 0x0485, 0x0485, 0x6485, 0x07FF, 0x0486, 0x0487, 0x0487, 0x0488, 0x0488, 0x0488, 0x0488,
+	0x0489, 0x0489, 0x0489, 0x0489, 0x0489, 0x0489, 0x0489, 0x5489, 0x048A, 0x048A, 0x048A, 0x048A,
+	0x048A, 0x048A, 0x048A, 0x048A, 0x048A, 0x048A, 0x048A, 0x048A, 0x048A, 0x048A, 0x748A, 0x748A,
+	0x07FF, 0x048B, 0x048C, 0x048C, 0x048D, 0x048D, 0x048D, 0x048D, 0x048E, 0x048E, 0x048E, 0x048E,
+	0x048E, 0x048E, 0x048E, 0x548E, 0x048F, 0x048F, 0x048F, 0x048F, 0x048F, 0x048F, 0x048F, 0x048F,
+	0x048F, 0x048F, 0x048F, 0x048F, 0x048F, 0x048F, 0x048F, 0x648F, 0x0490, 0x0490, 0x0490, 0x0490,
+	0x0490, 0x0490, 0x0490, 0x0490, 0x0490, 0x0490, 0x0490, 0x0490, 0x0490, 0x0490, 0x0490, 0x5490,
+	0x0490, 0x0490, 0x0490, 0x0490, 0x0490, 0x0490, 0x0490, 0x0490, 0x9490, 0x9490, 0x9490, 0x9490,
+	0x9490, 0x9490, 0x9490, 0x9490, 0x07FF, 0x07FF, 0x07FF, 0x0491, 0x07FF, 0x0492, 0x0493, 0x0493,
+	0x07FF, 0x0494, 0x0495, 0x0495, 0x0496, 0x0496, 0x0496, 0x5496, 0x07FF, 0x0497, 0x0498, 0x0498,
+	0x0499, 0x0499, 0x0499, 0x0499, 0x049A, 0x049A, 0x049A, 0x049A, 0x049A, 0x049A, 0x049A, 0x649A,
+	0x07FF, 0x049B, 0x049C, 0x049C, 0x049D, 0x049D, 0x049D, 0x049D, 0x049E, 0x049E, 0x049E, 0x049E,
+	0x049E, 0x049E, 0x049E, 0x549E, 0x049F, 0x049F, 0x049F, 0x049F, 0x049F, 0x049F, 0x049F, 0x049F,
+	0x049F, 0x049F, 0x049F, 0x049F, 0x049F, 0x049F, 0x749F, 0x749F, 0x07FF, 0x04A0, 0x04A1, 0x04A1,
+	0x04A2, 0x04A2, 0x04A2, 0x04A2, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x54A3,
+	0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4,
+	0x04A4, 0x04A4, 0x04A4, 0x64A4, 0x04A5, 0x04A5, 0x04A5, 0x04A5, 0x04A5, 0x04A5, 0x04A5, 0x04A5,
+	0x04A5, 0x04A5, 0x04A5, 0x04A5, 0x04A5, 0x04A5, 0x04A5, 0x54A5, 0x04A5, 0x04A5, 0x04A5, 0x04A5,
+	0x04A5, 0x04A5, 0x04A5, 0x04A5, 0x04A5, 0x04A5, 0x04A5, 0x04A5, 0x84A5, 0x84A5, 0x84A5, 0x84A5,
+	0x07FF, 0x04A6, 0x04A7, 0x04A7, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A9, 0x04A9, 0x04A9, 0x04A9,
+	0x04A9, 0x04A9, 0x04A9, 0x54A9, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA,
+	0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x64AA, 0x04AB, 0x04AB, 0x04AB, 0x04AB,
+	0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x54AB,
+	0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB, 0x04AB,
+	0x04AB, 0x04AB, 0x74AB, 0x74AB, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC,
+	0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x54AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC,
+	0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x64AC,
+	0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC,
+	0x04AC, 0x04AC, 0x04AC, 0x54AC, 0xA4AC, 0xA4AC, 0xA4AC, 0xA4AC, 0xA4AC, 0xA4AC, 0xA4AC, 0xA4AC,
+	0xA4AC, 0xA4AC, 0xA4AC, 0xA4AC, 0xA4AC, 0xA4AC, 0xA4AC, 0xA4AC, 0x07FF, 0x07FF, 0x07FF, 0x04AD,
+	0x07FF, 0x04AE, 0x04AF, 0x04AF, 0x07FF, 0x04B0, 0x04B1, 0x04B1, 0x04B2, 0x04B2, 0x04B2, 0x54B2,
+	0x07FF, 0x04B3, 0x04B4, 0x04B4, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B6, 0x04B6, 0x04B6, 0x04B6,
+	0x04B6, 0x04B6, 0x04B6, 0x64B6, 0x07FF, 0x04B7, 0x04B8, 0x04B8, 0x04B9, 0x04B9, 0x04B9, 0x04B9,
+	0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x54BA, 0x04BB, 0x04BB, 0x04BB, 0x04BB,
+	0x04BB, 0x04BB, 0x04BB, 0x04BB, 0x04BB, 0x04BB, 0x04BB, 0x04BB, 0x04BB, 0x04BB, 0x74BB, 0x74BB,
+	0x07FF, 0x04BC, 0x04BD, 0x04BD, 0x04BE, 0x04BE, 0x04BE, 0x04BE, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+	0x04BF, 0x04BF, 0x04BF, 0x54BF, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0,
+	0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x64C0, 0x04C1, 0x04C1, 0x04C1, 0x04C1,
+	0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x54C1,
+	0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1,
+	0x84C1, 0x84C1, 0x84C1, 0x84C1, 0x07FF, 0x04C2, 0x04C3, 0x04C3, 0x04C4, 0x04C4, 0x04C4, 0x04C4,
+	0x04C5, 0x04C5, 0x04C5, 0x04C5, 0x04C5, 0x04C5, 0x04C5, 0x54C5, 0x04C6, 0x04C6, 0x04C6, 0x04C6,
+	0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x64C6,
+	0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7,
+	0x04C7, 0x04C7, 0x04C7, 0x54C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7,
+	0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x74C7, 0x74C7, 0x04C8, 0x04C8, 0x04C8, 0x04C8,
+	0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x54C8,
+	0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8,
+	0x04C8, 0x04C8, 0x04C8, 0x64C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8,
+	0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x54C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8,
+	0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x94C8, 0x94C8, 0x94C8, 0x94C8, 0x94C8, 0x94C8, 0x94C8, 0x94C8,
+	0x07FF, 0x04C9, 0x04CA, 0x04CA, 0x04CB, 0x04CB, 0x04CB, 0x04CB, 0x04CC, 0x04CC, 0x04CC, 0x04CC,
+	0x04CC, 0x04CC, 0x04CC, 0x54CC, 0x04CD, 0x04CD, 0x04CD, 0x04CD, 0x04CD, 0x04CD, 0x04CD, 0x04CD,
+	0x04CD, 0x04CD, 0x04CD, 0x04CD, 0x04CD, 0x04CD, 0x04CD, 0x64CD, 0x04CE, 0x04CE, 0x04CE, 0x04CE,
+	0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x54CE,
+	0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x04CE, 0x04CE,
+	0x04CE, 0x04CE, 0x74CE, 0x74CE, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF,
+	0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x54CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF,
+	0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x64CF,
+	0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF,
+	0x04CF, 0x04CF, 0x04CF, 0x54CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF,
+	0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x84CF, 0x84CF, 0x84CF, 0x84CF, 0x04D0, 0x04D0, 0x04D0, 0x04D0,
+	0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x54D0,
+	0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0,
+	0x04D0, 0x04D0, 0x04D0, 0x64D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0,
+	0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x54D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0,
+	0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x74D0, 0x74D0,
+	0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0,
+	0x04D0, 0x04D0, 0x04D0, 0x54D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0,
+	0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x04D0, 0x64D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0,
+	0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0,
+	0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0,
+	0xB4D0, 0xB4D0, 0xB4D0, 0xB4D0, 0x07FF, 0x07FF, 0x07FF, 0x04D1, 0x07FF, 0x04D2, 0x04D3, 0x04D3,
+	0x07FF, 0x04D4, 0x04D5, 0x04D5, 0x04D6, 0x04D6, 0x04D6, 0x54D6, 0x07FF, 0x04D7, 0x04D8, 0x04D8,
+	0x04D9, 0x04D9, 0x04D9, 0x04D9, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x64DA,
+	0x07FF, 0x04DB, 0x04DC, 0x04DC, 0x04DD, 0x04DD, 0x04DD, 0x04DD, 0x04DE, 0x04DE, 0x04DE, 0x04DE,
+	0x04DE, 0x04DE, 0x04DE, 0x54DE, 0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x04DF,
+	0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x04DF, 0x74DF, 0x74DF, 0x07FF, 0x04E0, 0x04E1, 0x04E1,
+	0x04E2, 0x04E2, 0x04E2, 0x04E2, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x54E3,
+	0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4,
+	0x04E4, 0x04E4, 0x04E4, 0x64E4, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5,
+	0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x54E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5,
+	0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x84E5, 0x84E5, 0x84E5, 0x84E5,
+	0x07FF, 0x04E6, 0x04E7, 0x04E7, 0x04E8, 0x04E8, 0x04E8, 0x04E8, 0x04E9, 0x04E9, 0x04E9, 0x04E9,
+	0x04E9, 0x04E9, 0x04E9, 0x54E9, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA,
+	0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x04EA, 0x64EA, 0x04EB, 0x04EB, 0x04EB, 0x04EB,
+	0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x54EB,
+	0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB,
+	0x04EB, 0x04EB, 0x74EB, 0x74EB, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC,
+	0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x54EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC,
+	0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x64EC,
+	0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC,
+	0x04EC, 0x04EC, 0x04EC, 0x54EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC,
+	0x94EC, 0x94EC, 0x94EC, 0x94EC, 0x94EC, 0x94EC, 0x94EC, 0x94EC, 0x07FF, 0x04ED, 0x04EE, 0x04EE,
+	0x04EF, 0x04EF, 0x04EF, 0x04EF, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x54F0,
+	0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1,
+	0x04F1, 0x04F1, 0x04F1, 0x64F1, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2,
+	0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x54F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2,
+	0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x74F2, 0x74F2,
+	0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3,
+	0x04F3, 0x04F3, 0x04F3, 0x54F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3,
+	0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x64F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3,
+	0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x54F3,
+	0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x04F3,
+	0x84F3, 0x84F3, 0x84F3, 0x84F3, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4,
+	0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x54F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4,
+	0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x64F4,
+	0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4,
+	0x04F4, 0x04F4, 0x04F4, 0x54F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4,
+	0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x74F4, 0x74F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4,
+	0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x54F4,
+	0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4,
+	0x04F4, 0x04F4, 0x04F4, 0x64F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4,
+	0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x54F4, 0xA4F4, 0xA4F4, 0xA4F4, 0xA4F4,
+	0xA4F4, 0xA4F4, 0xA4F4, 0xA4F4, 0xA4F4, 0xA4F4, 0xA4F4, 0xA4F4, 0xA4F4, 0xA4F4, 0xA4F4, 0xA4F4,
+	0x07FF, 0x04F5, 0x04F6, 0x04F6, 0x04F7, 0x04F7, 0x04F7, 0x04F7, 0x04F8, 0x04F8, 0x04F8, 0x04F8,
+	0x04F8, 0x04F8, 0x04F8, 0x54F8, 0x04F9, 0x04F9, 0x04F9, 0x04F9, 0x04F9, 0x04F9, 0x04F9, 0x04F9,
+	0x04F9, 0x04F9, 0x04F9, 0x04F9, 0x04F9, 0x04F9, 0x04F9, 0x64F9, 0x04FA, 0x04FA, 0x04FA, 0x04FA,
+	0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x54FA,
+	0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA,
+	0x04FA, 0x04FA, 0x74FA, 0x74FA, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB,
+	0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x54FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB,
+	0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x64FB,
+	0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB,
+	0x04FB, 0x04FB, 0x04FB, 0x54FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x04FB,
+	0x04FB, 0x04FB, 0x04FB, 0x04FB, 0x84FB, 0x84FB, 0x84FB, 0x84FB, 0x04FC, 0x04FC, 0x04FC, 0x04FC,
+	0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x54FC,
+	0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC,
+	0x04FC, 0x04FC, 0x04FC, 0x64FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC,
+	0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x54FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC,
+	0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x74FC, 0x74FC,
+	0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC,
+	0x04FC, 0x04FC, 0x04FC, 0x54FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC,
+	0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x64FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC,
+	0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x54FC,
+	0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x94FC, 0x94FC, 0x94FC, 0x94FC,
+	0x94FC, 0x94FC, 0x94FC, 0x94FC, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+	0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
+};
+
+const uint8_t fiveRankTable[1277][5] RANK_TABLE = {
+	{7,5,4,3,2}, {7,6,4,3,2}, {7,6,5,3,2}, {7,6,5,4,2}, {8,5,4,3,2}, {8,6,4,3,2},
+	{8,6,5,3,2}, {8,6,5,4,2}, {8,6,5,4,3}, {8,7,4,3,2}, {8,7,5,3,2}, {8,7,5,4,2},
+	{8,7,5,4,3}, {8,7,6,3,2}, {8,7,6,4,2}, {8,7,6,4,3}, {8,7,6,5,2}, {8,7,6,5,3},
+	{9,5,4,3,2}, {9,6,4,3,2}, {9,6,5,3,2}, {9,6,5,4,2}, {9,6,5,4,3}, {9,7,4,3,2},
+	{9,7,5,3,2}, {9,7,5,4,2}, {9,7,5,4,3}, {9,7,6,3,2}, {9,7,6,4,2}, {9,7,6,4,3},
+	{9,7,6,5,2}, {9,7,6,5,3}, {9,7,6,5,4}, {9,8,4,3,2}, {9,8,5,3,2}, {9,8,5,4,2},
+	{9,8,5,4,3}, {9,8,6,3,2}, {9,8,6,4,2}, {9,8,6,4,3}, {9,8,6,5,2}, {9,8,6,5,3},
+	{9,8,6,5,4}, {9,8,7,3,2}, {9,8,7,4,2}, {9,8,7,4,3}, {9,8,7,5,2}, {9,8,7,5,3},
+	{9,8,7,5,4}, {9,8,7,6,2}, {9,8,7,6,3}, {9,8,7,6,4}, {10,5,4,3,2}, {10,6,4,3,2},
+	{10,6,5,3,2}, {10,6,5,4,2}, {10,6,5,4,3}, {10,7,4,3,2}, {10,7,5,3,2}, {10,7,5,4,2},
+	{10,7,5,4,3}, {10,7,6,3,2}, {10,7,6,4,2}, {10,7,6,4,3}, {10,7,6,5,2}, {10,7,6,5,3},
+	{10,7,6,5,4}, {10,8,4,3,2}, {10,8,5,3,2}, {10,8,5,4,2}, {10,8,5,4,3}, {10,8,6,3,2},
+	{10,8,6,4,2}, {10,8,6,4,3}, {10,8,6,5,2}, {10,8,6,5,3}, {10,8,6,5,4}, {10,8,7,3,2},
+	{10,8,7,4,2}, {10,8,7,4,3}, {10,8,7,5,2}, {10,8,7,5,3}, {10,8,7,5,4}, {10,8,7,6,2},
+	{10,8,7,6,3}, {10,8,7,6,4}, {10,8,7,6,5}, {10,9,4,3,2}, {10,9,5,3,2}, {10,9,5,4,2},
+	{10,9,5,4,3}, {10,9,6,3,2}, {10,9,6,4,2}, {10,9,6,4,3}, {10,9,6,5,2}, {10,9,6,5,3},
+	{10,9,6,5,4}, {10,9,7,3,2}, {10,9,7,4,2}, {10,9,7,4,3}, {10,9,7,5,2}, {10,9,7,5,3},
+	{10,9,7,5,4}, {10,9,7,6,2}, {10,9,7,6,3}, {10,9,7,6,4}, {10,9,7,6,5}, {10,9,8,3,2},
+	{10,9,8,4,2}, {10,9,8,4,3}, {10,9,8,5,2}, {10,9,8,5,3}, {10,9,8,5,4}, {10,9,8,6,2},
+	{10,9,8,6,3}, {10,9,8,6,4}, {10,9,8,6,5}, {10,9,8,7,2}, {10,9,8,7,3}, {10,9,8,7,4},
+	{10,9,8,7,5}, {11,5,4,3,2}, {11,6,4,3,2}, {11,6,5,3,2}, {11,6,5,4,2}, {11,6,5,4,3},
+	{11,7,4,3,2}, {11,7,5,3,2}, {11,7,5,4,2}, {11,7,5,4,3}, {11,7,6,3,2}, {11,7,6,4,2},
+	{11,7,6,4,3}, {11,7,6,5,2}, {11,7,6,5,3}, {11,7,6,5,4}, {11,8,4,3,2}, {11,8,5,3,2},
+	{11,8,5,4,2}, {11,8,5,4,3}, {11,8,6,3,2}, {11,8,6,4,2}, {11,8,6,4,3}, {11,8,6,5,2},
+	{11,8,6,5,3}, {11,8,6,5,4}, {11,8,7,3,2}, {11,8,7,4,2}, {11,8,7,4,3}, {11,8,7,5,2},
+	{11,8,7,5,3}, {11,8,7,5,4}, {11,8,7,6,2}, {11,8,7,6,3}, {11,8,7,6,4}, {11,8,7,6,5},
+	{11,9,4,3,2}, {11,9,5,3,2}, {11,9,5,4,2}, {11,9,5,4,3}, {11,9,6,3,2}, {11,9,6,4,2},
+	{11,9,6,4,3}, {11,9,6,5,2}, {11,9,6,5,3}, {11,9,6,5,4}, {11,9,7,3,2}, {11,9,7,4,2},
+	{11,9,7,4,3}, {11,9,7,5,2}, {11,9,7,5,3}, {11,9,7,5,4}, {11,9,7,6,2}, {11,9,7,6,3},
+	{11,9,7,6,4}, {11,9,7,6,5}, {11,9,8,3,2}, {11,9,8,4,2}, {11,9,8,4,3}, {11,9,8,5,2},
+	{11,9,8,5,3}, {11,9,8,5,4}, {11,9,8,6,2}, {11,9,8,6,3}, {11,9,8,6,4}, {11,9,8,6,5},
+	{11,9,8,7,2}, {11,9,8,7,3}, {11,9,8,7,4}, {11,9,8,7,5}, {11,9,8,7,6}, {11,10,4,3,2},
+	{11,10,5,3,2}, {11,10,5,4,2}, {11,10,5,4,3}, {11,10,6,3,2}, {11,10,6,4,2}, {11,10,6,4,3},
+	{11,10,6,5,2}, {11,10,6,5,3}, {11,10,6,5,4}, {11,10,7,3,2}, {11,10,7,4,2}, {11,10,7,4,3},
+	{11,10,7,5,2}, {11,10,7,5,3}, {11,10,7,5,4}, {11,10,7,6,2}, {11,10,7,6,3}, {11,10,7,6,4},
+	{11,10,7,6,5}, {11,10,8,3,2}, {11,10,8,4,2}, {11,10,8,4,3}, {11,10,8,5,2}, {11,10,8,5,3},
+	{11,10,8,5,4}, {11,10,8,6,2}, {11,10,8,6,3}, {11,10,8,6,4}, {11,10,8,6,5}, {11,10,8,7,2},
+	{11,10,8,7,3}, {11,10,8,7,4}, {11,10,8,7,5}, {11,10,8,7,6}, {11,10,9,3,2}, {11,10,9,4,2},
+	{11,10,9,4,3}, {11,10,9,5,2}, {11,10,9,5,3}, {11,10,9,5,4}, {11,10,9,6,2}, {11,10,9,6,3},
+	{11,10,9,6,4}, {11,10,9,6,5}, {11,10,9,7,2}, {11,10,9,7,3}, {11,10,9,7,4}, {11,10,9,7,5},
+	{11,10,9,7,6}, {11,10,9,8,2}, {11,10,9,8,3}, {11,10,9,8,4}, {11,10,9,8,5}, {11,10,9,8,6},
+	{12,5,4,3,2}, {12,6,4,3,2}, {12,6,5,3,2}, {12,6,5,4,2}, {12,6,5,4,3}, {12,7,4,3,2},
+	{12,7,5,3,2}, {12,7,5,4,2}, {12,7,5,4,3}, {12,7,6,3,2}, {12,7,6,4,2}, {12,7,6,4,3},
+	{12,7,6,5,2}, {12,7,6,5,3}, {12,7,6,5,4}, {12,8,4,3,2}, {12,8,5,3,2}, {12,8,5,4,2},
+	{12,8,5,4,3}, {12,8,6,3,2}, {12,8,6,4,2}, {12,8,6,4,3}, {12,8,6,5,2}, {12,8,6,5,3},
+	{12,8,6,5,4}, {12,8,7,3,2}, {12,8,7,4,2}, {12,8,7,4,3}, {12,8,7,5,2}, {12,8,7,5,3},
+	{12,8,7,5,4}, {12,8,7,6,2}, {12,8,7,6,3}, {12,8,7,6,4}, {12,8,7,6,5}, {12,9,4,3,2},
+	{12,9,5,3,2}, {12,9,5,4,2}, {12,9,5,4,3}, {12,9,6,3,2}, {12,9,6,4,2}, {12,9,6,4,3},
+	{12,9,6,5,2}, {12,9,6,5,3}, {12,9,6,5,4}, {12,9,7,3,2}, {12,9,7,4,2}, {12,9,7,4,3},
+	{12,9,7,5,2}, {12,9,7,5,3}, {12,9,7,5,4}, {12,9,7,6,2}, {12,9,7,6,3}, {12,9,7,6,4},
+	{12,9,7,6,5}, {12,9,8,3,2}, {12,9,8,4,2}, {12,9,8,4,3}, {12,9,8,5,2}, {12,9,8,5,3},
+	{12,9,8,5,4}, {12,9,8,6,2}, {12,9,8,6,3}, {12,9,8,6,4}, {12,9,8,6,5}, {12,9,8,7,2},
+	{12,9,8,7,3}, {12,9,8,7,4}, {12,9,8,7,5}, {12,9,8,7,6}, {12,10,4,3,2}, {12,10,5,3,2},
+	{12,10,5,4,2}, {12,10,5,4,3}, {12,10,6,3,2}, {12,10,6,4,2}, {12,10,6,4,3}, {12,10,6,5,2},
+	{12,10,6,5,3}, {12,10,6,5,4}, {12,10,7,3,2}, {12,10,7,4,2}, {12,10,7,4,3}, {12,10,7,5,2},
+	{12,10,7,5,3}, {12,10,7,5,4}, {12,10,7,6,2}, {12,10,7,6,3}, {12,10,7,6,4}, {12,10,7,6,5},
+	{12,10,8,3,2}, {12,10,8,4,2}, {12,10,8,4,3}, {12,10,8,5,2}, {12,10,8,5,3}, {12,10,8,5,4},
+	{12,10,8,6,2}, {12,10,8,6,3}, {12,10,8,6,4}, {12,10,8,6,5}, {12,10,8,7,2}, {12,10,8,7,3},
+	{12,10,8,7,4}, {12,10,8,7,5}, {12,10,8,7,6}, {12,10,9,3,2}, {12,10,9,4,2}, {12,10,9,4,3},
+	{12,10,9,5,2}, {12,10,9,5,3}, {12,10,9,5,4}, {12,10,9,6,2}, {12,10,9,6,3}, {12,10,9,6,4},
+	{12,10,9,6,5}, {12,10,9,7,2}, {12,10,9,7,3}, {12,10,9,7,4}, {12,10,9,7,5}, {12,10,9,7,6},
+	{12,10,9,8,2}, {12,10,9,8,3}, {12,10,9,8,4}, {12,10,9,8,5}, {12,10,9,8,6}, {12,10,9,8,7},
+	{12,11,4,3,2}, {12,11,5,3,2}, {12,11,5,4,2}, {12,11,5,4,3}, {12,11,6,3,2}, {12,11,6,4,2},
+	{12,11,6,4,3}, {12,11,6,5,2}, {12,11,6,5,3}, {12,11,6,5,4}, {12,11,7,3,2}, {12,11,7,4,2},
+	{12,11,7,4,3}, {12,11,7,5,2}, {12,11,7,5,3}, {12,11,7,5,4}, {12,11,7,6,2}, {12,11,7,6,3},
+	{12,11,7,6,4}, {12,11,7,6,5}, {12,11,8,3,2}, {12,11,8,4,2}, {12,11,8,4,3}, {12,11,8,5,2},
+	{12,11,8,5,3}, {12,11,8,5,4}, {12,11,8,6,2}, {12,11,8,6,3}, {12,11,8,6,4}, {12,11,8,6,5},
+	{12,11,8,7,2}, {12,11,8,7,3}, {12,11,8,7,4}, {12,11,8,7,5}, {12,11,8,7,6}, {12,11,9,3,2},
+	{12,11,9,4,2}, {12,11,9,4,3}, {12,11,9,5,2}, {12,11,9,5,3}, {12,11,9,5,4}, {12,11,9,6,2},
+	{12,11,9,6,3}, {12,11,9,6,4}, {12,11,9,6,5}, {12,11,9,7,2}, {12,11,9,7,3}, {12,11,9,7,4},
+	{12,11,9,7,5}, {12,11,9,7,6}, {12,11,9,8,2}, {12,11,9,8,3}, {12,11,9,8,4}, {12,11,9,8,5},
+	{12,11,9,8,6}, {12,11,9,8,7}, {12,11,10,3,2}, {12,11,10,4,2}, {12,11,10,4,3}, {12,11,10,5,2},
+	{12,11,10,5,3}, {12,11,10,5,4}, {12,11,10,6,2}, {12,11,10,6,3}, {12,11,10,6,4}, {12,11,10,6,5},
+	{12,11,10,7,2}, {12,11,10,7,3}, {12,11,10,7,4}, {12,11,10,7,5}, {12,11,10,7,6}, {12,11,10,8,2},
+	{12,11,10,8,3}, {12,11,10,8,4}, {12,11,10,8,5}, {12,11,10,8,6}, {12,11,10,8,7}, {12,11,10,9,2},
+	{12,11,10,9,3}, {12,11,10,9,4}, {12,11,10,9,5}, {12,11,10,9,6}, {12,11,10,9,7}, {13,5,4,3,2},
+	{13,6,4,3,2}, {13,6,5,3,2}, {13,6,5,4,2}, {13,6,5,4,3}, {13,7,4,3,2}, {13,7,5,3,2},
+	{13,7,5,4,2}, {13,7,5,4,3}, {13,7,6,3,2}, {13,7,6,4,2}, {13,7,6,4,3}, {13,7,6,5,2},
+	{13,7,6,5,3}, {13,7,6,5,4}, {13,8,4,3,2}, {13,8,5,3,2}, {13,8,5,4,2}, {13,8,5,4,3},
+	{13,8,6,3,2}, {13,8,6,4,2}, {13,8,6,4,3}, {13,8,6,5,2}, {13,8,6,5,3}, {13,8,6,5,4},
+	{13,8,7,3,2}, {13,8,7,4,2}, {13,8,7,4,3}, {13,8,7,5,2}, {13,8,7,5,3}, {13,8,7,5,4},
+	{13,8,7,6,2}, {13,8,7,6,3}, {13,8,7,6,4}, {13,8,7,6,5}, {13,9,4,3,2}, {13,9,5,3,2},
+	{13,9,5,4,2}, {13,9,5,4,3}, {13,9,6,3,2}, {13,9,6,4,2}, {13,9,6,4,3}, {13,9,6,5,2},
+	{13,9,6,5,3}, {13,9,6,5,4}, {13,9,7,3,2}, {13,9,7,4,2}, {13,9,7,4,3}, {13,9,7,5,2},
+	{13,9,7,5,3}, {13,9,7,5,4}, {13,9,7,6,2}, {13,9,7,6,3}, {13,9,7,6,4}, {13,9,7,6,5},
+	{13,9,8,3,2}, {13,9,8,4,2}, {13,9,8,4,3}, {13,9,8,5,2}, {13,9,8,5,3}, {13,9,8,5,4},
+	{13,9,8,6,2}, {13,9,8,6,3}, {13,9,8,6,4}, {13,9,8,6,5}, {13,9,8,7,2}, {13,9,8,7,3},
+	{13,9,8,7,4}, {13,9,8,7,5}, {13,9,8,7,6}, {13,10,4,3,2}, {13,10,5,3,2}, {13,10,5,4,2},
+	{13,10,5,4,3}, {13,10,6,3,2}, {13,10,6,4,2}, {13,10,6,4,3}, {13,10,6,5,2}, {13,10,6,5,3},
+	{13,10,6,5,4}, {13,10,7,3,2}, {13,10,7,4,2}, {13,10,7,4,3}, {13,10,7,5,2}, {13,10,7,5,3},
+	{13,10,7,5,4}, {13,10,7,6,2}, {13,10,7,6,3}, {13,10,7,6,4}, {13,10,7,6,5}, {13,10,8,3,2},
+	{13,10,8,4,2}, {13,10,8,4,3}, {13,10,8,5,2}, {13,10,8,5,3}, {13,10,8,5,4}, {13,10,8,6,2},
+	{13,10,8,6,3}, {13,10,8,6,4}, {13,10,8,6,5}, {13,10,8,7,2}, {13,10,8,7,3}, {13,10,8,7,4},
+	{13,10,8,7,5}, {13,10,8,7,6}, {13,10,9,3,2}, {13,10,9,4,2}, {13,10,9,4,3}, {13,10,9,5,2},
+	{13,10,9,5,3}, {13,10,9,5,4}, {13,10,9,6,2}, {13,10,9,6,3}, {13,10,9,6,4}, {13,10,9,6,5},
+	{13,10,9,7,2}, {13,10,9,7,3}, {13,10,9,7,4}, {13,10,9,7,5}, {13,10,9,7,6}, {13,10,9,8,2},
+	{13,10,9,8,3}, {13,10,9,8,4}, {13,10,9,8,5}, {13,10,9,8,6}, {13,10,9,8,7}, {13,11,4,3,2},
+	{13,11,5,3,2}, {13,11,5,4,2}, {13,11,5,4,3}, {13,11,6,3,2}, {13,11,6,4,2}, {13,11,6,4,3},
+	{13,11,6,5,2}, {13,11,6,5,3}, {13,11,6,5,4}, {13,11,7,3,2}, {13,11,7,4,2}, {13,11,7,4,3},
+	{13,11,7,5,2}, {13,11,7,5,3}, {13,11,7,5,4}, {13,11,7,6,2}, {13,11,7,6,3}, {13,11,7,6,4},
+	{13,11,7,6,5}, {13,11,8,3,2}, {13,11,8,4,2}, {13,11,8,4,3}, {13,11,8,5,2}, {13,11,8,5,3},
+	{13,11,8,5,4}, {13,11,8,6,2}, {13,11,8,6,3}, {13,11,8,6,4}, {13,11,8,6,5}, {13,11,8,7,2},
+	{13,11,8,7,3}, {13,11,8,7,4}, {13,11,8,7,5}, {13,11,8,7,6}, {13,11,9,3,2}, {13,11,9,4,2},
+	{13,11,9,4,3}, {13,11,9,5,2}, {13,11,9,5,3}, {13,11,9,5,4}, {13,11,9,6,2}, {13,11,9,6,3},
+	{13,11,9,6,4}, {13,11,9,6,5}, {13,11,9,7,2}, {13,11,9,7,3}, {13,11,9,7,4}, {13,11,9,7,5},
+	{13,11,9,7,6}, {13,11,9,8,2}, {13,11,9,8,3}, {13,11,9,8,4}, {13,11,9,8,5}, {13,11,9,8,6},
+	{13,11,9,8,7}, {13,11,10,3,2}, {13,11,10,4,2}, {13,11,10,4,3}, {13,11,10,5,2}, {13,11,10,5,3},
+	{13,11,10,5,4}, {13,11,10,6,2}, {13,11,10,6,3}, {13,11,10,6,4}, {13,11,10,6,5}, {13,11,10,7,2},
+	{13,11,10,7,3}, {13,11,10,7,4}, {13,11,10,7,5}, {13,11,10,7,6}, {13,11,10,8,2}, {13,11,10,8,3},
+	{13,11,10,8,4}, {13,11,10,8,5}, {13,11,10,8,6}, {13,11,10,8,7}, {13,11,10,9,2}, {13,11,10,9,3},
+	{13,11,10,9,4}, {13,11,10,9,5}, {13,11,10,9,6}, {13,11,10,9,7}, {13,11,10,9,8}, {13,12,4,3,2},
+	{13,12,5,3,2}, {13,12,5,4,2}, {13,12,5,4,3}, {13,12,6,3,2}, {13,12,6,4,2}, {13,12,6,4,3},
+	{13,12,6,5,2}, {13,12,6,5,3}, {13,12,6,5,4}, {13,12,7,3,2}, {13,12,7,4,2}, {13,12,7,4,3},
+	{13,12,7,5,2}, {13,12,7,5,3}, {13,12,7,5,4}, {13,12,7,6,2}, {13,12,7,6,3}, {13,12,7,6,4},
+	{13,12,7,6,5}, {13,12,8,3,2}, {13,12,8,4,2}, {13,12,8,4,3}, {13,12,8,5,2}, {13,12,8,5,3},
+	{13,12,8,5,4}, {13,12,8,6,2}, {13,12,8,6,3}, {13,12,8,6,4}, {13,12,8,6,5}, {13,12,8,7,2},
+	{13,12,8,7,3}, {13,12,8,7,4}, {13,12,8,7,5}, {13,12,8,7,6}, {13,12,9,3,2}, {13,12,9,4,2},
+	{13,12,9,4,3}, {13,12,9,5,2}, {13,12,9,5,3}, {13,12,9,5,4}, {13,12,9,6,2}, {13,12,9,6,3},
+	{13,12,9,6,4}, {13,12,9,6,5}, {13,12,9,7,2}, {13,12,9,7,3}, {13,12,9,7,4}, {13,12,9,7,5},
+	{13,12,9,7,6}, {13,12,9,8,2}, {13,12,9,8,3}, {13,12,9,8,4}, {13,12,9,8,5}, {13,12,9,8,6},
+	{13,12,9,8,7}, {13,12,10,3,2}, {13,12,10,4,2}, {13,12,10,4,3}, {13,12,10,5,2}, {13,12,10,5,3},
+	{13,12,10,5,4}, {13,12,10,6,2}, {13,12,10,6,3}, {13,12,10,6,4}, {13,12,10,6,5}, {13,12,10,7,2},
+	{13,12,10,7,3}, {13,12,10,7,4}, {13,12,10,7,5}, {13,12,10,7,6}, {13,12,10,8,2}, {13,12,10,8,3},
+	{13,12,10,8,4}, {13,12,10,8,5}, {13,12,10,8,6}, {13,12,10,8,7}, {13,12,10,9,2}, {13,12,10,9,3},
+	{13,12,10,9,4}, {13,12,10,9,5}, {13,12,10,9,6}, {13,12,10,9,7}, {13,12,10,9,8}, {13,12,11,3,2},
+	{13,12,11,4,2}, {13,12,11,4,3}, {13,12,11,5,2}, {13,12,11,5,3}, {13,12,11,5,4}, {13,12,11,6,2},
+	{13,12,11,6,3}, {13,12,11,6,4}, {13,12,11,6,5}, {13,12,11,7,2}, {13,12,11,7,3}, {13,12,11,7,4},
+	{13,12,11,7,5}, {13,12,11,7,6}, {13,12,11,8,2}, {13,12,11,8,3}, {13,12,11,8,4}, {13,12,11,8,5},
+	{13,12,11,8,6}, {13,12,11,8,7}, {13,12,11,9,2}, {13,12,11,9,3}, {13,12,11,9,4}, {13,12,11,9,5},
+	{13,12,11,9,6}, {13,12,11,9,7}, {13,12,11,9,8}, {13,12,11,10,2}, {13,12,11,10,3}, {13,12,11,10,4},
+	{13,12,11,10,5}, {13,12,11,10,6}, {13,12,11,10,7}, {13,12,11,10,8}, {14,6,4,3,2}, {14,6,5,3,2},
+	{14,6,5,4,2}, {14,6,5,4,3}, {14,7,4,3,2}, {14,7,5,3,2}, {14,7,5,4,2}, {14,7,5,4,3},
+	{14,7,6,3,2}, {14,7,6,4,2}, {14,7,6,4,3}, {14,7,6,5,2}, {14,7,6,5,3}, {14,7,6,5,4},
+	{14,8,4,3,2}, {14,8,5,3,2}, {14,8,5,4,2}, {14,8,5,4,3}, {14,8,6,3,2}, {14,8,6,4,2},
+	{14,8,6,4,3}, {14,8,6,5,2}, {14,8,6,5,3}, {14,8,6,5,4}, {14,8,7,3,2}, {14,8,7,4,2},
+	{14,8,7,4,3}, {14,8,7,5,2}, {14,8,7,5,3}, {14,8,7,5,4}, {14,8,7,6,2}, {14,8,7,6,3},
+	{14,8,7,6,4}, {14,8,7,6,5}, {14,9,4,3,2}, {14,9,5,3,2}, {14,9,5,4,2}, {14,9,5,4,3},
+	{14,9,6,3,2}, {14,9,6,4,2}, {14,9,6,4,3}, {14,9,6,5,2}, {14,9,6,5,3}, {14,9,6,5,4},
+	{14,9,7,3,2}, {14,9,7,4,2}, {14,9,7,4,3}, {14,9,7,5,2}, {14,9,7,5,3}, {14,9,7,5,4},
+	{14,9,7,6,2}, {14,9,7,6,3}, {14,9,7,6,4}, {14,9,7,6,5}, {14,9,8,3,2}, {14,9,8,4,2},
+	{14,9,8,4,3}, {14,9,8,5,2}, {14,9,8,5,3}, {14,9,8,5,4}, {14,9,8,6,2}, {14,9,8,6,3},
+	{14,9,8,6,4}, {14,9,8,6,5}, {14,9,8,7,2}, {14,9,8,7,3}, {14,9,8,7,4}, {14,9,8,7,5},
+	{14,9,8,7,6}, {14,10,4,3,2}, {14,10,5,3,2}, {14,10,5,4,2}, {14,10,5,4,3}, {14,10,6,3,2},
+	{14,10,6,4,2}, {14,10,6,4,3}, {14,10,6,5,2}, {14,10,6,5,3}, {14,10,6,5,4}, {14,10,7,3,2},
+	{14,10,7,4,2}, {14,10,7,4,3}, {14,10,7,5,2}, {14,10,7,5,3}, {14,10,7,5,4}, {14,10,7,6,2},
+	{14,10,7,6,3}, {14,10,7,6,4}, {14,10,7,6,5}, {14,10,8,3,2}, {14,10,8,4,2}, {14,10,8,4,3},
+	{14,10,8,5,2}, {14,10,8,5,3}, {14,10,8,5,4}, {14,10,8,6,2}, {14,10,8,6,3}, {14,10,8,6,4},
+	{14,10,8,6,5}, {14,10,8,7,2}, {14,10,8,7,3}, {14,10,8,7,4}, {14,10,8,7,5}, {14,10,8,7,6},
+	{14,10,9,3,2}, {14,10,9,4,2}, {14,10,9,4,3}, {14,10,9,5,2}, {14,10,9,5,3}, {14,10,9,5,4},
+	{14,10,9,6,2}, {14,10,9,6,3}, {14,10,9,6,4}, {14,10,9,6,5}, {14,10,9,7,2}, {14,10,9,7,3},
+	{14,10,9,7,4}, {14,10,9,7,5}, {14,10,9,7,6}, {14,10,9,8,2}, {14,10,9,8,3}, {14,10,9,8,4},
+	{14,10,9,8,5}, {14,10,9,8,6}, {14,10,9,8,7}, {14,11,4,3,2}, {14,11,5,3,2}, {14,11,5,4,2},
+	{14,11,5,4,3}, {14,11,6,3,2}, {14,11,6,4,2}, {14,11,6,4,3}, {14,11,6,5,2}, {14,11,6,5,3},
+	{14,11,6,5,4}, {14,11,7,3,2}, {14,11,7,4,2}, {14,11,7,4,3}, {14,11,7,5,2}, {14,11,7,5,3},
+	{14,11,7,5,4}, {14,11,7,6,2}, {14,11,7,6,3}, {14,11,7,6,4}, {14,11,7,6,5}, {14,11,8,3,2},
+	{14,11,8,4,2}, {14,11,8,4,3}, {14,11,8,5,2}, {14,11,8,5,3}, {14,11,8,5,4}, {14,11,8,6,2},
+	{14,11,8,6,3}, {14,11,8,6,4}, {14,11,8,6,5}, {14,11,8,7,2}, {14,11,8,7,3}, {14,11,8,7,4},
+	{14,11,8,7,5}, {14,11,8,7,6}, {14,11,9,3,2}, {14,11,9,4,2}, {14,11,9,4,3}, {14,11,9,5,2},
+	{14,11,9,5,3}, {14,11,9,5,4}, {14,11,9,6,2}, {14,11,9,6,3}, {14,11,9,6,4}, {14,11,9,6,5},
+	{14,11,9,7,2}, {14,11,9,7,3}, {14,11,9,7,4}, {14,11,9,7,5}, {14,11,9,7,6}, {14,11,9,8,2},
+	{14,11,9,8,3}, {14,11,9,8,4}, {14,11,9,8,5}, {14,11,9,8,6}, {14,11,9,8,7}, {14,11,10,3,2},
+	{14,11,10,4,2}, {14,11,10,4,3}, {14,11,10,5,2}, {14,11,10,5,3}, {14,11,10,5,4}, {14,11,10,6,2},
+	{14,11,10,6,3}, {14,11,10,6,4}, {14,11,10,6,5}, {14,11,10,7,2}, {14,11,10,7,3}, {14,11,10,7,4},
+	{14,11,10,7,5}, {14,11,10,7,6}, {14,11,10,8,2}, {14,11,10,8,3}, {14,11,10,8,4}, {14,11,10,8,5},
+	{14,11,10,8,6}, {14,11,10,8,7}, {14,11,10,9,2}, {14,11,10,9,3}, {14,11,10,9,4}, {14,11,10,9,5},
+	{14,11,10,9,6}, {14,11,10,9,7}, {14,11,10,9,8}, {14,12,4,3,2}, {14,12,5,3,2}, {14,12,5,4,2},
+	{14,12,5,4,3}, {14,12,6,3,2}, {14,12,6,4,2}, {14,12,6,4,3}, {14,12,6,5,2}, {14,12,6,5,3},
+	{14,12,6,5,4}, {14,12,7,3,2}, {14,12,7,4,2}, {14,12,7,4,3}, {14,12,7,5,2}, {14,12,7,5,3},
+	{14,12,7,5,4}, {14,12,7,6,2}, {14,12,7,6,3}, {14,12,7,6,4}, {14,12,7,6,5}, {14,12,8,3,2},
+	{14,12,8,4,2}, {14,12,8,4,3}, {14,12,8,5,2}, {14,12,8,5,3}, {14,12,8,5,4}, {14,12,8,6,2},
+	{14,12,8,6,3}, {14,12,8,6,4}, {14,12,8,6,5}, {14,12,8,7,2}, {14,12,8,7,3}, {14,12,8,7,4},
+	{14,12,8,7,5}, {14,12,8,7,6}, {14,12,9,3,2}, {14,12,9,4,2}, {14,12,9,4,3}, {14,12,9,5,2},
+	{14,12,9,5,3}, {14,12,9,5,4}, {14,12,9,6,2}, {14,12,9,6,3}, {14,12,9,6,4}, {14,12,9,6,5},
+	{14,12,9,7,2}, {14,12,9,7,3}, {14,12,9,7,4}, {14,12,9,7,5}, {14,12,9,7,6}, {14,12,9,8,2},
+	{14,12,9,8,3}, {14,12,9,8,4}, {14,12,9,8,5}, {14,12,9,8,6}, {14,12,9,8,7}, {14,12,10,3,2},
+	{14,12,10,4,2}, {14,12,10,4,3}, {14,12,10,5,2}, {14,12,10,5,3}, {14,12,10,5,4}, {14,12,10,6,2},
+	{14,12,10,6,3}, {14,12,10,6,4}, {14,12,10,6,5}, {14,12,10,7,2}, {14,12,10,7,3}, {14,12,10,7,4},
+	{14,12,10,7,5}, {14,12,10,7,6}, {14,12,10,8,2}, {14,12,10,8,3}, {14,12,10,8,4}, {14,12,10,8,5},
+	{14,12,10,8,6}, {14,12,10,8,7}, {14,12,10,9,2}, {14,12,10,9,3}, {14,12,10,9,4}, {14,12,10,9,5},
+	{14,12,10,9,6}, {14,12,10,9,7}, {14,12,10,9,8}, {14,12,11,3,2}, {14,12,11,4,2}, {14,12,11,4,3},
+	{14,12,11,5,2}, {14,12,11,5,3}, {14,12,11,5,4}, {14,12,11,6,2}, {14,12,11,6,3}, {14,12,11,6,4},
+	{14,12,11,6,5}, {14,12,11,7,2}, {14,12,11,7,3}, {14,12,11,7,4}, {14,12,11,7,5}, {14,12,11,7,6},
+	{14,12,11,8,2}, {14,12,11,8,3}, {14,12,11,8,4}, {14,12,11,8,5}, {14,12,11,8,6}, {14,12,11,8,7},
+	{14,12,11,9,2}, {14,12,11,9,3}, {14,12,11,9,4}, {14,12,11,9,5}, {14,12,11,9,6}, {14,12,11,9,7},
+	{14,12,11,9,8}, {14,12,11,10,2}, {14,12,11,10,3}, {14,12,11,10,4}, {14,12,11,10,5}, {14,12,11,10,6},
+	{14,12,11,10,7}, {14,12,11,10,8}, {14,12,11,10,9}, {14,13,4,3,2}, {14,13,5,3,2}, {14,13,5,4,2},
+	{14,13,5,4,3}, {14,13,6,3,2}, {14,13,6,4,2}, {14,13,6,4,3}, {14,13,6,5,2}, {14,13,6,5,3},
+	{14,13,6,5,4}, {14,13,7,3,2}, {14,13,7,4,2}, {14,13,7,4,3}, {14,13,7,5,2}, {14,13,7,5,3},
+	{14,13,7,5,4}, {14,13,7,6,2}, {14,13,7,6,3}, {14,13,7,6,4}, {14,13,7,6,5}, {14,13,8,3,2},
+	{14,13,8,4,2}, {14,13,8,4,3}, {14,13,8,5,2}, {14,13,8,5,3}, {14,13,8,5,4}, {14,13,8,6,2},
+	{14,13,8,6,3}, {14,13,8,6,4}, {14,13,8,6,5}, {14,13,8,7,2}, {14,13,8,7,3}, {14,13,8,7,4},
+	{14,13,8,7,5}, {14,13,8,7,6}, {14,13,9,3,2}, {14,13,9,4,2}, {14,13,9,4,3}, {14,13,9,5,2},
+	{14,13,9,5,3}, {14,13,9,5,4}, {14,13,9,6,2}, {14,13,9,6,3}, {14,13,9,6,4}, {14,13,9,6,5},
+	{14,13,9,7,2}, {14,13,9,7,3}, {14,13,9,7,4}, {14,13,9,7,5}, {14,13,9,7,6}, {14,13,9,8,2},
+	{14,13,9,8,3}, {14,13,9,8,4}, {14,13,9,8,5}, {14,13,9,8,6}, {14,13,9,8,7}, {14,13,10,3,2},
+	{14,13,10,4,2}, {14,13,10,4,3}, {14,13,10,5,2}, {14,13,10,5,3}, {14,13,10,5,4}, {14,13,10,6,2},
+	{14,13,10,6,3}, {14,13,10,6,4}, {14,13,10,6,5}, {14,13,10,7,2}, {14,13,10,7,3}, {14,13,10,7,4},
+	{14,13,10,7,5}, {14,13,10,7,6}, {14,13,10,8,2}, {14,13,10,8,3}, {14,13,10,8,4}, {14,13,10,8,5},
+	{14,13,10,8,6}, {14,13,10,8,7}, {14,13,10,9,2}, {14,13,10,9,3}, {14,13,10,9,4}, {14,13,10,9,5},
+	{14,13,10,9,6}, {14,13,10,9,7}, {14,13,10,9,8}, {14,13,11,3,2}, {14,13,11,4,2}, {14,13,11,4,3},
+	{14,13,11,5,2}, {14,13,11,5,3}, {14,13,11,5,4}, {14,13,11,6,2}, {14,13,11,6,3}, {14,13,11,6,4},
+	{14,13,11,6,5}, {14,13,11,7,2}, {14,13,11,7,3}, {14,13,11,7,4}, {14,13,11,7,5}, {14,13,11,7,6},
+	{14,13,11,8,2}, {14,13,11,8,3}, {14,13,11,8,4}, {14,13,11,8,5}, {14,13,11,8,6}, {14,13,11,8,7},
+	{14,13,11,9,2}, {14,13,11,9,3}, {14,13,11,9,4}, {14,13,11,9,5}, {14,13,11,9,6}, {14,13,11,9,7},
+	{14,13,11,9,8}, {14,13,11,10,2}, {14,13,11,10,3}, {14,13,11,10,4}, {14,13,11,10,5}, {14,13,11,10,6},
+	{14,13,11,10,7}, {14,13,11,10,8}, {14,13,11,10,9}, {14,13,12,3,2}, {14,13,12,4,2}, {14,13,12,4,3},
+	{14,13,12,5,2}, {14,13,12,5,3}, {14,13,12,5,4}, {14,13,12,6,2}, {14,13,12,6,3}, {14,13,12,6,4},
+	{14,13,12,6,5}, {14,13,12,7,2}, {14,13,12,7,3}, {14,13,12,7,4}, {14,13,12,7,5}, {14,13,12,7,6},
+	{14,13,12,8,2}, {14,13,12,8,3}, {14,13,12,8,4}, {14,13,12,8,5}, {14,13,12,8,6}, {14,13,12,8,7},
+	{14,13,12,9,2}, {14,13,12,9,3}, {14,13,12,9,4}, {14,13,12,9,5}, {14,13,12,9,6}, {14,13,12,9,7},
+	{14,13,12,9,8}, {14,13,12,10,2}, {14,13,12,10,3}, {14,13,12,10,4}, {14,13,12,10,5}, {14,13,12,10,6},
+	{14,13,12,10,7}, {14,13,12,10,8}, {14,13,12,10,9}, {14,13,12,11,2}, {14,13,12,11,3}, {14,13,12,11,4},
+	{14,13,12,11,5}, {14,13,12,11,6}, {14,13,12,11,7}, {14,13,12,11,8}, {14,13,12,11,9},
+};
+
+const uint32_t colexBinom[52][COLEX_MAX_K + 1] RANK_TABLE = {
+	{1, 0, 0, 0, 0, 0, 0, 0},
+	{1, 1, 0, 0, 0, 0, 0, 0},
+	{1, 2, 1, 0, 0, 0, 0, 0},
+	{1, 3, 3, 1, 0, 0, 0, 0},
+	{1, 4, 6, 4, 1, 0, 0, 0},
+	{1, 5, 10, 10, 5, 1, 0, 0},
+	{1, 6, 15, 20, 15, 6, 1, 0},
+	{1, 7, 21, 35, 35, 21, 7, 1},
+	{1, 8, 28, 56, 70, 56, 28, 8},
+	{1, 9, 36, 84, 126, 126, 84, 36},
+	{1, 10, 45, 120, 210, 252, 210, 120},
+	{1, 11, 55, 165, 330, 462, 462, 330},
+	{1, 12, 66, 220, 495, 792, 924, 792},
+	{1, 13, 78, 286, 715, 1287, 1716, 1716},
+	{1, 14, 91, 364, 1001, 2002, 3003, 3432},
+	{1, 15, 105, 455, 1365, 3003, 5005, 6435},
+	{1, 16, 120, 560, 1820, 4368, 8008, 11440},
+	{1, 17, 136, 680, 2380, 6188, 12376, 19448},
+	{1, 18, 153, 816, 3060, 8568, 18564, 31824},
+	{1, 19, 171, 969, 3876, 11628, 27132, 50388},
+	{1, 20, 190, 1140, 4845, 15504, 38760, 77520},
+	{1, 21, 210, 1330, 5985, 20349, 54264, 116280},
+	{1, 22, 231, 1540, 7315, 26334, 74613, 170544},
+	{1, 23, 253, 1771, 8855, 33649, 100947, 245157},
+	{1, 24, 276, 2024, 10626, 42504, 134596, 346104},
+	{1, 25, 300, 2300, 12650, 53130, 177100, 480700},
+	{1, 26, 325, 2600, 14950, 65780, 230230, 657800},
+	{1, 27, 351, 2925, 17550, 80730, 296010, 888030},
+	{1, 28, 378, 3276, 20475, 98280, 376740, 1184040},
+	{1, 29, 406, 3654, 23751, 118755, 475020, 1560780},
+	{1, 30, 435, 4060, 27405, 142506, 593775, 2035800},
+	{1, 31, 465, 4495, 31465, 169911, 736281, 2629575},
+	{1, 32, 496, 4960, 35960, 201376, 906192, 3365856},
+	{1, 33, 528, 5456, 40920, 237336, 1107568, 4272048},
+	{1, 34, 561, 5984, 46376, 278256, 1344904, 5379616},
+	{1, 35, 595, 6545, 52360, 324632, 1623160, 6724520},
+	{1, 36, 630, 7140, 58905, 376992, 1947792, 8347680},
+	{1, 37, 666, 7770, 66045, 435897, 2324784, 10295472},
+	{1, 38, 703, 8436, 73815, 501942, 2760681, 12620256},
+	{1, 39, 741, 9139, 82251, 575757, 3262623, 15380937},
+	{1, 40, 780, 9880, 91390, 658008, 3838380, 18643560},
+	{1, 41, 820, 10660, 101270, 749398, 4496388, 22481940},
+	{1, 42, 861, 11480, 111930, 850668, 5245786, 26978328},
+	{1, 43, 903, 12341, 123410, 962598, 6096454, 32224114},
+	{1, 44, 946, 13244, 135751, 1086008, 7059052, 38320568},
+	{1, 45, 990, 14190, 148995, 1221759, 8145060, 45379620},
+	{1, 46, 1035, 15180, 163185, 1370754, 9366819, 53524680},
+	{1, 47, 1081, 16215, 178365, 1533939, 10737573, 62891499},
+	{1, 48, 1128, 17296, 194580, 1712304, 12271512, 73629072},
+	{1, 49, 1176, 18424, 211876, 1906884, 13983816, 85900584},
+	{1, 50, 1225, 19600, 230300, 2118760, 15890700, 99884400},
+	{1, 51, 1275, 20825, 249900, 2349060, 18009460, 115775100}
+};
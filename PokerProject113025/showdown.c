@@ -0,0 +1,60 @@
+/*
+ * showdown.c
+ *
+ * Evaluation is one accumulator copy plus 2 adds per seat, linear in the seat count;
+ * the sort is an insertion sort over at most 10 seats.
+ */ 
+
+#include "showdown.h"
+
+void showdown_rank(const Card board[5], const Card hole[][2], uint8_t n, ShowdownResult *sr){
+	HandAccumulator boardAcc;
+	hand_acc_init(&boardAcc);
+	for(uint8_t i = 0; i < 5; i++){
+		hand_acc_add(&boardAcc, board[i]);
+	}
+
+	for(uint8_t p = 0; p < n; p++){
+		HandAccumulator acc = boardAcc;
+		hand_acc_add(&acc, hole[p][0]);
+		hand_acc_add(&acc, hole[p][1]);
+		sr->hand[p] = hand_acc_best(&acc);
+		sr->strength[p] = hand_strength(&sr->hand[p]);
+	}
+	showdown_group(sr, n);
+}
+
+void showdown_group(ShowdownResult *sr, uint8_t n){
+	sr->count = n;
+	for(uint8_t i = 0; i < n; i++){
+		//Insertion sort, strongest first, equal strength keeps seat order
+		uint8_t j = i;
+		while(j > 0 && sr->strength[sr->order[j - 1]] < sr->strength[i]){
+			sr->order[j] = sr->order[j - 1];
+			j--;
+		}
+		sr->order[j] = i;
+	}
+
+	sr->groups = 0;
+	for(uint8_t i = 0; i < n; i++){
+		if(i == 0 || sr->strength[sr->order[i]] != sr->strength[sr->order[i - 1]]){
+			sr->groupStart[sr->groups++] = i;
+		}
+	}
+	sr->groupStart[sr->groups] = n;
+}
+
+uint16_t showdown_pot_winners(const ShowdownResult *sr, uint16_t eligible){
+	for(uint8_t g = 0; g < sr->groups; g++){
+		uint16_t winners = 0;
+		for(uint8_t i = sr->groupStart[g]; i < sr->groupStart[g + 1]; i++){
+			winners |= (uint16_t)1 << sr->order[i];
+		}
+		winners &= eligible;
+		if(winners){
+			return winners;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,43 @@
+/*
+ * bench_util.h
+ *
+ * Timing and random deal helpers shared by the host benches and tools.
+ * Every program uses the same LCG, so a given seed deals the same cards everywhere.
+ */
+
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <stdint.h>
+#include <time.h>
+#include "card.h"
+
+static inline double now_sec(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static inline uint32_t next_rand(uint32_t *seed){
+	*seed = *seed * 1664525u + 1013904223u;
+	return *seed >> 8;
+}
+
+static inline void random_cards_excluding(Card *out, uint8_t n, uint64_t *used, uint32_t *seed){
+	//Deal n distinct cards not already in used (bit = card_index), and mark them used
+	for(uint8_t i = 0; i < n; i++){
+		uint8_t x;
+		do{
+			x = (uint8_t)(next_rand(seed) % 52);
+		}while(*used & (1ull << x));
+		*used |= 1ull << x;
+		out[i] = card_from_index(x);
+	}
+}
+
+static inline void random_cards(Card *out, uint8_t n, uint32_t *seed){
+	uint64_t used = 0;
+	random_cards_excluding(out, n, &used, seed);
+}
+
+#endif
@@ -0,0 +1,67 @@
+/*
+ * board_cache_bench.c
+ *
+ * Cost of a river rank cache against direct 7 card evaluation. Build from the repo root:
+ *   gcc -O2 -IPokerProject113025/PokerProject113025 -o board_cache_bench host/board_cache_bench.c \
+ *       PokerProject113025/PokerProject113025/board_cache.c \
+ *       PokerProject113025/PokerProject113025/card.c PokerProject113025/PokerProject113025/rank_tables.c
+ *   ./board_cache_bench [boards]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "board_cache.h"
+#include "bench_util.h"
+
+int main(int argc, char **argv){
+	long boards = (argc > 1) ? atol(argv[1]) : 2000;
+	static BoardCache bc;
+	uint32_t seed = 11;
+	double tBuild = 0, tLookup = 0, tDirect = 0;
+	long queries = 0, bad = 0;
+	volatile uint32_t sink = 0;
+
+	for(long b = 0; b < boards; b++){
+		Card board[5], holes[BOARD_CACHE_COMBOS][2];
+		uint64_t used = 0;
+		random_cards_excluding(board, 5, &used, &seed);
+
+		double t0 = now_sec();
+		board_cache_build(&bc, board);
+		tBuild += now_sec() - t0;
+
+		//Query every holding on the board once, the full-table case for equity work
+		uint16_t n = 0;
+		for(uint8_t j = 0; j < 52; j++){
+			for(uint8_t i = 0; i < j; i++){
+				if(used & ((1ull << i) | (1ull << j))) continue;
+				holes[n][0] = card_from_index(i);
+				holes[n][1] = card_from_index(j);
+				n++;
+			}
+		}
+		t0 = now_sec();
+		for(uint16_t q = 0; q < n; q++){
+			sink += board_cache_lookup(&bc, holes[q][0], holes[q][1]);
+		}
+		tLookup += now_sec() - t0;
+
+		t0 = now_sec();
+		for(uint16_t q = 0; q < n; q++){
+			Card seven[7] = {holes[q][0], holes[q][1], board[0], board[1], board[2], board[3], board[4]};
+			uint16_t s = evaluate_hand_strength(seven);
+			sink += s;
+			if(s != board_cache_lookup(&bc, holes[q][0], holes[q][1])) bad++;
+		}
+		tDirect += now_sec() - t0;
+		queries += n;
+	}
+
+	printf("%ld boards, %ld queries, %ld mismatches\n", boards, queries, bad);
+	printf("build          %8.1f us per board (%.1f ns per holding)\n", tBuild / boards * 1e6, tBuild / queries * 1e9);
+	printf("lookup         %8.1f ns per query\n", tLookup / queries * 1e9);
+	printf("build+lookup   %8.1f ns per query, amortized over all %d holdings\n", (tBuild + tLookup) / queries * 1e9, BOARD_CACHE_COMBOS);
+	printf("direct eval    %8.1f ns per query\n", tDirect / queries * 1e9);
+	printf("break even after %.0f queries per board\n", tBuild / (tDirect / queries - tLookup / queries) / boards);
+	return bad != 0;
+}
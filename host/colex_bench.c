@@ -0,0 +1,68 @@
+/*
+ * colex_bench.c
+ *
+ * Checks colex rank/unrank for 2, 3, 5 and 7 card sets against a counter loop over every
+ * set, and times ranking random 7 card hands. Build from the repo root:
+ *   gcc -O2 -IPokerProject113025/PokerProject113025 -o colex_bench host/colex_bench.c \
+ *       PokerProject113025/PokerProject113025/colex.c \
+ *       PokerProject113025/PokerProject113025/card.c PokerProject113025/PokerProject113025/rank_tables.c
+ *   ./colex_bench [hands]
+ * Exit status is non zero on any mismatch.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "colex.h"
+#include "bench_util.h"
+
+int main(int argc, char **argv){
+	long hands = (argc > 1) ? atol(argv[1]) : 5000000;
+	static const uint8_t ks[4] = {2, 3, 5, 7};
+	uint32_t seed = 3;
+	long bad = 0;
+
+	//Every set in order: the counter is the rank, unrank must give the set back
+	for(uint8_t t = 0; t < 4; t++){
+		uint8_t k = ks[t];
+		uint8_t idx[COLEX_MAX_K], back[COLEX_MAX_K];
+		uint32_t n = 0;
+		for(uint8_t i = 0; i < k; i++) idx[i] = i;
+		double t0 = now_sec();
+		do{
+			if(colex_rank(idx, k) != n) bad++;
+			if(k < 7 || n % 101 == 0){
+				colex_unrank(n, k, back);
+				for(uint8_t i = 0; i < k; i++) bad += (back[i] != idx[i]);
+			}
+			n++;
+		}while(colex_next(idx, k));
+		if(n != colex_count(k)) bad++;
+		printf("k=%u  %9u sets (C(52,%u) = %9u)  walked in %.2f s\n", k, n, k, colex_count(k), now_sec() - t0);
+	}
+
+	//Random hands, cards in deal order
+	Card *set = malloc(hands * 7 * sizeof(Card));
+	uint32_t *ranks = malloc(hands * sizeof(uint32_t));
+	if(!set || !ranks) return 1;
+	for(long i = 0; i < hands; i++) random_cards(&set[i * 7], 7, &seed);
+
+	double t0 = now_sec();
+	for(long i = 0; i < hands; i++) ranks[i] = colex_rank_cards(&set[i * 7], 7);
+	double tRank = now_sec() - t0;
+
+	volatile uint32_t sink = 0;
+	t0 = now_sec();
+	for(long i = 0; i < hands; i++){
+		Card c[7];
+		colex_unrank_cards(ranks[i], 7, c);
+		sink += c[6].rank;
+	}
+	double tUnrank = now_sec() - t0;
+
+	printf("7 cards: rank %.1f ns (%.1f M/s), unrank %.1f ns (%.1f M/s)\n",
+		tRank / hands * 1e9, hands / tRank / 1e6, tUnrank / hands * 1e9, hands / tUnrank / 1e6);
+	printf("%s, %ld mismatches\n", bad ? "FAILED" : "ok", bad);
+	free(set);
+	free(ranks);
+	return bad ? 1 : 0;
+}
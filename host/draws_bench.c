@@ -0,0 +1,133 @@
+/*
+ * draws_bench.c
+ *
+ * Checks draws.c against a brute force that tries every unseen card on random flops and
+ * turns: an out must give the hand a straight or flush it did not have, that the board plus
+ * the card does not have by itself, or pair an unpaired hole card above the board.
+ * Also times draw_classify(). Build from the repo root:
+ *   gcc -O2 -IPokerProject113025/PokerProject113025 -o draws_bench host/draws_bench.c \
+ *       PokerProject113025/PokerProject113025/draws.c \
+ *       PokerProject113025/PokerProject113025/card.c PokerProject113025/PokerProject113025/rank_tables.c
+ *   ./draws_bench [deals]
+ * Exit status is non zero on any mismatch.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "draws.h"
+#include "bench_util.h"
+
+static uint8_t value(Card c){
+	return card_rank_value(c.rank);
+}
+
+static int has_straight(const Card *c, uint8_t n){
+	uint8_t present[15] = {0};
+	for(uint8_t i = 0; i < n; i++){
+		present[value(c[i])] = 1;
+	}
+	present[1] = present[14];
+	for(uint8_t lo = 1; lo <= 10; lo++){
+		uint8_t run = 0;
+		for(uint8_t k = 0; k < 5; k++) run += present[lo + k];
+		if(run == 5) return 1;
+	}
+	return 0;
+}
+
+static int has_flush(const Card *c, uint8_t n){
+	uint8_t count[4] = {0};
+	for(uint8_t i = 0; i < n; i++){
+		if(++count[c[i].suit] == 5) return 1;
+	}
+	return 0;
+}
+
+static void brute(const Card *hole, const Card *board, uint8_t n, uint16_t outMask[4]){
+	//hand = hole + board, then the same with one more card at the end
+	Card hand[7], brd[5];
+	uint8_t boardHigh = 0;
+	for(uint8_t i = 0; i < n; i++){
+		hand[2 + i] = brd[i] = board[i];
+		if(value(board[i]) > boardHigh) boardHigh = value(board[i]);
+	}
+	hand[0] = hole[0];
+	hand[1] = hole[1];
+	uint8_t m = n + 2;
+	int straight = has_straight(hand, m), flush = has_flush(hand, m);
+	for(uint8_t s = 0; s < 4; s++) outMask[s] = 0;
+	for(uint8_t x = 0; x < 52; x++){
+		Card c = card_from_index(x);
+		int seen = 0;
+		for(uint8_t i = 0; i < m; i++){
+			if(card_index(hand[i]) == x) seen = 1;
+		}
+		if(seen) continue;
+		hand[m] = brd[n] = c;
+		int out = (!straight && has_straight(hand, m + 1) && !has_straight(brd, n + 1))
+			|| (!flush && has_flush(hand, m + 1) && !has_flush(brd, n + 1));
+		if(value(hole[0]) != value(hole[1])){
+			for(uint8_t h = 0; h < 2; h++){
+				if(value(hole[h]) > boardHigh && value(c) == value(hole[h])) out = 1;
+			}
+		}
+		if(out) outMask[c.suit] |= (uint16_t)1 << (value(c) - 2);
+	}
+}
+
+int main(int argc, char **argv){
+	long deals = (argc > 1) ? atol(argv[1]) : 200000;
+	uint32_t seed = 16;
+	long bad = 0;
+	long flagCount[2][4] = {{0}};
+	long outsTotal[2] = {0};
+	Card *set = malloc(deals * 6 * sizeof(Card));
+	if(!set) return 1;
+	for(long i = 0; i < deals; i++) random_cards(&set[i * 6], 6, &seed);
+
+	for(long i = 0; i < deals; i++){
+		const Card *d = &set[i * 6];
+		for(uint8_t n = 3; n <= 4; n++){
+			HandAccumulator board;
+			hand_acc_init(&board);
+			for(uint8_t k = 0; k < n; k++) hand_acc_add(&board, d[2 + k]);
+			DrawInfo di;
+			draw_classify(&board, d[0], d[1], &di);
+			uint16_t ref[4];
+			brute(d, &d[2], n, ref);
+			uint8_t outs = 0;
+			for(uint8_t s = 0; s < 4; s++){
+				if(ref[s] != di.outMask[s]) bad++;
+				outs += __builtin_popcount(ref[s]);
+			}
+			if(outs != di.outs) bad++;
+			for(uint8_t f = 0; f < 4; f++){
+				if(di.flags & (1 << f)) flagCount[n - 3][f]++;
+			}
+			outsTotal[n - 3] += di.outs;
+		}
+	}
+	const char *names[4] = {"flush draw", "open-ended", "gutshot", "overcards"};
+	printf("%-12s %9s %9s\n", "", "flop", "turn");
+	for(uint8_t f = 0; f < 4; f++){
+		printf("%-12s %8.2f%% %8.2f%%\n", names[f], 100.0 * flagCount[0][f] / deals, 100.0 * flagCount[1][f] / deals);
+	}
+	printf("%-12s %9.2f %9.2f\n", "avg outs", (double)outsTotal[0] / deals, (double)outsTotal[1] / deals);
+
+	volatile uint32_t sink = 0;
+	double t0 = now_sec();
+	for(long i = 0; i < deals; i++){
+		const Card *d = &set[i * 6];
+		HandAccumulator board;
+		hand_acc_init(&board);
+		for(uint8_t k = 0; k < 3; k++) hand_acc_add(&board, d[2 + k]);
+		DrawInfo di;
+		draw_classify(&board, d[0], d[1], &di);
+		sink += di.outs;
+	}
+	double t = now_sec() - t0;
+	printf("draw_classify %.1f ns per flop\n", t / deals * 1e9);
+	printf("%s, %ld mismatches\n", bad ? "FAILED" : "ok", bad);
+	free(set);
+	return bad ? 1 : 0;
+}
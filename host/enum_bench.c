@@ -0,0 +1,321 @@
+/*
+ * enum_bench.c
+ *
+ * Evaluator regression gate: enumerates all 133,784,560 seven card hands, checks every
+ * backend against evaluate_hand_strength() and the known category totals, and reports
+ * hands/second per backend and thread count. Work is split across threads by the index
+ * of the first card. The reference is the compiled in EVAL_BACKEND (tables by default,
+ * add -DEVAL_BACKEND=1 to the build to gate the bitmask backend). Build from the repo root:
+ *   gcc -O2 -pthread -Ihost -IPokerProject113025/PokerProject113025 -o enum_bench \
+ *       host/enum_bench.c host/eval_batch.c host/hand_ranks.c \
+ *       PokerProject113025/PokerProject113025/card.c PokerProject113025/PokerProject113025/rank_tables.c
+ *   ./enum_bench [-t 1,2,4] [-r HandRanks.dat] [-v]
+ * -v only validates, without the timing runs. Exit status is non zero on any mismatch.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "eval_batch.h"
+#include "hand_ranks.h"
+
+#define TOTAL_HANDS 133784560ull
+#define BLOCK 4096
+#define MAX_BACKENDS 6
+#define MAX_THREADS 64
+
+static const uint64_t expectedTotals[10] = { //Per HandRankType, royal flush on its own
+	23294460, 58627800, 31433400, 6461620, 6180020, 4047644, 3473184, 224848, 37260, 4324
+};
+
+typedef struct{
+	Card cards[BLOCK][7];
+	uint32_t n;
+} HandBlock;
+
+typedef void (*BlockEval)(const HandBlock *blk, uint32_t *out, uint8_t toStrength);
+
+typedef struct{
+	const char *name;
+	BlockEval eval;
+} Backend;
+
+static HandRanks handRanks;
+
+static void eval_default(const HandBlock *blk, uint32_t *out, uint8_t toStrength){
+	(void)toStrength;
+	for(uint32_t i = 0; i < blk->n; i++){
+		out[i] = evaluate_hand_strength((Card *)blk->cards[i]);
+	}
+}
+
+static void eval_counting(const HandBlock *blk, uint32_t *out, uint8_t toStrength){
+	(void)toStrength;
+	for(uint32_t i = 0; i < blk->n; i++){
+		HandValue hv = evaluate_best_hand_counting((Card *)blk->cards[i]);
+		out[i] = hand_strength(&hv);
+	}
+}
+
+static void eval_tiny(const HandBlock *blk, uint32_t *out, uint8_t toStrength){
+	(void)toStrength;
+	for(uint32_t i = 0; i < blk->n; i++){
+		HandValue hv = evaluate_best_hand_tiny((Card *)blk->cards[i]);
+		out[i] = hand_strength(&hv);
+	}
+}
+
+static void eval_const(const HandBlock *blk, uint32_t *out, uint8_t toStrength){
+	(void)toStrength;
+	for(uint32_t i = 0; i < blk->n; i++){
+		HandValue hv = evaluate_best_hand_const((Card *)blk->cards[i]);
+		out[i] = hand_strength(&hv);
+	}
+}
+
+static void eval_table(const HandBlock *blk, uint32_t *out, uint8_t toStrength){
+	(void)toStrength;
+	for(uint32_t i = 0; i < blk->n; i++){
+		uint8_t ids[7];
+		for(uint8_t k = 0; k < 7; k++){
+			ids[k] = hand_ranks_card(blk->cards[i][k]);
+		}
+		out[i] = hand_ranks_eval7(&handRanks, ids);
+	}
+}
+
+static void eval_batched(const HandBlock *blk, uint32_t *out, uint8_t toStrength){
+	uint16_t masks[4][BLOCK];
+	HandBatch b = {{masks[0], masks[1], masks[2], masks[3]}, blk->n};
+	for(uint32_t i = 0; i < blk->n; i++){
+		eval_batch_set(&b, i, blk->cards[i], 7);
+	}
+	eval_batch(&b, out);
+	if(toStrength){ //Keys only order like strengths, convert when checking
+		for(uint32_t i = 0; i < blk->n; i++){
+			out[i] = eval_batch_key_strength(out[i]);
+		}
+	}
+}
+
+static Backend backends[MAX_BACKENDS];
+static uint8_t numBackends = 0;
+
+//Shared job state
+static int nextFirst;
+static uint8_t validating;
+static const Backend *timedBackend;
+
+typedef struct{
+	pthread_t thread;
+	uint64_t hands;
+	uint64_t hist[10];
+	uint32_t sink;
+} Worker;
+
+typedef struct{
+	uint8_t found;
+	uint8_t backend;
+	uint64_t ordinal; //Hand number inside this first card job
+	Card cards[7];
+	uint32_t want, got;
+} Mismatch;
+
+static Mismatch firstMismatch[52];
+
+static void process_block(Worker *w, HandBlock *blk, int first, uint64_t base){
+	static __thread uint32_t ref[BLOCK], got[BLOCK];
+	if(!validating){
+		timedBackend->eval(blk, got, 0);
+		w->sink += got[0];
+		w->hands += blk->n;
+		blk->n = 0;
+		return;
+	}
+	eval_default(blk, ref, 1);
+	for(uint32_t i = 0; i < blk->n; i++){
+		HandRankType t = strength_to_type((uint16_t)ref[i]);
+		w->hist[t]++;
+	}
+	for(uint8_t b = 0; b < numBackends; b++){
+		if(backends[b].eval == eval_default) continue;
+		backends[b].eval(blk, got, 1);
+		for(uint32_t i = 0; i < blk->n; i++){
+			if(got[i] != ref[i] && !firstMismatch[first].found){
+				Mismatch *m = &firstMismatch[first];
+				m->found = 1;
+				m->backend = b;
+				m->ordinal = base + i;
+				memcpy(m->cards, blk->cards[i], sizeof(m->cards));
+				m->want = ref[i];
+				m->got = got[i];
+			}
+		}
+	}
+	w->hands += blk->n;
+	blk->n = 0;
+}
+
+static void run_first(Worker *w, HandBlock *blk, int a){
+	//All hands whose lowest card index is a, in lexicographic order
+	uint64_t base = 0;
+	Card c[7];
+	c[0] = card_from_index((uint8_t)a);
+	for(int b = a + 1; b < 52; b++){
+		c[1] = card_from_index((uint8_t)b);
+		for(int d = b + 1; d < 52; d++){
+			c[2] = card_from_index((uint8_t)d);
+			for(int e = d + 1; e < 52; e++){
+				c[3] = card_from_index((uint8_t)e);
+				for(int f = e + 1; f < 52; f++){
+					c[4] = card_from_index((uint8_t)f);
+					for(int g = f + 1; g < 52; g++){
+						c[5] = card_from_index((uint8_t)g);
+						for(int h = g + 1; h < 52; h++){
+							c[6] = card_from_index((uint8_t)h);
+							memcpy(blk->cards[blk->n++], c, sizeof(c));
+							if(blk->n == BLOCK){
+								process_block(w, blk, a, base);
+								base += BLOCK;
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+	if(blk->n){
+		process_block(w, blk, a, base);
+	}
+}
+
+static void *worker_main(void *arg){
+	Worker *w = arg;
+	HandBlock *blk = malloc(sizeof(HandBlock));
+	blk->n = 0;
+	for(;;){
+		int a = __atomic_fetch_add(&nextFirst, 1, __ATOMIC_RELAXED);
+		if(a > 45) break;
+		run_first(w, blk, a);
+	}
+	free(blk);
+	return NULL;
+}
+
+static double run_all(int threads, Worker *workers){
+	struct timespec t0, t1;
+	nextFirst = 0;
+	memset(workers, 0, sizeof(Worker) * threads);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for(int t = 0; t < threads; t++){
+		pthread_create(&workers[t].thread, NULL, worker_main, &workers[t]);
+	}
+	for(int t = 0; t < threads; t++){
+		pthread_join(workers[t].thread, NULL);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	return (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+}
+
+static int validate(int threads){
+	static Worker workers[MAX_THREADS];
+	uint64_t hist[10] = {0}, hands = 0;
+	validating = 1;
+	memset(firstMismatch, 0, sizeof(firstMismatch));
+	double dt = run_all(threads, workers);
+	for(int t = 0; t < threads; t++){
+		hands += workers[t].hands;
+		for(int k = 0; k < 10; k++) hist[k] += workers[t].hist[k];
+	}
+
+	int bad = (hands != TOTAL_HANDS);
+	printf("validated %llu hands in %.1f s\n", (unsigned long long)hands, dt);
+	printf("%-16s %12s %12s\n", "category", "count", "expected");
+	for(int k = 0; k < 10; k++){
+		printf("%-16s %12llu %12llu%s\n", hand_type_to_string((HandRankType)k), (unsigned long long)hist[k],
+			(unsigned long long)expectedTotals[k], hist[k] == expectedTotals[k] ? "" : "  <-- MISMATCH");
+		bad |= (hist[k] != expectedTotals[k]);
+	}
+	for(int a = 0; a < 52; a++){
+		const Mismatch *m = &firstMismatch[a];
+		if(!m->found) continue;
+		char buf[7][8];
+		for(int k = 0; k < 7; k++){
+			card_toString(m->cards[k], buf[k], sizeof(buf[k]));
+		}
+		printf("first disagreement: backend %s, first card %d hand %llu: %s %s %s %s %s %s %s want %u got %u\n",
+			backends[m->backend].name, a, (unsigned long long)m->ordinal,
+			buf[0], buf[1], buf[2], buf[3], buf[4], buf[5], buf[6], m->want, m->got);
+		bad = 1;
+		break;
+	}
+	if(!bad){
+		printf("all %u backends agree on every hand\n", numBackends);
+	}
+	return bad;
+}
+
+int main(int argc, char **argv){
+	int threadCounts[16] = {1}, numCounts = 1;
+	const char *ranksPath = NULL;
+	int validateOnly = 0;
+	for(int i = 1; i < argc; i++){
+		if(strcmp(argv[i], "-t") == 0 && i + 1 < argc){
+			numCounts = 0;
+			for(char *tok = strtok(argv[++i], ","); tok && numCounts < 16; tok = strtok(NULL, ",")){
+				int t = atoi(tok);
+				threadCounts[numCounts++] = (t < 1) ? 1 : (t > MAX_THREADS ? MAX_THREADS : t);
+			}
+		}
+		else if(strcmp(argv[i], "-r") == 0 && i + 1 < argc){
+			ranksPath = argv[++i];
+		}
+		else if(strcmp(argv[i], "-v") == 0){
+			validateOnly = 1;
+		}
+	}
+
+	backends[numBackends++] = (Backend){eval_backend_name(), eval_default};
+	backends[numBackends++] = (Backend){"counting", eval_counting};
+	backends[numBackends++] = (Backend){"tiny", eval_tiny};
+	backends[numBackends++] = (Backend){"constant", eval_const};
+	backends[numBackends++] = (Backend){eval_batch_has_avx2() ? "batch-avx2" : "batch", eval_batched};
+	if(ranksPath){
+		if(hand_ranks_open(&handRanks, ranksPath) == 0){
+			backends[numBackends++] = (Backend){"hand-ranks", eval_table};
+		}
+		else{
+			fprintf(stderr, "can not map %s, skipping the hand-ranks backend\n", ranksPath);
+		}
+	}
+
+	int maxThreads = 1;
+	for(int i = 0; i < numCounts; i++){
+		if(threadCounts[i] > maxThreads) maxThreads = threadCounts[i];
+	}
+	int bad = validate(maxThreads);
+	if(validateOnly){
+		return bad;
+	}
+
+	static Worker workers[MAX_THREADS];
+	validating = 0;
+	printf("\n%-12s", "backend");
+	for(int i = 0; i < numCounts; i++){
+		printf(" %9d thr", threadCounts[i]);
+	}
+	printf("   (M hands/s)\n");
+	for(uint8_t b = 0; b < numBackends; b++){
+		timedBackend = &backends[b];
+		printf("%-12s", backends[b].name);
+		for(int i = 0; i < numCounts; i++){
+			double dt = run_all(threadCounts[i], workers);
+			printf(" %13.1f", TOTAL_HANDS / dt / 1e6);
+			fflush(stdout);
+		}
+		printf("\n");
+	}
+	return bad;
+}
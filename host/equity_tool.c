@@ -0,0 +1,187 @@
+/*
+ * equity_tool.c
+ *
+ * Exact heads-up equity with equity.c, the preflop case split across threads with
+ * equity_exact_part(). Build from the repo root:
+ *   gcc -O2 -pthread -IPokerProject113025/PokerProject113025 -o equity_tool host/equity_tool.c \
+ *       PokerProject113025/PokerProject113025/equity.c \
+ *       PokerProject113025/PokerProject113025/card.c PokerProject113025/PokerProject113025/rank_tables.c
+ *   ./equity_tool [-t threads] [-c] [-m samples] As Kd Qh Qc [board cards...]
+ * One card per argument, rank (A 2-9 T/10 J Q K) then suit (h d c s): player 1's two hole cards,
+ * player 2's, then the board. -c also runs a plain 7 card array
+ * loop over the same runouts with evaluate_hand_strength() and fails if the counts differ.
+ * -m adds the Monte Carlo estimate (EquityMc) from that many random runouts next to the exact one.
+ * Without cards, a fixed set of hands is checked on every street.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "equity.h"
+#include "bench_util.h"
+
+#define MAX_THREADS 64
+
+typedef struct{
+	pthread_t thread;
+	const Card *h1, *h2, *board;
+	uint8_t n, part, parts;
+	EquityResult er;
+} Worker;
+
+static int parse_card(const char *s, Card *c){
+	const char *ranks = "A23456789TJQK", *suits = "hdcs";
+	const char *r = (strncmp(s, "10", 2) == 0) ? "T" : s;
+	const char *rp = strchr(ranks, r[0]);
+	size_t len = strlen(s);
+	if(len != ((r == s) ? 2 : 3) || !rp || !*rp) return 0;
+	const char *sp = strchr(suits, s[len - 1]);
+	if(!sp || !*sp) return 0;
+	c->rank = (uint8_t)(rp - ranks + 1);
+	c->suit = (Suit)(sp - suits);
+	return 1;
+}
+
+static void *worker_main(void *arg){
+	Worker *w = arg;
+	equity_exact_part(w->h1, w->h2, w->board, w->n, w->part, w->parts, &w->er);
+	return NULL;
+}
+
+static void equity_threads(const Card h1[2], const Card h2[2], const Card *board, uint8_t n, uint8_t threads, EquityResult *er){
+	Worker w[MAX_THREADS];
+	for(uint8_t t = 0; t < threads; t++){
+		w[t] = (Worker){.h1 = h1, .h2 = h2, .board = board, .n = n, .part = t, .parts = threads};
+		pthread_create(&w[t].thread, NULL, worker_main, &w[t]);
+	}
+	memset(er, 0, sizeof(*er));
+	for(uint8_t t = 0; t < threads; t++){
+		pthread_join(w[t].thread, NULL);
+		er->win += w[t].er.win;
+		er->tie += w[t].er.tie;
+		er->loss += w[t].er.loss;
+		er->runouts += w[t].er.runouts;
+	}
+}
+
+static void equity_plain(const Card h1[2], const Card h2[2], const Card *board, uint8_t n, EquityResult *er){
+	//Reference: every 5 card board through plain 7 card arrays
+	uint64_t dead = 0;
+	for(uint8_t i = 0; i < n; i++) dead |= 1ull << card_index(board[i]);
+	for(uint8_t i = 0; i < 2; i++) dead |= (1ull << card_index(h1[i])) | (1ull << card_index(h2[i]));
+	memset(er, 0, sizeof(*er));
+	uint8_t idx[5];
+	for(idx[0] = 0; idx[0] < 52; idx[0]++)
+	for(idx[1] = idx[0] + 1; idx[1] < 52; idx[1]++)
+	for(idx[2] = idx[1] + 1; idx[2] < 52; idx[2]++)
+	for(idx[3] = idx[2] + 1; idx[3] < 52; idx[3]++)
+	for(idx[4] = idx[3] + 1; idx[4] < 52; idx[4]++){
+		//The board cards given must be in the set, the rest must be live
+		uint64_t set = 0;
+		for(uint8_t k = 0; k < 5; k++) set |= 1ull << idx[k];
+		uint64_t given = dead & set;
+		if(__builtin_popcountll(given) != n) continue;
+		uint8_t ok = 1;
+		for(uint8_t i = 0; i < n; i++) if(!(set & (1ull << card_index(board[i])))) ok = 0;
+		if(!ok || (set & dead & ~given)) continue;
+		Card a[7], b[7];
+		for(uint8_t k = 0; k < 5; k++) a[k] = b[k] = card_from_index(idx[k]);
+		a[5] = h1[0]; a[6] = h1[1];
+		b[5] = h2[0]; b[6] = h2[1];
+		uint16_t sa = evaluate_hand_strength(a), sb = evaluate_hand_strength(b);
+		if(sa > sb) er->win++;
+		else if(sa < sb) er->loss++;
+		else er->tie++;
+		er->runouts++;
+	}
+}
+
+static uint32_t mcSamples = 0;
+
+static void report_mc(const Card h1[2], const Card h2[2], const Card *board, uint8_t n, uint16_t exact){
+	EquityMc mc;
+	equity_mc_start(&mc, h1, h2, board, n, 1);
+	double t0 = now_sec();
+	for(uint32_t left = mcSamples; left > 0; ){
+		uint16_t step = (left > 60000) ? 60000 : (uint16_t)left;
+		equity_mc_samples(&mc, step);
+		left -= step;
+	}
+	double t = now_sec() - t0;
+	uint16_t e = equity_p1(&mc.er);
+	int diff = (int)e - (int)exact;
+	printf("  monte carlo %8u samples  P1 %2u.%02u%%  (%+.2f points)  %8.2f ms\n", mc.er.runouts,
+		e / 100, e % 100, diff / 100.0, t * 1e3);
+}
+
+static int report(const char *label, const Card h1[2], const Card h2[2], const Card *board, uint8_t n, uint8_t threads, int check){
+	EquityResult er, ref;
+	double t0 = now_sec();
+	equity_threads(h1, h2, board, n, threads, &er);
+	double t = now_sec() - t0;
+	uint16_t e = equity_p1(&er);
+	printf("%-28s %8u runouts  win %8u tie %7u loss %8u  P1 %2u.%02u%%  %8.2f ms\n", label, er.runouts,
+		er.win, er.tie, er.loss, e / 100, e % 100, t * 1e3);
+	if(mcSamples) report_mc(h1, h2, board, n, e);
+	if(!check) return 0;
+	equity_plain(h1, h2, board, n, &ref);
+	if(memcmp(&er, &ref, sizeof(er)) != 0){
+		printf("  MISMATCH: plain loop win %u tie %u loss %u runouts %u\n", ref.win, ref.tie, ref.loss, ref.runouts);
+		return 1;
+	}
+	return 0;
+}
+
+int main(int argc, char **argv){
+	int threads = 1, check = 0, nc = 0;
+	Card cards[9];
+	for(int i = 1; i < argc; i++){
+		if(strcmp(argv[i], "-t") == 0 && i + 1 < argc){
+			threads = atoi(argv[++i]);
+			if(threads < 1) threads = 1;
+			if(threads > MAX_THREADS) threads = MAX_THREADS;
+		}
+		else if(strcmp(argv[i], "-c") == 0){
+			check = 1;
+		}
+		else if(strcmp(argv[i], "-m") == 0 && i + 1 < argc){
+			mcSamples = (uint32_t)atol(argv[++i]);
+		}
+		else if(nc < 9 && parse_card(argv[i], &cards[nc])){
+			nc++;
+		}
+		else{
+			fprintf(stderr, "bad card %s\n", argv[i]);
+			return 1;
+		}
+	}
+
+	int bad = 0;
+	if(nc == 0){
+		//AsAh KsKh, then a flop, turn and river that keep it close
+		Card fixed[9] = {{1, 3}, {1, 0}, {13, 3}, {13, 0}, {12, 3}, {11, 3}, {4, 1}, {10, 2}, {2, 1}};
+		const char *labels[6] = {"AsAh vs KsKh preflop", "", "", "flop QsJs4d", "turn Tc", "river 2d"};
+		for(uint8_t n = 0; n <= 5; n++){
+			if(n == 1 || n == 2) continue;
+			bad |= report(labels[n], &fixed[0], &fixed[2], &fixed[4], n, (uint8_t)threads, 1);
+		}
+	}
+	else if(nc < 4 || nc == 5 || nc == 6){
+		fprintf(stderr, "need 2 + 2 hole cards and 0, 3, 4 or 5 board cards\n");
+		return 1;
+	}
+	else{
+		uint64_t seen = 0;
+		for(int i = 0; i < nc; i++){
+			if(seen & (1ull << card_index(cards[i]))){
+				fprintf(stderr, "card given twice\n");
+				return 1;
+			}
+			seen |= 1ull << card_index(cards[i]);
+		}
+		bad |= report("", &cards[0], &cards[2], &cards[4], (uint8_t)(nc - 4), (uint8_t)threads, check);
+	}
+	if(check || nc == 0) printf("%s\n", bad ? "FAILED" : "ok");
+	return bad;
+}
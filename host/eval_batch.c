@@ -0,0 +1,224 @@
+/*
+ * eval_batch.c
+ *
+ * The vector kernel evaluates every category for all 8 lanes at once and blends the keys
+ * from the weakest category to the strongest, so there are no per-hand branches.
+ * Selecting the top k ranks only ever has to drop the 2 lowest ranks for hands of up to
+ * 7 cards, so the kernel does exactly two conditional "clear lowest bit" steps.
+ */
+
+#include <string.h>
+#include "eval_batch.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86 1
+#endif
+
+#define KEY(cat, hi, lo) (((uint32_t)(cat) << 26) | ((uint32_t)(hi) << 13) | (uint32_t)(lo))
+
+void eval_batch_set(HandBatch *b, size_t i, const Card *cards, uint8_t n){
+	for(uint8_t s = 0; s < 4; s++){
+		b->suitMask[s][i] = 0;
+	}
+	for(uint8_t k = 0; k < n; k++){
+		b->suitMask[cards[k].suit][i] |= card_rank_bit(cards[k]);
+	}
+}
+
+uint32_t hand_value_key(const HandValue *hv){
+	const uint8_t *r = hv->ranks;
+	switch(hv->type){
+		case HAND_HIGH_CARD:
+		case HAND_FLUSH:
+			return KEY(hv->type, 0, RANK_BIT(r[0]) | RANK_BIT(r[1]) | RANK_BIT(r[2]) | RANK_BIT(r[3]) | RANK_BIT(r[4]));
+		case HAND_ONE_PAIR:
+			return KEY(hv->type, RANK_BIT(r[0]), RANK_BIT(r[1]) | RANK_BIT(r[2]) | RANK_BIT(r[3]));
+		case HAND_TWO_PAIR:
+			return KEY(hv->type, RANK_BIT(r[0]) | RANK_BIT(r[1]), RANK_BIT(r[2]));
+		case HAND_THREE_OF_A_KIND:
+			return KEY(hv->type, RANK_BIT(r[0]), RANK_BIT(r[1]) | RANK_BIT(r[2]));
+		case HAND_STRAIGHT:
+			return KEY(hv->type, 0, RANK_BIT(r[0]));
+		case HAND_FULL_HOUSE:
+		case HAND_FOUR_OF_A_KIND:
+			return KEY(hv->type, RANK_BIT(r[0]), RANK_BIT(r[1]));
+		case HAND_STRAIGHT_FLUSH:
+		case HAND_ROYAL_FLUSH:
+			return KEY(HAND_STRAIGHT_FLUSH, 0, RANK_BIT(r[0]));
+		default:
+			return 0;
+	}
+}
+
+static uint8_t take_high(uint16_t *m){
+	//Remove and return the highest rank of the mask
+	for(uint8_t v = 14; v >= 2; v--){
+		if(*m & RANK_BIT(v)){
+			*m &= (uint16_t)~RANK_BIT(v);
+			return v;
+		}
+	}
+	return 0;
+}
+
+uint16_t eval_batch_key_strength(uint32_t key){
+	HandValue hv = {(HandRankType)(key >> 26), {0}};
+	uint16_t hi = (uint16_t)((key >> 13) & 0x1FFF), lo = (uint16_t)(key & 0x1FFF);
+	uint8_t k = 0;
+	while(hi){
+		hv.ranks[k++] = take_high(&hi);
+	}
+	while(lo && k < 5){
+		hv.ranks[k++] = take_high(&lo);
+	}
+	return hand_strength(&hv);
+}
+
+void eval_batch_scalar(const HandBatch *b, uint32_t *keys){
+	for(size_t i = 0; i < b->count; i++){
+		HandAccumulator acc;
+		acc.count = 7;
+		for(uint8_t s = 0; s < 4; s++){
+			acc.suitMask[s] = b->suitMask[s][i];
+		}
+		HandValue hv = hand_acc_best(&acc);
+		keys[i] = hand_value_key(&hv);
+	}
+}
+
+#ifdef HAVE_X86
+
+#define AVX2_FN __attribute__((target("avx2")))
+
+AVX2_FN static inline __m256i v_popcount13(__m256i m){
+	const __m256i lut = _mm256_setr_epi8(0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4, 0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4);
+	const __m256i low = _mm256_set1_epi8(0x0F);
+	__m256i c = _mm256_add_epi8(_mm256_shuffle_epi8(lut, _mm256_and_si256(m, low)),
+		_mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(m, 4), low)));
+	return _mm256_and_si256(_mm256_add_epi32(c, _mm256_srli_epi32(c, 8)), _mm256_set1_epi32(0xFF));
+}
+
+AVX2_FN static inline __m256i v_nonzero(__m256i m){
+	return _mm256_xor_si256(_mm256_cmpeq_epi32(m, _mm256_setzero_si256()), _mm256_set1_epi32(-1));
+}
+
+AVX2_FN static inline __m256i v_msb(__m256i m){
+	//Highest set bit only
+	m = _mm256_or_si256(m, _mm256_srli_epi32(m, 1));
+	m = _mm256_or_si256(m, _mm256_srli_epi32(m, 2));
+	m = _mm256_or_si256(m, _mm256_srli_epi32(m, 4));
+	m = _mm256_or_si256(m, _mm256_srli_epi32(m, 8));
+	return _mm256_xor_si256(m, _mm256_srli_epi32(m, 1));
+}
+
+AVX2_FN static inline __m256i v_top(__m256i m, int k){
+	//Keep the k highest ranks, at most 2 need dropping for 7 cards
+	__m256i n = v_popcount13(m);
+	__m256i kv = _mm256_set1_epi32(k);
+	for(int step = 0; step < 2; step++){
+		__m256i over = _mm256_cmpgt_epi32(n, kv);
+		__m256i cleared = _mm256_and_si256(m, _mm256_sub_epi32(m, _mm256_set1_epi32(1)));
+		m = _mm256_blendv_epi8(m, cleared, over);
+		n = _mm256_add_epi32(n, over); //over is -1 where a bit was dropped
+	}
+	return m;
+}
+
+AVX2_FN static inline __m256i v_straight(__m256i m){
+	//Top bit of the 5 long run, bit 0 = 5 high (wheel) ... bit 9 = Ace high, 0 if none
+	__m256i ext = _mm256_or_si256(_mm256_slli_epi32(m, 1), _mm256_and_si256(_mm256_srli_epi32(m, 12), _mm256_set1_epi32(1)));
+	__m256i run = _mm256_and_si256(ext, _mm256_srli_epi32(ext, 1));
+	run = _mm256_and_si256(run, _mm256_srli_epi32(ext, 2));
+	run = _mm256_and_si256(run, _mm256_srli_epi32(ext, 3));
+	run = _mm256_and_si256(run, _mm256_srli_epi32(ext, 4));
+	return v_msb(run);
+}
+
+AVX2_FN static inline __m256i v_key(int cat, __m256i hi, __m256i lo){
+	return _mm256_or_si256(_mm256_set1_epi32(cat << 26), _mm256_or_si256(_mm256_slli_epi32(hi, 13), lo));
+}
+
+AVX2_FN static inline __m256i v_pick(__m256i key, __m256i cond, __m256i candidate){
+	return _mm256_blendv_epi8(key, candidate, cond);
+}
+
+AVX2_FN static void eval_batch_avx2(const HandBatch *b, uint32_t *keys){
+	size_t i = 0;
+	const __m256i four = _mm256_set1_epi32(4); //A suit with more than 4 ranks is a flush
+	for(; i + 8 <= b->count; i += 8){
+		__m256i h = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&b->suitMask[0][i]));
+		__m256i d = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&b->suitMask[1][i]));
+		__m256i c = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&b->suitMask[2][i]));
+		__m256i s = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&b->suitMask[3][i]));
+
+		__m256i any = _mm256_or_si256(_mm256_or_si256(h, d), _mm256_or_si256(c, s));
+		__m256i hd = _mm256_and_si256(h, d), cs = _mm256_and_si256(c, s);
+		__m256i atLeast2 = _mm256_or_si256(_mm256_or_si256(hd, cs),
+			_mm256_and_si256(_mm256_or_si256(h, d), _mm256_or_si256(c, s)));
+		__m256i atLeast3 = _mm256_or_si256(_mm256_and_si256(hd, _mm256_or_si256(c, s)), _mm256_and_si256(cs, _mm256_or_si256(h, d)));
+		__m256i quads = _mm256_and_si256(hd, cs);
+		__m256i trips = _mm256_andnot_si256(quads, atLeast3);
+		__m256i pairs = _mm256_andnot_si256(atLeast3, atLeast2);
+
+		__m256i flush = _mm256_setzero_si256();
+		flush = _mm256_or_si256(flush, _mm256_and_si256(h, _mm256_cmpgt_epi32(v_popcount13(h), four)));
+		flush = _mm256_or_si256(flush, _mm256_and_si256(d, _mm256_cmpgt_epi32(v_popcount13(d), four)));
+		flush = _mm256_or_si256(flush, _mm256_and_si256(c, _mm256_cmpgt_epi32(v_popcount13(c), four)));
+		flush = _mm256_or_si256(flush, _mm256_and_si256(s, _mm256_cmpgt_epi32(v_popcount13(s), four)));
+
+		//Ranks are bit (v - 2), a straight's high card is bit (run bit + 3)
+		__m256i straight = _mm256_slli_epi32(v_straight(any), 3);
+		__m256i straightFlush = _mm256_slli_epi32(v_straight(flush), 3);
+		__m256i zero = _mm256_setzero_si256();
+
+		__m256i key = v_key(HAND_HIGH_CARD, zero, v_top(any, 5));
+		key = v_pick(key, v_nonzero(pairs), v_key(HAND_ONE_PAIR, v_msb(pairs), v_top(_mm256_andnot_si256(pairs, any), 3)));
+		__m256i twoPairs = v_top(pairs, 2);
+		key = v_pick(key, _mm256_cmpgt_epi32(v_popcount13(pairs), _mm256_set1_epi32(1)),
+			v_key(HAND_TWO_PAIR, twoPairs, v_msb(_mm256_andnot_si256(twoPairs, any))));
+		key = v_pick(key, v_nonzero(trips), v_key(HAND_THREE_OF_A_KIND, v_msb(trips), v_top(_mm256_andnot_si256(trips, any), 2)));
+		key = v_pick(key, v_nonzero(straight), v_key(HAND_STRAIGHT, zero, straight));
+		key = v_pick(key, v_nonzero(flush), v_key(HAND_FLUSH, zero, v_top(flush, 5)));
+		__m256i triple = v_msb(trips);
+		__m256i fullPair = v_msb(_mm256_andnot_si256(triple, _mm256_or_si256(trips, pairs)));
+		key = v_pick(key, _mm256_and_si256(v_nonzero(triple), v_nonzero(fullPair)), v_key(HAND_FULL_HOUSE, triple, fullPair));
+		key = v_pick(key, v_nonzero(quads), v_key(HAND_FOUR_OF_A_KIND, quads, v_msb(_mm256_andnot_si256(quads, any))));
+		key = v_pick(key, v_nonzero(straightFlush), v_key(HAND_STRAIGHT_FLUSH, zero, straightFlush));
+
+		_mm256_storeu_si256((__m256i *)&keys[i], key);
+	}
+	if(i < b->count){ //Tail
+		HandBatch tail = *b;
+		for(uint8_t su = 0; su < 4; su++){
+			tail.suitMask[su] = b->suitMask[su] + i;
+		}
+		tail.count = b->count - i;
+		eval_batch_scalar(&tail, keys + i);
+	}
+}
+
+int eval_batch_has_avx2(void){
+	return __builtin_cpu_supports("avx2");
+}
+
+void eval_batch(const HandBatch *b, uint32_t *keys){
+	if(eval_batch_has_avx2()){
+		eval_batch_avx2(b, keys);
+	}
+	else{
+		eval_batch_scalar(b, keys);
+	}
+}
+
+#else
+
+int eval_batch_has_avx2(void){
+	return 0;
+}
+
+void eval_batch(const HandBatch *b, uint32_t *keys){
+	eval_batch_scalar(b, keys);
+}
+
+#endif
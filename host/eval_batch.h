@@ -0,0 +1,34 @@
+/*
+ * eval_batch.h
+ *
+ * Batched hand evaluation for host simulations. Hands are passed structure-of-arrays:
+ * one array of 13 bit rank masks per suit (bit 0 = 2 ... bit 12 = Ace), the same masks
+ * HandAccumulator keeps. The AVX2 kernel evaluates 8 hands per instruction, other CPUs
+ * use the scalar path; both give identical results.
+ *
+ * Results are 32 bit ordering keys: category << 26 | primary ranks << 13 | kicker ranks.
+ * Keys compare exactly like compare_hands(), and eval_batch_key_strength() turns one
+ * into the 1..7462 hand_strength() value.
+ */
+
+#ifndef EVAL_BATCH_H
+#define EVAL_BATCH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "card.h"
+
+typedef struct{
+	uint16_t *suitMask[4]; //suitMask[s][i] = ranks of suit s in hand i
+	size_t count;
+} HandBatch;
+
+void eval_batch_set(HandBatch *b, size_t i, const Card *cards, uint8_t n); //Store up to 7 cards as hand i
+void eval_batch(const HandBatch *b, uint32_t *keys); //keys[i] for every hand, picks AVX2 when the CPU has it
+void eval_batch_scalar(const HandBatch *b, uint32_t *keys);
+int eval_batch_has_avx2(void);
+
+uint32_t hand_value_key(const HandValue *hv); //Ordering key of a HandValue, what the batch kernels compute
+uint16_t eval_batch_key_strength(uint32_t key);
+
+#endif
@@ -0,0 +1,60 @@
+/*
+ * eval_batch_bench.c
+ *
+ * Throughput of the batched evaluator against one-at-a-time evaluate_best_hand().
+ * Build from the repo root:
+ *   gcc -O2 -Ihost -IPokerProject113025/PokerProject113025 -o eval_batch_bench \
+ *       host/eval_batch_bench.c host/eval_batch.c \
+ *       PokerProject113025/PokerProject113025/card.c PokerProject113025/PokerProject113025/rank_tables.c
+ *   ./eval_batch_bench [hands]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "eval_batch.h"
+#include "bench_util.h"
+
+int main(int argc, char **argv){
+	size_t n = (argc > 1) ? (size_t)atol(argv[1]) : 4000000;
+	Card (*hands)[7] = malloc(n * sizeof(*hands));
+	HandBatch batch = {{malloc(n * 2), malloc(n * 2), malloc(n * 2), malloc(n * 2)}, n};
+	uint32_t *keys = malloc(n * sizeof(uint32_t));
+	uint16_t *strengths = malloc(n * sizeof(uint16_t));
+
+	uint32_t seed = 3;
+	for(size_t i = 0; i < n; i++){
+		random_cards(hands[i], 7, &seed);
+		eval_batch_set(&batch, i, hands[i], 7);
+	}
+
+	double t0 = now_sec();
+	for(size_t i = 0; i < n; i++){
+		strengths[i] = evaluate_hand_strength(hands[i]);
+	}
+	double tOne = now_sec() - t0;
+
+	t0 = now_sec();
+	eval_batch_scalar(&batch, keys);
+	double tScalar = now_sec() - t0;
+
+	t0 = now_sec();
+	eval_batch(&batch, keys);
+	double tBatch = now_sec() - t0;
+
+	size_t bad = 0;
+	for(size_t i = 0; i < n; i++){
+		if(eval_batch_key_strength(keys[i]) != strengths[i]) bad++;
+	}
+	//Keys must also order like the strengths
+	for(size_t i = 1; i < n; i++){
+		int a = (keys[i] > keys[i - 1]) - (keys[i] < keys[i - 1]);
+		int b = (strengths[i] > strengths[i - 1]) - (strengths[i] < strengths[i - 1]);
+		if(a != b) bad++;
+	}
+
+	printf("%zu hands, %zu mismatches\n", n, bad);
+	printf("evaluate_hand_strength  %7.1f M hands/s\n", n / tOne / 1e6);
+	printf("eval_batch_scalar       %7.1f M hands/s\n", n / tScalar / 1e6);
+	printf("eval_batch (%s)      %7.1f M hands/s\n", eval_batch_has_avx2() ? "AVX2" : "scalar", n / tBatch / 1e6);
+	return bad != 0;
+}
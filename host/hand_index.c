@@ -0,0 +1,367 @@
+/*
+ * hand_index.c
+ *
+ * Suit isomorphism indexer. A hand is seen per suit as the list of rank sets that suit
+ * received in each round, and a class is the multiset of those four lists. The index is
+ *   offset of the suit configuration (cards per suit per round, suits sorted)
+ *   + mixed radix over groups of suits with the same configuration,
+ * where each group is a multiset of per suit indices and each per suit index is the colex
+ * rank of every round's rank set among the ranks that suit has left.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "hand_index.h"
+
+static uint64_t smallBinom[64][8]; //Filled by hand_indexer_init(), covers every rank set and most multisets
+
+static uint64_t binom(uint64_t n, uint32_t k){
+	if(k > n) return 0;
+	if(n < 64 && k < 8) return smallBinom[n][k];
+	if(k == 1) return n;
+	if(k == 2 && n < (1ull << 32)) return n * (n - 1) / 2;
+	unsigned __int128 r = 1;
+	for(uint32_t i = 1; i <= k; i++){
+		r = r * (n - k + i) / i;
+	}
+	return (uint64_t)r;
+}
+
+static uint64_t multiset_count(uint64_t n, uint32_t k){ //k values from 0..n-1, repeats allowed
+	return binom(n + k - 1, k);
+}
+
+//Suit configurations compare round by round, more cards first
+static int count_cmp(const uint8_t *a, const uint8_t *b, uint8_t rounds){
+	for(uint8_t r = 0; r < rounds; r++){
+		if(a[r] != b[r]) return (a[r] > b[r]) ? -1 : 1;
+	}
+	return 0;
+}
+
+static uint64_t suit_space(const uint8_t *count, uint8_t rounds){ //Distinct rank set lists for one suit
+	uint64_t size = 1;
+	uint8_t left = 13;
+	for(uint8_t r = 0; r < rounds; r++){
+		size *= binom(left, count[r]);
+		left -= count[r];
+	}
+	return size;
+}
+
+//Suits [s, e) share a configuration
+static uint8_t group_end(const SuitConfig *c, uint8_t s, uint8_t rounds){
+	uint8_t e = s + 1;
+	while(e < 4 && count_cmp(c->count[s], c->count[e], rounds) == 0) e++;
+	return e;
+}
+
+static uint64_t config_size(SuitConfig *c, uint8_t rounds){
+	uint64_t size = 1;
+	c->groups = 0;
+	for(uint8_t s = 0; s < 4; ){
+		uint8_t e = group_end(c, s, rounds);
+		c->groupEnd[c->groups] = e;
+		c->groupSize[c->groups] = multiset_count(suit_space(c->count[s], rounds), e - s);
+		size *= c->groupSize[c->groups++];
+		s = e;
+	}
+	return size;
+}
+
+//Every per suit count list of one round prefix, most cards first
+static uint32_t suit_patterns(const HandIndexer *hi, uint8_t rounds, uint8_t (*out)[HAND_INDEX_MAX_ROUNDS]){
+	uint32_t n = 1;
+	memset(out[0], 0, HAND_INDEX_MAX_ROUNDS);
+	for(uint8_t r = 0; r < rounds; r++){
+		uint32_t m = n;
+		for(uint32_t i = 0; i < n; i++){
+			uint8_t total = 0;
+			for(uint8_t q = 0; q < r; q++) total += out[i][q];
+			for(uint8_t c = 1; c <= hi->cardsPerRound[r] && total + c <= 13; c++){
+				memcpy(out[m], out[i], HAND_INDEX_MAX_ROUNDS);
+				out[m][r] = c;
+				m++;
+			}
+		}
+		n = m;
+	}
+	//Insertion sort, the lists are tiny
+	for(uint32_t i = 1; i < n; i++){
+		uint8_t t[HAND_INDEX_MAX_ROUNDS];
+		memcpy(t, out[i], HAND_INDEX_MAX_ROUNDS);
+		uint32_t j = i;
+		while(j > 0 && count_cmp(out[j - 1], t, rounds) > 0){
+			memcpy(out[j], out[j - 1], HAND_INDEX_MAX_ROUNDS);
+			j--;
+		}
+		memcpy(out[j], t, HAND_INDEX_MAX_ROUNDS);
+	}
+	return n;
+}
+
+static int build_round(HandIndexer *hi, uint8_t round){
+	uint8_t rounds = round + 1;
+	uint8_t pat[256][HAND_INDEX_MAX_ROUNDS];
+	uint32_t np = suit_patterns(hi, rounds, pat);
+	RoundConfigs *rc = &hi->round[round];
+	uint32_t cap = 64;
+	rc->configs = malloc(cap * sizeof(SuitConfig));
+	rc->numConfigs = 0;
+	if(!rc->configs) return -1;
+
+	//Four patterns in sorted order whose per round sums match the deal
+	for(uint32_t a = 0; a < np; a++)
+	for(uint32_t b = a; b < np; b++)
+	for(uint32_t c = b; c < np; c++)
+	for(uint32_t d = c; d < np; d++){
+		uint8_t ok = 1;
+		for(uint8_t r = 0; r < rounds && ok; r++){
+			ok = (pat[a][r] + pat[b][r] + pat[c][r] + pat[d][r] == hi->cardsPerRound[r]);
+		}
+		if(!ok) continue;
+		if(rc->numConfigs == cap){
+			cap *= 2;
+			SuitConfig *grown = realloc(rc->configs, cap * sizeof(SuitConfig));
+			if(!grown) return -1;
+			rc->configs = grown;
+		}
+		SuitConfig *sc = &rc->configs[rc->numConfigs++];
+		memcpy(sc->count[0], pat[a], HAND_INDEX_MAX_ROUNDS);
+		memcpy(sc->count[1], pat[b], HAND_INDEX_MAX_ROUNDS);
+		memcpy(sc->count[2], pat[c], HAND_INDEX_MAX_ROUNDS);
+		memcpy(sc->count[3], pat[d], HAND_INDEX_MAX_ROUNDS);
+	}
+
+	rc->offsets = malloc((rc->numConfigs + 1) * sizeof(uint64_t));
+	if(!rc->offsets) return -1;
+	rc->offsets[0] = 0;
+	for(uint32_t i = 0; i < rc->numConfigs; i++){
+		rc->offsets[i + 1] = rc->offsets[i] + config_size(&rc->configs[i], rounds);
+	}
+	return 0;
+}
+
+int hand_indexer_init(HandIndexer *hi, uint8_t rounds, const uint8_t cardsPerRound[]){
+	uint8_t total = 0;
+	uint32_t patterns = 1; //Bound on per suit count lists, see build_round()
+	memset(hi, 0, sizeof(*hi));
+	for(uint8_t n = 0; n < 64; n++){
+		for(uint8_t k = 0; k < 8; k++){
+			smallBinom[n][k] = (k == 0) ? 1 : (n == 0) ? 0 : smallBinom[n - 1][k - 1] + smallBinom[n - 1][k];
+		}
+	}
+	if(rounds == 0 || rounds > HAND_INDEX_MAX_ROUNDS) return -1;
+	hi->rounds = rounds;
+	for(uint8_t r = 0; r < rounds; r++){
+		hi->cardsPerRound[r] = cardsPerRound[r];
+		total += cardsPerRound[r];
+		patterns *= cardsPerRound[r] + 1;
+		if(cardsPerRound[r] == 0 || total > 52 || patterns > 256) return -1;
+	}
+	for(uint8_t r = 0; r < rounds; r++){
+		if(build_round(hi, r) != 0){
+			hand_indexer_free(hi);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+void hand_indexer_free(HandIndexer *hi){
+	for(uint8_t r = 0; r < HAND_INDEX_MAX_ROUNDS; r++){
+		free(hi->round[r].configs);
+		free(hi->round[r].offsets);
+		hi->round[r].configs = NULL;
+		hi->round[r].offsets = NULL;
+	}
+}
+
+uint64_t hand_indexer_size(const HandIndexer *hi, uint8_t round){
+	const RoundConfigs *rc = &hi->round[round];
+	return rc->offsets[rc->numConfigs];
+}
+
+//Colex rank of the ranks in m, counted among the ranks not in used
+static uint64_t set_rank(uint16_t m, uint16_t used){
+	uint64_t idx = 0;
+	uint32_t i = 1;
+	while(m){
+		uint8_t p = __builtin_ctz(m);
+		idx += smallBinom[p - __builtin_popcount(used & ((1u << p) - 1))][i++];
+		m &= m - 1;
+	}
+	return idx;
+}
+
+static uint16_t set_unrank(uint64_t idx, uint8_t k){
+	uint16_t m = 0;
+	for(uint8_t i = k; i > 0; i--){
+		uint8_t p = i - 1;
+		while(smallBinom[p + 1][i] <= idx) p++;
+		idx -= smallBinom[p][i];
+		m |= 1u << p;
+	}
+	return m;
+}
+
+//Spread m over the ranks not in used, bit j of m is the j-th free rank
+static uint16_t expand(uint16_t m, uint16_t used){
+	uint16_t out = 0;
+	uint8_t j = 0;
+	for(uint8_t b = 0; b < 13; b++){
+		if(used & (1u << b)) continue;
+		if(m & (1u << j)) out |= 1u << b;
+		j++;
+	}
+	return out;
+}
+
+typedef struct{
+	uint8_t count[HAND_INDEX_MAX_ROUNDS];
+	uint64_t index; //Per suit index in 0..suit_space()-1
+} SuitKey;
+
+static int suit_key_cmp(const SuitKey *a, const SuitKey *b, uint8_t rounds){
+	int c = count_cmp(a->count, b->count, rounds);
+	if(c) return c;
+	return (a->index < b->index) ? -1 : (a->index > b->index);
+}
+
+//Rank of a sorted multiset v[0] <= ... <= v[k-1]
+static uint64_t multiset_rank(const uint64_t *v, uint8_t k){
+	uint64_t idx = 0;
+	for(uint8_t i = 0; i < k; i++) idx += binom(v[i] + i, i + 1);
+	return idx;
+}
+
+static void multiset_unrank(uint64_t idx, uint8_t k, uint64_t *v){
+	if(k == 1){
+		v[0] = idx;
+		return;
+	}
+	for(uint8_t i = k; i > 0; i--){
+		//Largest w with binom(w, i) <= idx, then v = w - (i - 1)
+		uint64_t lo = i - 1, hi = i - 1;
+		while(binom(hi, i) <= idx) hi = hi * 2 + 1;
+		while(lo + 1 < hi){
+			uint64_t mid = lo + (hi - lo) / 2;
+			if(binom(mid, i) <= idx) lo = mid; else hi = mid;
+		}
+		idx -= binom(lo, i);
+		v[i - 1] = lo - (i - 1);
+	}
+}
+
+uint64_t hand_index(const HandIndexer *hi, uint8_t round, const Card *cards){
+	uint8_t rounds = round + 1;
+	uint16_t mask[4][HAND_INDEX_MAX_ROUNDS] = {{0}};
+	SuitKey key[4];
+	uint8_t n = 0;
+
+	for(uint8_t r = 0; r < rounds; r++){
+		for(uint8_t i = 0; i < hi->cardsPerRound[r]; i++){
+			uint8_t x = card_index(cards[n++]);
+			mask[x / 13][r] |= 1u << (x % 13);
+		}
+	}
+	for(uint8_t s = 0; s < 4; s++){
+		uint16_t used = 0;
+		uint8_t left = 13;
+		key[s].index = 0;
+		memset(key[s].count, 0, HAND_INDEX_MAX_ROUNDS);
+		for(uint8_t r = 0; r < rounds; r++){
+			uint8_t c = __builtin_popcount(mask[s][r]);
+			key[s].count[r] = c;
+			key[s].index = key[s].index * binom(left, c) + set_rank(mask[s][r], used);
+			used |= mask[s][r];
+			left -= c;
+		}
+	}
+	//Sort suits: configuration first, then per suit index, so equal groups come out sorted
+	for(uint8_t i = 1; i < 4; i++){
+		SuitKey t = key[i];
+		uint8_t j = i;
+		while(j > 0 && suit_key_cmp(&key[j - 1], &t, rounds) > 0){
+			key[j] = key[j - 1];
+			j--;
+		}
+		key[j] = t;
+	}
+
+	//Binary search the configuration
+	const RoundConfigs *rc = &hi->round[round];
+	uint32_t lo = 0, hiIdx = rc->numConfigs;
+	while(lo + 1 < hiIdx){
+		uint32_t mid = (lo + hiIdx) / 2;
+		int c = 0;
+		for(uint8_t s = 0; s < 4 && c == 0; s++) c = count_cmp(rc->configs[mid].count[s], key[s].count, rounds);
+		if(c <= 0) lo = mid; else hiIdx = mid;
+	}
+	const SuitConfig *sc = &rc->configs[lo];
+
+	uint64_t idx = 0;
+	uint8_t s = 0;
+	for(uint8_t g = 0; g < sc->groups; g++){
+		uint8_t e = sc->groupEnd[g];
+		uint64_t v[4];
+		for(uint8_t q = s; q < e; q++) v[q - s] = key[q].index;
+		idx = idx * sc->groupSize[g] + multiset_rank(v, e - s);
+		s = e;
+	}
+	return rc->offsets[lo] + idx;
+}
+
+void hand_unindex(const HandIndexer *hi, uint8_t round, uint64_t index, Card *cards){
+	uint8_t rounds = round + 1;
+	const RoundConfigs *rc = &hi->round[round];
+	uint32_t lo = 0, hiIdx = rc->numConfigs;
+	while(lo + 1 < hiIdx){
+		uint32_t mid = (lo + hiIdx) / 2;
+		if(rc->offsets[mid] <= index) lo = mid; else hiIdx = mid;
+	}
+	const SuitConfig *sc = &rc->configs[lo];
+	uint64_t idx = index - rc->offsets[lo];
+	uint64_t suitIdx[4];
+
+	//Peel the mixed radix from the last group backwards
+	for(uint8_t g = sc->groups; g > 0; g--){
+		uint8_t s = (g > 1) ? sc->groupEnd[g - 2] : 0;
+		multiset_unrank(idx % sc->groupSize[g - 1], sc->groupEnd[g - 1] - s, &suitIdx[s]);
+		idx /= sc->groupSize[g - 1];
+	}
+
+	uint16_t mask[4][HAND_INDEX_MAX_ROUNDS];
+	for(uint8_t s = 0; s < 4; s++){
+		//Split the per suit index back into one colex rank per round, last round is the low digit
+		uint64_t rem = suitIdx[s];
+		uint64_t digit[HAND_INDEX_MAX_ROUNDS];
+		uint8_t left[HAND_INDEX_MAX_ROUNDS];
+		uint8_t l = 13;
+		for(uint8_t r = 0; r < rounds; r++){
+			left[r] = l;
+			l -= sc->count[s][r];
+		}
+		for(uint8_t r = rounds; r > 0; r--){
+			uint64_t size = binom(left[r - 1], sc->count[s][r - 1]);
+			digit[r - 1] = rem % size;
+			rem /= size;
+		}
+		uint16_t used = 0;
+		for(uint8_t r = 0; r < rounds; r++){
+			mask[s][r] = expand(set_unrank(digit[r], sc->count[s][r]), used);
+			used |= mask[s][r];
+		}
+	}
+
+	uint8_t n = 0;
+	for(uint8_t r = 0; r < rounds; r++){
+		for(uint8_t s = 0; s < 4; s++){
+			uint16_t m = mask[s][r];
+			while(m){
+				cards[n++] = card_from_index(s * 13 + __builtin_ctz(m));
+				m &= m - 1;
+			}
+		}
+	}
+}
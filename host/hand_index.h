@@ -0,0 +1,48 @@
+/*
+ * hand_index.h
+ *
+ * Suit isomorphism indexer. Hands that only differ by a renaming of suits get the same
+ * dense index, so tables over hands (equity, buckets, strategies) can be stored per
+ * class instead of per hand. The rounds say which cards are told apart:
+ *   {2, 3, 1, 1}  hole, flop, turn, river kept separate: 169, 1,286,792, 55,190,538, 2,428,287,420
+ *   {2, 4}, {2, 5}  hole plus the board as one set (all showdown needs): 13,960,050, 123,156,254
+ *
+ * Cards of a hand are passed round after round, e.g. hole cards, then the board.
+ * hand_unindex() gives back the canonical hand of a class.
+ */
+
+#ifndef HAND_INDEX_H
+#define HAND_INDEX_H
+
+#include <stdint.h>
+#include "card.h"
+
+#define HAND_INDEX_MAX_ROUNDS 4
+
+typedef struct{
+	uint8_t count[4][HAND_INDEX_MAX_ROUNDS]; //Cards per canonical suit per round, suits sorted most cards first
+	uint8_t groups; //Runs of suits with the same counts
+	uint8_t groupEnd[4]; //Suits groupEnd[g-1]..groupEnd[g]-1 form group g
+	uint64_t groupSize[4]; //Multisets per group, the mixed radix digits of the index
+} SuitConfig;
+
+typedef struct{
+	SuitConfig *configs; //Every configuration of the round, in index order
+	uint64_t *offsets; //First index of each configuration, plus the total at the end
+	uint32_t numConfigs;
+} RoundConfigs;
+
+typedef struct{
+	uint8_t rounds;
+	uint8_t cardsPerRound[HAND_INDEX_MAX_ROUNDS];
+	RoundConfigs round[HAND_INDEX_MAX_ROUNDS];
+} HandIndexer;
+
+int hand_indexer_init(HandIndexer *hi, uint8_t rounds, const uint8_t cardsPerRound[]); //0 on success
+void hand_indexer_free(HandIndexer *hi);
+uint64_t hand_indexer_size(const HandIndexer *hi, uint8_t round); //Classes after round 0..rounds-1
+
+uint64_t hand_index(const HandIndexer *hi, uint8_t round, const Card *cards); //Cards of rounds 0..round
+void hand_unindex(const HandIndexer *hi, uint8_t round, uint64_t index, Card *cards); //Canonical hand of a class
+
+#endif
@@ -0,0 +1,128 @@
+/*
+ * hand_index_tool.c
+ *
+ * Checks and times the suit isomorphism indexer for Hold'em, per street {2, 3, 1, 1} and with
+ * the turn and river board as one set {2, 4} / {2, 5}. Build from the repo root:
+ *   gcc -O2 -Ihost -IPokerProject113025/PokerProject113025 -o hand_index_tool \
+ *       host/hand_index_tool.c host/hand_index.c \
+ *       PokerProject113025/PokerProject113025/card.c PokerProject113025/PokerProject113025/rank_tables.c
+ *   ./hand_index_tool [hands]
+ * Preflop and flop are round tripped for every index, larger rounds on random indices.
+ * Random hands are also re-indexed under a random suit permutation, which must not change
+ * the index. Exit status is non zero on any failure.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "hand_index.h"
+#include "bench_util.h"
+
+typedef struct{
+	const char *name;
+	uint8_t rounds;
+	uint8_t cardsPerRound[4];
+	uint64_t expected[4]; //Known class counts per round
+} Layout;
+
+static const Layout layouts[] = {
+	{"streets", 4, {2, 3, 1, 1}, {169, 1286792, 55190538, 2428287420ull}},
+	{"turn set", 2, {2, 4}, {169, 13960050}},
+	{"river set", 2, {2, 5}, {169, 123156254}}
+};
+
+//Cards must be distinct, otherwise the canonical hand is not a real hand
+static int valid_hand(const Card *c, uint8_t n){
+	uint64_t used = 0;
+	for(uint8_t i = 0; i < n; i++){
+		uint8_t x = card_index(c[i]);
+		if(used & (1ull << x)) return 0;
+		used |= 1ull << x;
+	}
+	return 1;
+}
+
+static long check_layout(const Layout *lay, long hands, Card *set, uint32_t *seed){
+	HandIndexer hi;
+	long bad = 0;
+
+	if(hand_indexer_init(&hi, lay->rounds, lay->cardsPerRound) != 0){
+		fprintf(stderr, "%s: init failed\n", lay->name);
+		return 1;
+	}
+	printf("%s {", lay->name);
+	for(uint8_t r = 0; r < lay->rounds; r++) printf(r ? ", %u" : "%u", lay->cardsPerRound[r]);
+	printf("}\n");
+
+	uint8_t n = 0;
+	for(uint8_t r = 0; r < lay->rounds; r++){
+		uint64_t size = hand_indexer_size(&hi, r);
+		long checked = 0;
+		n += lay->cardsPerRound[r];
+
+		//Every class of the small rounds, a sample of the large ones
+		for(uint64_t i = 0; i < size; i++){
+			uint64_t idx = i;
+			if(size > 2000000){
+				if(checked == hands) break;
+				idx = ((uint64_t)next_rand(seed) << 24 | next_rand(seed)) % size;
+			}
+			Card c[7];
+			hand_unindex(&hi, r, idx, c);
+			if(!valid_hand(c, n) || hand_index(&hi, r, c) != idx) bad++;
+			checked++;
+		}
+
+		//Suit renaming must not change the index
+		for(long i = 0; i < hands; i++){
+			Card p[7];
+			const Card *c = &set[i * 7];
+			uint8_t perm[4] = {0, 1, 2, 3};
+			for(uint8_t k = 3; k > 0; k--){
+				uint8_t j = next_rand(seed) % (k + 1);
+				uint8_t t = perm[k];
+				perm[k] = perm[j];
+				perm[j] = t;
+			}
+			for(uint8_t k = 0; k < n; k++){
+				uint8_t x = card_index(c[k]);
+				p[k] = card_from_index(perm[x / 13] * 13 + x % 13);
+			}
+			if(hand_index(&hi, r, c) != hand_index(&hi, r, p)) bad++;
+		}
+
+		volatile uint64_t sink = 0;
+		double t0 = now_sec();
+		for(long i = 0; i < hands; i++) sink += hand_index(&hi, r, &set[i * 7]);
+		double tIndex = now_sec() - t0;
+		Card c[7];
+		t0 = now_sec();
+		for(long i = 0; i < hands; i++){
+			hand_unindex(&hi, r, (uint64_t)i * 2654435761u % size, c);
+			sink += c[0].rank;
+		}
+		double tUnindex = now_sec() - t0;
+
+		printf("  %u cards %11llu classes%s  round trip %8ld  index %5.1f ns  unindex %5.1f ns\n", n,
+			(unsigned long long)size, size == lay->expected[r] ? "" : " WRONG", checked,
+			tIndex / hands * 1e9, tUnindex / hands * 1e9);
+		if(size != lay->expected[r]) bad++;
+	}
+	hand_indexer_free(&hi);
+	return bad;
+}
+
+int main(int argc, char **argv){
+	long hands = (argc > 1) ? atol(argv[1]) : 1000000;
+	uint32_t seed = 7;
+	long bad = 0;
+	Card *set = malloc(hands * 7 * sizeof(Card));
+
+	if(!set) return 1;
+	for(long i = 0; i < hands; i++) random_cards(&set[i * 7], 7, &seed);
+	for(uint8_t l = 0; l < sizeof(layouts) / sizeof(layouts[0]); l++){
+		bad += check_layout(&layouts[l], hands, set, &seed);
+	}
+	printf("%s, %ld failures\n", bad ? "FAILED" : "ok", bad);
+	free(set);
+	return bad ? 1 : 0;
+}
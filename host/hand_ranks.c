@@ -0,0 +1,266 @@
+/*
+ * hand_ranks.c
+ *
+ * Generator and loader for the state transition table in hand_ranks.h.
+ *
+ * A state is the canonical set of cards seen so far. Suits are only kept while they can
+ * still reach 5 cards by the 7th card, every other card is stored "suitless", which is
+ * what keeps the table near 600K states. State 0 is a dead state (impossible card
+ * combination) whose slots are all 0, state 1 is the empty hand.
+ * Slot c of a state with fewer than 6 cards holds (next state * 53), slot c of a
+ * 6 card state holds the final hand strength from evaluate_hand_strength().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "hand_ranks.h"
+
+#define SUITLESS 4
+#define HASH_BITS 22
+#define HASH_SIZE ((size_t)1 << HASH_BITS)
+#define FILE_MAGIC 0x31545248u //"HRT1"
+
+typedef struct{
+	uint32_t magic;
+	uint32_t stride;
+	uint64_t entries;
+} HandRanksHeader;
+
+typedef struct{
+	uint8_t n;
+	uint8_t c[7]; //rank index (0 = 2 ... 12 = Ace) << 3 | suit, SUITLESS if the suit no longer matters
+} StateKey;
+
+static uint64_t key_pack(const StateKey *k){
+	uint64_t v = k->n;
+	for(uint8_t i = 0; i < 7; i++){
+		v = (v << 8) | (i < k->n ? k->c[i] : 0);
+	}
+	return v;
+}
+
+static int key_add(const StateKey *in, uint8_t card, StateKey *out){
+	//Add card 1..52, returns 0 if the result can not be a real hand
+	uint8_t r = (uint8_t)((card - 1) / 4), s = (uint8_t)((card - 1) % 4);
+	uint8_t sameRank = 0;
+	for(uint8_t i = 0; i < in->n; i++){
+		if((in->c[i] >> 3) == r){
+			if((in->c[i] & 7) == s) return 0; //Same card twice
+			sameRank++;
+		}
+	}
+	if(sameRank >= 4) return 0;
+
+	*out = *in;
+	out->c[out->n++] = (uint8_t)((r << 3) | s);
+
+	//Drop suits that can no longer make a flush with the cards still to come
+	uint8_t suitCount[5] = {0};
+	for(uint8_t i = 0; i < out->n; i++){
+		suitCount[out->c[i] & 7]++;
+	}
+	for(uint8_t i = 0; i < out->n; i++){
+		uint8_t su = out->c[i] & 7;
+		if(su != SUITLESS && suitCount[su] + (7 - out->n) < 5){
+			out->c[i] = (uint8_t)((out->c[i] & ~7) | SUITLESS);
+		}
+	}
+
+	//Sort descending so equal sets give equal keys
+	for(uint8_t i = 1; i < out->n; i++){
+		uint8_t v = out->c[i];
+		int8_t j = (int8_t)i - 1;
+		while(j >= 0 && out->c[j] < v){
+			out->c[j + 1] = out->c[j];
+			j--;
+		}
+		out->c[j + 1] = v;
+	}
+	return 1;
+}
+
+static uint16_t key_strength(const StateKey *k){
+	//Give suitless cards real suits that can not form a flush, then use the reference evaluator
+	Card cards[7];
+	uint8_t suitCount[4] = {0};
+	uint8_t used[13] = {0}; //Suit bits taken per rank
+	for(uint8_t i = 0; i < 7; i++){
+		if((k->c[i] & 7) != SUITLESS){
+			suitCount[k->c[i] & 7]++;
+			used[k->c[i] >> 3] |= (uint8_t)(1 << (k->c[i] & 7));
+		}
+	}
+	for(uint8_t i = 0; i < 7; i++){
+		uint8_t r = k->c[i] >> 3, s = k->c[i] & 7;
+		if(s == SUITLESS){
+			uint8_t best = 0xFF;
+			for(uint8_t su = 0; su < 4; su++){
+				if(used[r] & (1 << su)) continue;
+				if(best == 0xFF || suitCount[su] < suitCount[best]) best = su;
+			}
+			if(best == 0xFF) return 0; //Unreachable key, more than 4 of a rank
+			s = best;
+			suitCount[s]++;
+			used[r] |= (uint8_t)(1 << s);
+		}
+		cards[i].rank = (r == 12) ? 1 : (uint8_t)(r + 2);
+		cards[i].suit = (Suit)s;
+	}
+	return evaluate_hand_strength(cards);
+}
+
+typedef struct{
+	uint64_t *keys;
+	uint32_t *ids;
+} KeyMap;
+
+static uint32_t map_find_or_add(KeyMap *m, uint64_t key, uint32_t newId, int *added){
+	size_t h = (size_t)((key * 0x9E3779B97F4A7C15ull) >> (64 - HASH_BITS));
+	while(m->keys[h] != 0){
+		if(m->keys[h] == key){
+			*added = 0;
+			return m->ids[h];
+		}
+		h = (h + 1) & (HASH_SIZE - 1);
+	}
+	m->keys[h] = key;
+	m->ids[h] = newId;
+	*added = 1;
+	return newId;
+}
+
+typedef struct{
+	KeyMap map;
+	StateKey *states;
+	uint32_t *next; //Next state id per state and card, 52 per state
+	size_t cap; //States room in states and next
+} Builder;
+
+static int builder_grow(Builder *b){
+	//Temporaries so a failed realloc leaves the old buffers for the caller to free
+	size_t cap = b->cap * 2;
+	StateKey *states = realloc(b->states, cap * sizeof(StateKey));
+	if(!states) return 0;
+	b->states = states;
+	uint32_t *next = realloc(b->next, cap * 52 * sizeof(uint32_t));
+	if(!next) return 0;
+	b->next = next;
+	b->cap = cap;
+	return 1;
+}
+
+static uint32_t *build_table(Builder *b, size_t *entries){
+	//Returns the stride 53 table, NULL when out of memory; b's buffers stay with the caller
+	StateKey *states = b->states;
+	uint32_t count = 2; //0 = dead, 1 = empty hand
+	memset(&states[0], 0, sizeof(StateKey));
+	memset(&states[1], 0, sizeof(StateKey));
+
+	//Breadth first over states, recording the next state id per card
+	memset(b->next, 0, 52 * 2 * sizeof(uint32_t));
+	for(uint32_t s = 1; s < count; s++){
+		for(uint8_t card = 1; card <= 52; card++){
+			StateKey k;
+			uint32_t v = 0;
+			if(key_add(&states[s], card, &k)){
+				if(k.n == 7){
+					v = key_strength(&k);
+				}
+				else{
+					int added;
+					v = map_find_or_add(&b->map, key_pack(&k), count, &added);
+					if(added){
+						if(count == b->cap){
+							if(!builder_grow(b)) return NULL;
+							states = b->states;
+						}
+						states[count++] = k;
+					}
+				}
+			}
+			b->next[(size_t)s * 52 + card - 1] = v;
+		}
+	}
+
+	//Lay out as stride 53 with next state ids turned into offsets
+	*entries = (size_t)count * HAND_RANKS_STRIDE;
+	uint32_t *table = calloc(*entries, sizeof(uint32_t));
+	if(!table) return NULL;
+	for(uint32_t s = 1; s < count; s++){
+		for(uint8_t card = 1; card <= 52; card++){
+			uint32_t v = b->next[(size_t)s * 52 + card - 1];
+			table[(size_t)s * HAND_RANKS_STRIDE + card] = (states[s].n < 6) ? v * HAND_RANKS_STRIDE : v;
+		}
+	}
+	return table;
+}
+
+int hand_ranks_generate(const char *path){
+	Builder b;
+	b.cap = 1 << 20;
+	b.map.keys = calloc(HASH_SIZE, sizeof(uint64_t));
+	b.map.ids = calloc(HASH_SIZE, sizeof(uint32_t));
+	b.states = malloc(b.cap * sizeof(StateKey));
+	b.next = malloc(b.cap * 52 * sizeof(uint32_t));
+	size_t entries = 0;
+	uint32_t *table = NULL;
+	if(b.map.keys && b.map.ids && b.states && b.next){
+		table = build_table(&b, &entries);
+	}
+	free(b.next);
+	free(b.states);
+	free(b.map.keys);
+	free(b.map.ids);
+	if(!table) return -1;
+
+	FILE *f = fopen(path, "wb");
+	if(!f){
+		free(table);
+		return -1;
+	}
+	HandRanksHeader hdr = {FILE_MAGIC, HAND_RANKS_STRIDE, entries};
+	int ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1 && fwrite(table, sizeof(uint32_t), entries, f) == entries;
+	ok = (fclose(f) == 0) && ok;
+	free(table);
+	return ok ? 0 : -1;
+}
+
+int hand_ranks_open(HandRanks *hr, const char *path){
+	memset(hr, 0, sizeof(*hr));
+	int fd = open(path, O_RDONLY);
+	if(fd < 0){
+		return -1;
+	}
+	struct stat st;
+	if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(HandRanksHeader)){
+		close(fd);
+		return -1;
+	}
+	void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd); //The mapping keeps the file alive
+	if(map == MAP_FAILED){
+		return -1;
+	}
+	const HandRanksHeader *hdr = map;
+	if(hdr->magic != FILE_MAGIC || hdr->stride != HAND_RANKS_STRIDE ||
+			sizeof(*hdr) + hdr->entries * sizeof(uint32_t) != (size_t)st.st_size){
+		munmap(map, (size_t)st.st_size);
+		return -1;
+	}
+	hr->map = map;
+	hr->mapBytes = (size_t)st.st_size;
+	hr->table = (const uint32_t *)(hdr + 1);
+	return 0;
+}
+
+void hand_ranks_close(HandRanks *hr){
+	if(hr->map){
+		munmap((void *)hr->map, hr->mapBytes);
+	}
+	memset(hr, 0, sizeof(*hr));
+}
@@ -0,0 +1,49 @@
+/*
+ * hand_ranks.h
+ *
+ * Host-side 7 card evaluator that walks a precomputed state transition table
+ * (the "two-plus-two" layout): one indexed load per card, no branches.
+ * The table (~130 MB) is generated once to a file and mmap()ed read-only, so every
+ * simulator process shares the same page cache copy.
+ *
+ * Values are the hand strengths from card.c (1..HAND_STRENGTH_MAX, larger is stronger),
+ * so they order exactly like evaluate_best_hand()/compare_hands().
+ */
+
+#ifndef HAND_RANKS_H
+#define HAND_RANKS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "card.h"
+
+#define HAND_RANKS_STRIDE 53 //Slot 0 unused, slots 1..52 are the cards
+
+typedef struct{
+	const uint32_t *table;
+	size_t mapBytes;
+	const void *map;
+} HandRanks;
+
+int hand_ranks_generate(const char *path); //Build the table and write it to path, 0 on success
+int hand_ranks_open(HandRanks *hr, const char *path); //mmap the table read-only, 0 on success
+void hand_ranks_close(HandRanks *hr);
+
+static inline uint8_t hand_ranks_card(Card c){
+	//Card index 1..52: (rank 2..A) * 4 + suit + 1
+	return (uint8_t)(card_rank_index(c.rank) * 4 + c.suit + 1);
+}
+
+static inline uint16_t hand_ranks_eval7(const HandRanks *hr, const uint8_t ids[7]){
+	//ids from hand_ranks_card(), any order
+	const uint32_t *t = hr->table;
+	uint32_t p = t[HAND_RANKS_STRIDE + ids[0]];
+	p = t[p + ids[1]];
+	p = t[p + ids[2]];
+	p = t[p + ids[3]];
+	p = t[p + ids[4]];
+	p = t[p + ids[5]];
+	return (uint16_t)t[p + ids[6]];
+}
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * hand_ranks_tool.c
+ *
+ * Generates and checks the hand_ranks.h state table. Build from the repo root:
+ *   gcc -O2 -Ihost -IPokerProject113025/PokerProject113025 -o hand_ranks \
+ *       host/hand_ranks_tool.c host/hand_ranks.c \
+ *       PokerProject113025/PokerProject113025/card.c PokerProject113025/PokerProject113025/rank_tables.c
+ *   ./hand_ranks gen HandRanks.dat
+ *   ./hand_ranks check HandRanks.dat [hands]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hand_ranks.h"
+#include "bench_util.h"
+
+static void random_hand(Card cards[7], uint8_t ids[7], uint32_t *seed){
+	random_cards(cards, 7, seed);
+	for(uint8_t i = 0; i < 7; i++){
+		ids[i] = hand_ranks_card(cards[i]);
+	}
+}
+
+static int check(const char *path, long hands){
+	HandRanks hr;
+	double t0 = now_sec();
+	if(hand_ranks_open(&hr, path) != 0){
+		fprintf(stderr, "can not map %s\n", path);
+		return 1;
+	}
+	printf("mapped %zu bytes in %.3f ms\n", hr.mapBytes, (now_sec() - t0) * 1e3);
+
+	uint32_t seed = 1;
+	uint8_t (*ids)[7] = malloc((size_t)hands * 7);
+	Card cards[7];
+	long bad = 0;
+	for(long i = 0; i < hands; i++){
+		random_hand(cards, ids[i], &seed);
+		if(hand_ranks_eval7(&hr, ids[i]) != evaluate_hand_strength(cards)){
+			if(bad++ < 5){
+				printf("mismatch at hand %ld\n", i);
+			}
+		}
+	}
+	printf("%ld hands checked against evaluate_hand_strength(), %ld mismatches\n", hands, bad);
+
+	volatile uint32_t sink = 0;
+	t0 = now_sec();
+	for(long i = 0; i < hands; i++){
+		sink += hand_ranks_eval7(&hr, ids[i]);
+	}
+	double dt = now_sec() - t0;
+	printf("table walk: %.1f M hands/s\n", hands / dt / 1e6);
+	free(ids);
+	hand_ranks_close(&hr);
+	return bad != 0;
+}
+
+int main(int argc, char **argv){
+	if(argc >= 3 && strcmp(argv[1], "gen") == 0){
+		double t0 = now_sec();
+		if(hand_ranks_generate(argv[2]) != 0){
+			fprintf(stderr, "generation failed\n");
+			return 1;
+		}
+		printf("wrote %s in %.1f s\n", argv[2], now_sec() - t0);
+		return 0;
+	}
+	if(argc >= 3 && strcmp(argv[1], "check") == 0){
+		return check(argv[2], argc >= 4 ? atol(argv[3]) : 10000000L);
+	}
+	fprintf(stderr, "usage: %s gen|check <file> [hands]\n", argv[0]);
+	return 1;
+}
@@ -0,0 +1,85 @@
+/*
+ * omaha_bench.c
+ *
+ * Omaha showdown cost: omaha_best() with one omaha_board_init() per board against the
+ * 60 combo brute force, with a Hold'em showdown (two evaluate_best_hand() calls) as the
+ * yardstick. Every deal is also checked for the same strength both ways. Build from the repo root:
+ *   gcc -O2 -IPokerProject113025/PokerProject113025 -o omaha_bench host/omaha_bench.c \
+ *       PokerProject113025/PokerProject113025/omaha.c \
+ *       PokerProject113025/PokerProject113025/card.c PokerProject113025/PokerProject113025/rank_tables.c
+ *   ./omaha_bench [deals]
+ * Exit status is non zero on any mismatch.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "omaha.h"
+#include "bench_util.h"
+
+#define DEAL_CARDS 13 //5 board + 2 players x 4 hole cards
+
+int main(int argc, char **argv){
+	long deals = (argc > 1) ? atol(argv[1]) : 300000;
+	uint32_t seed = 14;
+	long bad = 0;
+	long category[10] = {0};
+	Card *set = malloc(deals * DEAL_CARDS * sizeof(Card));
+	if(!set) return 1;
+	for(long i = 0; i < deals; i++) random_cards(&set[i * DEAL_CARDS], DEAL_CARDS, &seed);
+
+	//Correctness, plus board sizes 3 and 4 on the same deals
+	for(long i = 0; i < deals; i++){
+		const Card *d = &set[i * DEAL_CARDS];
+		for(uint8_t n = 3; n <= 5; n++){
+			OmahaBoard ob;
+			omaha_board_init(&ob, d, n);
+			for(uint8_t p = 0; p < 2; p++){
+				HandValue fast = omaha_best(&ob, &d[5 + p * 4]);
+				HandValue slow = omaha_best_brute(d, n, &d[5 + p * 4]);
+				if(hand_strength(&fast) != hand_strength(&slow) || fast.type != slow.type) bad++;
+				if(n == 5) category[fast.type]++;
+			}
+		}
+	}
+	for(uint8_t t = 0; t < 10; t++){
+		printf("%-16s %8ld\n", hand_type_to_string((HandRankType)t), category[t]);
+	}
+
+	volatile uint32_t sink = 0;
+	double t0 = now_sec();
+	for(long i = 0; i < deals; i++){
+		const Card *d = &set[i * DEAL_CARDS];
+		OmahaBoard ob;
+		omaha_board_init(&ob, d, 5);
+		sink += omaha_strength(&ob, &d[5]) > omaha_strength(&ob, &d[9]);
+	}
+	double tFast = now_sec() - t0;
+
+	t0 = now_sec();
+	for(long i = 0; i < deals; i++){
+		const Card *d = &set[i * DEAL_CARDS];
+		HandValue a = omaha_best_brute(d, 5, &d[5]);
+		HandValue b = omaha_best_brute(d, 5, &d[9]);
+		sink += hand_strength(&a) > hand_strength(&b);
+	}
+	double tBrute = now_sec() - t0;
+
+	t0 = now_sec();
+	for(long i = 0; i < deals; i++){
+		const Card *d = &set[i * DEAL_CARDS];
+		Card a[7], b[7];
+		for(uint8_t k = 0; k < 5; k++) a[k] = b[k] = d[k];
+		a[5] = d[5]; a[6] = d[6];
+		b[5] = d[9]; b[6] = d[10];
+		sink += evaluate_hand_strength(a) > evaluate_hand_strength(b);
+	}
+	double tHoldem = now_sec() - t0;
+
+	printf("heads-up showdown, per deal:\n");
+	printf("  omaha fast   %7.0f ns  (%.1fx hold'em)\n", tFast / deals * 1e9, tFast / tHoldem);
+	printf("  omaha brute  %7.0f ns  (%.1fx hold'em, %.1fx fast)\n", tBrute / deals * 1e9, tBrute / tHoldem, tBrute / tFast);
+	printf("  hold'em      %7.0f ns\n", tHoldem / deals * 1e9);
+	printf("%s, %ld mismatches\n", bad ? "FAILED" : "ok", bad);
+	free(set);
+	return bad ? 1 : 0;
+}
@@ -0,0 +1,408 @@
+/*
+ * range.c
+ *
+ * Combo index of card indices a < b is b * (b - 1) / 2 + a, the order board_cache.c uses.
+ * On each runout the live combos are sorted by their eval_batch() key. Walking them from
+ * weakest to strongest, a combo of range a beats every range b weight already passed,
+ * minus what of it holds one of its two cards (belowCard), and ties the rest of its group
+ * the same way. The identical combo is subtracted once per card, so it is added back.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "range.h"
+#include "eval_batch.h"
+#include "percentile.h"
+
+uint16_t range_combo(uint8_t a, uint8_t b){
+	if(a > b){
+		uint8_t t = a; a = b; b = t;
+	}
+	return (uint16_t)(b * (b - 1) / 2 + a);
+}
+
+void range_combo_cards(uint16_t combo, uint8_t *a, uint8_t *b){
+	uint8_t hi = 1;
+	while((uint16_t)((hi + 1) * hi / 2) <= combo) hi++;
+	*b = hi;
+	*a = (uint8_t)(combo - hi * (hi - 1) / 2);
+}
+
+void range_clear(Range *r){
+	memset(r, 0, sizeof(*r));
+}
+
+static uint8_t rank_value(char c){
+	//2..14, 0 if not a rank
+	const char *ranks = "23456789TJQKA";
+	const char *p = (c == 't') ? ranks + 8 : strchr(ranks, c);
+	return (c && p) ? (uint8_t)(p - ranks + 2) : 0;
+}
+
+static uint8_t card_of(uint8_t value, uint8_t suit){
+	return (uint8_t)(suit * 13 + ((value == 14) ? 0 : value - 1));
+}
+
+static void add_class(Range *r, uint8_t hi, uint8_t lo, char kind, float w){
+	//kind 's' suited, 'o' offsuit, 0 both; a pair is always offsuit
+	for(uint8_t s1 = 0; s1 < 4; s1++){
+		for(uint8_t s2 = 0; s2 < 4; s2++){
+			if(hi == lo && s2 <= s1) continue;
+			if(hi != lo && ((kind == 's' && s1 != s2) || (kind == 'o' && s1 == s2))) continue;
+			r->weight[range_combo(card_of(hi, s1), card_of(lo, s2))] = w;
+		}
+	}
+}
+
+static int add_top(Range *r, double percent, float w){
+	//Whole classes by preflopEquity, best first, until percent of all combos are in
+	uint8_t order[PREFLOP_CLASSES];
+	for(uint8_t c = 0; c < PREFLOP_CLASSES; c++) order[c] = c;
+	for(uint8_t i = 1; i < PREFLOP_CLASSES; i++){
+		uint8_t c = order[i], j = i;
+		while(j > 0 && rank_table_word(&preflopEquity[order[j - 1]]) < rank_table_word(&preflopEquity[c])){
+			order[j] = order[j - 1];
+			j--;
+		}
+		order[j] = c;
+	}
+	double target = percent / 100 * RANGE_COMBOS, count = 0;
+	for(uint8_t i = 0; i < PREFLOP_CLASSES && count < target - 0.5; i++){
+		uint8_t row = order[i] / 13, col = order[i] % 13;
+		if(row == col){
+			add_class(r, row + 2, col + 2, 0, w);
+			count += 6;
+		}
+		else if(row > col){
+			add_class(r, row + 2, col + 2, 's', w);
+			count += 4;
+		}
+		else{
+			add_class(r, col + 2, row + 2, 'o', w);
+			count += 12;
+		}
+	}
+	return 0;
+}
+
+static int parse_token(Range *r, char *t, float w){
+	size_t len = strlen(t);
+	if(strcmp(t, "any") == 0 || strcmp(t, "random") == 0){
+		for(uint16_t k = 0; k < RANGE_COMBOS; k++) r->weight[k] = w;
+		return 0;
+	}
+	if(len > 1 && t[len - 1] == '%'){
+		char *end;
+		double pct = strtod(strncmp(t, "top", 3) == 0 ? t + 3 : t, &end);
+		if(*end != '%' || pct < 0 || pct > 100) return -1;
+		return add_top(r, pct, w);
+	}
+	//One exact combo, e.g. AsKd
+	const char *suits = "hdcs";
+	if(len == 4 && rank_value(t[0]) && rank_value(t[2]) && t[1] && strchr(suits, t[1]) && t[3] && strchr(suits, t[3])){
+		uint8_t a = card_of(rank_value(t[0]), (uint8_t)(strchr(suits, t[1]) - suits));
+		uint8_t b = card_of(rank_value(t[2]), (uint8_t)(strchr(suits, t[3]) - suits));
+		if(a == b) return -1;
+		r->weight[range_combo(a, b)] = w;
+		return 0;
+	}
+	//Class, class+ or class-class: AK, AKs, AKo, QQ+, ATs+, A5s-A2s, 99-66, 98s-65s
+	uint8_t hi = rank_value(len > 0 ? t[0] : 0), lo = rank_value(len > 1 ? t[1] : 0);
+	if(!hi || !lo) return -1;
+	if(lo > hi){
+		uint8_t x = hi; hi = lo; lo = x;
+	}
+	size_t p = 2;
+	char kind = 0;
+	if(p < len && (t[p] == 's' || t[p] == 'o')){
+		if(hi == lo) return -1;
+		kind = t[p++];
+	}
+	uint8_t from = lo, to = lo; //Span of the lower rank (pairs: of both)
+	uint8_t gap = 0; //Nonzero when the higher rank moves with the lower one, e.g. suited connectors
+	if(p < len && t[p] == '+'){
+		p++;
+		to = (hi == lo) ? 14 : hi - 1;
+	}
+	else if(p < len && t[p] == '-'){
+		uint8_t hi2 = rank_value(t[p + 1]), lo2 = hi2 ? rank_value(t[p + 2]) : 0;
+		if(!lo2) return -1;
+		if(lo2 > hi2){
+			uint8_t x = hi2; hi2 = lo2; lo2 = x;
+		}
+		if((hi == lo) != (hi2 == lo2)) return -1;
+		if(hi != lo && hi2 != hi){
+			if(hi - lo != hi2 - lo2) return -1;
+			gap = hi - lo;
+		}
+		p += 3;
+		if(p < len && t[p] == kind) p++;
+		from = (lo2 < lo) ? lo2 : lo;
+		to = (lo2 < lo) ? lo : lo2;
+	}
+	if(p != len) return -1;
+	for(uint8_t v = from; v <= to; v++){
+		add_class(r, (hi == lo) ? v : (gap ? v + gap : hi), v, kind, w);
+	}
+	return 0;
+}
+
+int range_parse(Range *r, const char *text){
+	char buf[64];
+	const char *s = text;
+	while(*s){
+		//Next comma separated token, spaces dropped, optional :weight
+		size_t n = 0;
+		while(*s && *s != ','){
+			if(*s != ' ' && n + 1 < sizeof(buf)) buf[n++] = *s;
+			s++;
+		}
+		if(*s == ',') s++;
+		buf[n] = 0;
+		if(n == 0) continue;
+		float w = 1;
+		char *colon = strchr(buf, ':');
+		if(colon){
+			char *end;
+			*colon = 0;
+			w = strtof(colon + 1, &end);
+			if(*end || w < 0 || w > 1) return -1;
+		}
+		if(parse_token(r, buf, w) != 0) return -1;
+	}
+	return 0;
+}
+
+void range_remove(Range *r, uint64_t dead){
+	for(uint16_t k = 0; k < RANGE_COMBOS; k++){
+		uint8_t a, b;
+		range_combo_cards(k, &a, &b);
+		if(dead & ((1ull << a) | (1ull << b))) r->weight[k] = 0;
+	}
+}
+
+double range_size(const Range *r){
+	double sum = 0;
+	for(uint16_t k = 0; k < RANGE_COMBOS; k++) sum += r->weight[k];
+	return sum;
+}
+
+double range_equity_share(const RangeEquity *re){
+	return (re->total > 0) ? (re->win + re->tie / 2) / re->total : 0;
+}
+
+//Combos in either range, shared read only by the workers
+typedef struct{
+	uint16_t count;
+	uint64_t bits[RANGE_COMBOS];
+	uint16_t mask[4][RANGE_COMBOS];
+	uint8_t card[RANGE_COMBOS][2];
+	double wa[RANGE_COMBOS], wb[RANGE_COMBOS];
+	uint64_t boardBits;
+	uint16_t boardMask[4];
+	uint8_t deck[52], deckCount, need; //Cards left for the runout and how many it takes
+	uint32_t samples, seed;
+} RangeJob;
+
+typedef struct{
+	pthread_t thread;
+	const RangeJob *job;
+	uint8_t part, parts;
+	uint8_t failed; //No scratch memory, none of this worker's runouts were scored
+	RangeEquity re;
+} RangeWorker;
+
+typedef struct{
+	uint16_t sm[4][RANGE_COMBOS];
+	uint32_t key[RANGE_COMBOS];
+	uint16_t live[RANGE_COMBOS], ids[RANGE_COMBOS], tmp[RANGE_COMBOS];
+} RangeScratch;
+
+static void sort_by_key(const uint32_t *key, uint16_t *ids, uint16_t *tmp, uint16_t n){
+	//Four pass radix sort on the 30 bit key, stable
+	uint16_t count[256];
+	for(uint8_t shift = 0; shift < 32; shift += 8){
+		memset(count, 0, sizeof(count));
+		for(uint16_t i = 0; i < n; i++) count[(key[ids[i]] >> shift) & 255]++;
+		uint16_t sum = 0;
+		for(uint16_t b = 0; b < 256; b++){
+			uint16_t c = count[b];
+			count[b] = sum;
+			sum += c;
+		}
+		for(uint16_t i = 0; i < n; i++) tmp[count[(key[ids[i]] >> shift) & 255]++] = ids[i];
+		memcpy(ids, tmp, n * sizeof(uint16_t));
+	}
+}
+
+static void score_board(const RangeJob *job, uint64_t bits, const uint16_t mask[4], RangeScratch *sc, RangeEquity *re){
+	//Rank cache: one evaluation per live combo of either range
+	uint16_t n = 0;
+	double allB = 0, allBCard[52] = {0};
+	for(uint16_t u = 0; u < job->count; u++){
+		if(job->bits[u] & bits) continue;
+		sc->live[n] = u;
+		for(uint8_t s = 0; s < 4; s++) sc->sm[s][n] = mask[s] | job->mask[s][u];
+		sc->ids[n] = n;
+		allB += job->wb[u];
+		allBCard[job->card[u][0]] += job->wb[u];
+		allBCard[job->card[u][1]] += job->wb[u];
+		n++;
+	}
+	HandBatch hb = {{sc->sm[0], sc->sm[1], sc->sm[2], sc->sm[3]}, n};
+	eval_batch(&hb, sc->key);
+	sort_by_key(sc->key, sc->ids, sc->tmp, n);
+
+	double below = 0, belowCard[52] = {0}, group = 0, groupCard[52] = {0};
+	uint16_t i = 0;
+	while(i < n){
+		uint16_t j = i;
+		while(j < n && sc->key[sc->ids[j]] == sc->key[sc->ids[i]]){
+			uint16_t u = sc->live[sc->ids[j]];
+			group += job->wb[u];
+			groupCard[job->card[u][0]] += job->wb[u];
+			groupCard[job->card[u][1]] += job->wb[u];
+			j++;
+		}
+		for(uint16_t k = i; k < j; k++){
+			uint16_t u = sc->live[sc->ids[k]];
+			double wa = job->wa[u];
+			if(wa == 0) continue;
+			uint8_t c0 = job->card[u][0], c1 = job->card[u][1];
+			re->win += wa * (below - belowCard[c0] - belowCard[c1]);
+			re->tie += wa * (group - groupCard[c0] - groupCard[c1] + job->wb[u]);
+			re->total += wa * (allB - allBCard[c0] - allBCard[c1] + job->wb[u]);
+		}
+		for(uint16_t k = i; k < j; k++){
+			uint16_t u = sc->live[sc->ids[k]];
+			below += job->wb[u];
+			belowCard[job->card[u][0]] += job->wb[u];
+			belowCard[job->card[u][1]] += job->wb[u];
+			groupCard[job->card[u][0]] = 0;
+			groupCard[job->card[u][1]] = 0;
+		}
+		group = 0;
+		i = j;
+	}
+	re->boards++;
+}
+
+static void score_runout(const RangeJob *job, const uint8_t *pick, RangeScratch *sc, RangeEquity *re){
+	uint64_t bits = job->boardBits;
+	uint16_t mask[4] = {job->boardMask[0], job->boardMask[1], job->boardMask[2], job->boardMask[3]};
+	for(uint8_t k = 0; k < job->need; k++){
+		uint8_t c = job->deck[pick[k]];
+		Card card = card_from_index(c);
+		bits |= 1ull << c;
+		mask[card.suit] |= card_rank_bit(card);
+	}
+	score_board(job, bits, mask, sc, re);
+}
+
+static void *range_worker(void *arg){
+	RangeWorker *w = arg;
+	const RangeJob *job = w->job;
+	RangeScratch *sc = malloc(sizeof(RangeScratch));
+	if(!sc){
+		w->failed = 1;
+		return NULL;
+	}
+	uint8_t pick[5];
+	if(job->samples){
+		//This worker's share of random runouts, partial shuffle of the cards left
+		uint32_t mine = job->samples / w->parts + (w->part < job->samples % w->parts);
+		uint32_t rng = job->seed * 2654435761u + w->part + 1;
+		uint8_t order[52];
+		for(uint8_t k = 0; k < job->deckCount; k++) order[k] = k;
+		for(uint32_t s = 0; s < mine; s++){
+			for(uint8_t k = 0; k < job->need; k++){
+				rng ^= rng << 13;
+				rng ^= rng >> 17;
+				rng ^= rng << 5;
+				uint8_t r = (uint8_t)(k + ((uint64_t)rng * (job->deckCount - k) >> 32));
+				uint8_t t = order[k]; order[k] = order[r]; order[r] = t;
+				pick[k] = order[k];
+			}
+			score_runout(job, pick, sc, &w->re);
+		}
+	}
+	else{
+		//Every runout in colex order, runout number t goes to worker t % parts
+		for(uint8_t k = 0; k < job->need; k++) pick[k] = k;
+		uint64_t t = 0;
+		for(;;){
+			if(t++ % w->parts == w->part) score_runout(job, pick, sc, &w->re);
+			uint8_t k = 0;
+			while(k < job->need && pick[k] + 1 == ((k + 1 < job->need) ? pick[k + 1] : job->deckCount)) k++;
+			if(k == job->need) break;
+			pick[k]++;
+			for(uint8_t i = 0; i < k; i++) pick[i] = i;
+		}
+	}
+	free(sc);
+	return NULL;
+}
+
+int range_equity(const Range *a, const Range *b, const Card *board, uint8_t n, uint8_t threads, uint32_t samples, uint32_t seed, RangeEquity *re){
+	memset(re, 0, sizeof(*re));
+	if(n > 5 || n == 1 || n == 2) return -1;
+	if(threads < 1) threads = 1;
+	if(threads > RANGE_MAX_THREADS) threads = RANGE_MAX_THREADS;
+	RangeJob *job = calloc(1, sizeof(RangeJob));
+	if(!job) return -2;
+	for(uint8_t i = 0; i < n; i++){
+		uint8_t c = card_index(board[i]);
+		if(job->boardBits & (1ull << c)){
+			free(job);
+			return -1;
+		}
+		job->boardBits |= 1ull << c;
+		job->boardMask[board[i].suit] |= card_rank_bit(board[i]);
+	}
+	for(uint8_t c = 0; c < 52; c++){
+		if(!(job->boardBits & (1ull << c))) job->deck[job->deckCount++] = c;
+	}
+	job->need = 5 - n;
+	job->samples = (job->need == 0) ? 0 : samples;
+	job->seed = seed;
+	for(uint16_t k = 0; k < RANGE_COMBOS; k++){
+		if(a->weight[k] <= 0 && b->weight[k] <= 0) continue;
+		uint16_t u = job->count++;
+		uint8_t c0, c1;
+		range_combo_cards(k, &c0, &c1);
+		job->card[u][0] = c0;
+		job->card[u][1] = c1;
+		job->bits[u] = (1ull << c0) | (1ull << c1);
+		Card x = card_from_index(c0), y = card_from_index(c1);
+		job->mask[x.suit][u] |= card_rank_bit(x);
+		job->mask[y.suit][u] |= card_rank_bit(y);
+		job->wa[u] = (a->weight[k] > 0) ? a->weight[k] : 0;
+		job->wb[u] = (b->weight[k] > 0) ? b->weight[k] : 0;
+	}
+
+	RangeWorker w[RANGE_MAX_THREADS];
+	uint8_t started = 0, failed = 0;
+	for(uint8_t t = 0; t < threads; t++){
+		w[t] = (RangeWorker){.job = job, .part = t, .parts = threads};
+		if(pthread_create(&w[t].thread, NULL, range_worker, &w[t]) != 0){
+			failed = 1; //Runout t % threads == t would never be scored
+			break;
+		}
+		started++;
+	}
+	for(uint8_t t = 0; t < started; t++){
+		pthread_join(w[t].thread, NULL);
+		failed |= w[t].failed;
+		re->win += w[t].re.win;
+		re->tie += w[t].re.tie;
+		re->total += w[t].re.total;
+		re->boards += w[t].re.boards;
+	}
+	free(job);
+	if(failed){
+		memset(re, 0, sizeof(*re));
+		return -2;
+	}
+	return 0;
+}
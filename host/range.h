@@ -0,0 +1,41 @@
+/*
+ * range.h
+ *
+ * Weighted hand ranges and range against range equity for host analysis. A range holds a
+ * weight per two card combo, parsed from text such as "QQ+,AKs,A5s-A2s,KQo:0.5,top 20%".
+ * range_equity() walks every runout of the board, or random ones when samples > 0. Each
+ * runout ranks every live combo of either range once with eval_batch() (AVX2 when the CPU
+ * has it) into a per board rank cache, then one sweep in rank order scores every matchup,
+ * leaving out pairs that share a card. Runouts are split across threads.
+ */
+
+#ifndef RANGE_H
+#define RANGE_H
+
+#include <stdint.h>
+#include "card.h"
+
+#define RANGE_COMBOS 1326 //52 choose 2
+#define RANGE_MAX_THREADS 64
+
+typedef struct{
+	float weight[RANGE_COMBOS]; //0 = not in the range, 1 = always, by range_combo()
+} Range;
+
+typedef struct{
+	double win, tie, total; //Matchups range a wins, ties and plays, weight a * weight b each
+	uint64_t boards; //Runouts visited
+} RangeEquity;
+
+uint16_t range_combo(uint8_t a, uint8_t b); //Combo of two card_index() values, either order, a != b
+void range_combo_cards(uint16_t combo, uint8_t *a, uint8_t *b); //Back to card indices, a < b
+void range_clear(Range *r);
+int range_parse(Range *r, const char *text); //0 on success, -1 at the first token it cannot read
+void range_remove(Range *r, uint64_t dead); //Card removal: drop combos holding a card of dead (bit = card_index())
+double range_size(const Range *r); //Sum of weights, i.e. combos
+//n = 0, 3, 4 or 5 board cards. samples = 0 enumerates every runout. 0 on success, -1 for a bad board,
+//-2 if a worker thread or its memory could not be had (re is then zero, not a partial count)
+int range_equity(const Range *a, const Range *b, const Card *board, uint8_t n, uint8_t threads, uint32_t samples, uint32_t seed, RangeEquity *re);
+double range_equity_share(const RangeEquity *re); //Equity of range a, ties count half
+
+#endif
@@ -0,0 +1,191 @@
+/*
+ * range_tool.c
+ *
+ * Range against range equity with range.c. Build from the repo root:
+ *   gcc -O2 -pthread -Ihost -IPokerProject113025/PokerProject113025 -o range_tool host/range_tool.c \
+ *       host/range.c host/eval_batch.c PokerProject113025/PokerProject113025/board_cache.c \
+ *       PokerProject113025/PokerProject113025/equity.c PokerProject113025/PokerProject113025/percentile.c \
+ *       PokerProject113025/PokerProject113025/percentile_tables.c PokerProject113025/PokerProject113025/preflop_matrix.c \
+ *       PokerProject113025/PokerProject113025/colex.c PokerProject113025/PokerProject113025/card.c \
+ *       PokerProject113025/PokerProject113025/rank_tables.c
+ *   ./range_tool [-t threads] [-m boards] [-c] "QQ+,AKs" "top 20%" [board cards...]
+ * Ranges are comma separated: AA, QQ+, 99-66, AKs, AKo, AK, ATs+, A5s-A2s, AsKd, top 20%, any,
+ * each with an optional :weight (0..1). -m samples that many random runouts instead of all.
+ * -c also scores every matchup one by one from board_cache.c on the same runouts and fails if
+ * the totals differ (every runout, so keep it to the flop or later for wide ranges).
+ * Without arguments a fixed set is checked, including single combos against equity_exact().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "range.h"
+#include "board_cache.h"
+#include "equity.h"
+#include "colex.h"
+#include "bench_util.h"
+
+static int parse_card(const char *s, Card *c){
+	const char *ranks = "A23456789TJQK", *suits = "hdcs";
+	const char *r = (strncmp(s, "10", 2) == 0) ? "T" : s;
+	const char *rp = strchr(ranks, r[0]);
+	size_t len = strlen(s);
+	if(len != ((r == s) ? 2 : 3) || !rp || !*rp) return 0;
+	const char *sp = strchr(suits, s[len - 1]);
+	if(!sp || !*sp) return 0;
+	c->rank = (uint8_t)(rp - ranks + 1);
+	c->suit = (Suit)(sp - suits);
+	return 1;
+}
+
+static void pairwise(const Range *a, const Range *b, const Card *board, uint8_t n, RangeEquity *re){
+	//Reference: every runout through board_cache_build(), then every matchup on its own
+	uint64_t dead = 0;
+	for(uint8_t i = 0; i < n; i++) dead |= 1ull << card_index(board[i]);
+	memset(re, 0, sizeof(*re));
+	static BoardCache bc;
+	Card full[5];
+	memcpy(full, board, n * sizeof(Card));
+	uint8_t k = 5 - n, idx[5]; //Runout cards walked in colex order, sets that hit the board are skipped
+	for(uint8_t i = 0; i < k; i++) idx[i] = i;
+	do{
+		uint64_t set = 0;
+		for(uint8_t i = 0; i < k; i++) set |= 1ull << idx[i];
+		if(set & dead) continue;
+		for(uint8_t i = 0; i < k; i++) full[n + i] = card_from_index(idx[i]);
+		board_cache_build(&bc, full);
+		for(uint16_t x = 0; x < RANGE_COMBOS; x++){
+			if(a->weight[x] <= 0) continue;
+			uint8_t a0, a1;
+			range_combo_cards(x, &a0, &a1);
+			uint16_t sa = board_cache_lookup(&bc, card_from_index(a0), card_from_index(a1));
+			if(!sa) continue;
+			for(uint16_t y = 0; y < RANGE_COMBOS; y++){
+				if(b->weight[y] <= 0) continue;
+				uint8_t b0, b1;
+				range_combo_cards(y, &b0, &b1);
+				if(b0 == a0 || b0 == a1 || b1 == a0 || b1 == a1) continue;
+				uint16_t sb = board_cache_lookup(&bc, card_from_index(b0), card_from_index(b1));
+				if(!sb) continue;
+				double w = (double)a->weight[x] * b->weight[y];
+				if(sa > sb) re->win += w;
+				else if(sa == sb) re->tie += w;
+				re->total += w;
+			}
+		}
+		re->boards++;
+	}while(colex_next(idx, k));
+}
+
+static int close_to(double x, double y){
+	double d = (x > y) ? x - y : y - x;
+	return d <= 1e-9 * (x + y + 1); //Both are sums of non negative weights
+}
+
+static int report(const char *ra, const char *rb, const Card *board, uint8_t n, uint8_t threads, uint32_t samples, int check){
+	Range a, b;
+	range_clear(&a);
+	range_clear(&b);
+	if(range_parse(&a, ra) != 0 || range_parse(&b, rb) != 0){
+		fprintf(stderr, "bad range\n");
+		return 1;
+	}
+	uint64_t dead = 0;
+	for(uint8_t i = 0; i < n; i++) dead |= 1ull << card_index(board[i]);
+	range_remove(&a, dead);
+	range_remove(&b, dead);
+	RangeEquity re;
+	double t0 = now_sec();
+	int rc = range_equity(&a, &b, board, n, threads, samples, 1, &re);
+	if(rc != 0){
+		fprintf(stderr, (rc == -1) ? "bad board\n" : "range_equity: could not start the worker threads or allocate their memory\n");
+		return 1;
+	}
+	double t = now_sec() - t0;
+	printf("%-18s %6.1f combos  vs  %-18s %6.1f combos  board %u cards\n", ra, range_size(&a), rb, range_size(&b), n);
+	printf("  %9llu runouts  %14.0f matchups  A %6.2f%%  B %6.2f%%  %9.2f ms\n", (unsigned long long)re.boards, re.total,
+		100 * range_equity_share(&re), 100 - 100 * range_equity_share(&re), t * 1e3);
+	if(!check) return 0;
+	RangeEquity ref;
+	t0 = now_sec();
+	pairwise(&a, &b, board, n, &ref);
+	t = now_sec() - t0;
+	printf("  matchup by matchup with board_cache.c  %9.2f ms\n", t * 1e3);
+	if(ref.boards != re.boards || !close_to(ref.win, re.win) || !close_to(ref.tie, re.tie) || !close_to(ref.total, re.total)){
+		printf("  MISMATCH: win %.1f/%.1f tie %.1f/%.1f total %.1f/%.1f\n", re.win, ref.win, re.tie, ref.tie, re.total, ref.total);
+		return 1;
+	}
+	return 0;
+}
+
+static int check_combo(const Card h1[2], const Card h2[2], const Card *board, uint8_t n, uint8_t threads){
+	//A one combo range against another must count exactly what equity_exact() counts
+	Range a, b;
+	range_clear(&a);
+	range_clear(&b);
+	a.weight[range_combo(card_index(h1[0]), card_index(h1[1]))] = 1;
+	b.weight[range_combo(card_index(h2[0]), card_index(h2[1]))] = 1;
+	RangeEquity re;
+	EquityResult er;
+	if(range_equity(&a, &b, board, n, threads, 0, 1, &re) != 0){
+		fprintf(stderr, "range_equity failed on a single combo check\n");
+		return 1;
+	}
+	equity_exact(h1, h2, board, n, &er);
+	printf("single combos, board %u cards: %u runouts, range %.2f%%, equity_exact %u.%02u%%\n", n, er.runouts,
+		100 * range_equity_share(&re), equity_p1(&er) / 100, equity_p1(&er) % 100);
+	return re.win != er.win || re.tie != er.tie || re.total != er.runouts;
+}
+
+int main(int argc, char **argv){
+	int threads = 1, check = 0, nc = 0, nr = 0;
+	uint32_t samples = 0;
+	const char *ranges[2];
+	Card board[5];
+	for(int i = 1; i < argc; i++){
+		if(strcmp(argv[i], "-t") == 0 && i + 1 < argc){
+			threads = atoi(argv[++i]);
+			if(threads < 1) threads = 1;
+			if(threads > RANGE_MAX_THREADS) threads = RANGE_MAX_THREADS;
+		}
+		else if(strcmp(argv[i], "-c") == 0){
+			check = 1;
+		}
+		else if(strcmp(argv[i], "-m") == 0 && i + 1 < argc){
+			samples = (uint32_t)atol(argv[++i]);
+		}
+		else if(nr < 2){
+			ranges[nr++] = argv[i];
+		}
+		else if(nc < 5 && parse_card(argv[i], &board[nc])){
+			nc++;
+		}
+		else{
+			fprintf(stderr, "bad card %s\n", argv[i]);
+			return 1;
+		}
+	}
+
+	int bad = 0;
+	if(nr == 0){
+		//AsAh KsKh on every street, then ranges on QsJs4d, the turn Tc and the river 2d
+		Card fixed[9] = {{1, 3}, {1, 0}, {13, 3}, {13, 0}, {12, 3}, {11, 3}, {4, 1}, {10, 2}, {2, 1}};
+		for(uint8_t n = 0; n <= 5; n++){
+			if(n == 1 || n == 2) continue;
+			bad |= check_combo(&fixed[0], &fixed[2], &fixed[4], n, (uint8_t)threads);
+		}
+		bad |= report("QQ+,AKs", "top 20%", &fixed[4], 3, (uint8_t)threads, 0, 1);
+		bad |= report("22+,A2s+,KTo+:0.5", "AK,JTs,98s-65s", &fixed[4], 4, (uint8_t)threads, 0, 1);
+		bad |= report("any", "top 5%", &fixed[4], 5, (uint8_t)threads, 0, 1);
+		bad |= report("QQ+,AKs", "top 20%", fixed, 0, (uint8_t)threads, samples ? samples : 20000, 0);
+	}
+	else if(nr < 2 || nc == 1 || nc == 2){
+		fprintf(stderr, "need two ranges and 0, 3, 4 or 5 board cards\n");
+		return 1;
+	}
+	else{
+		bad |= report(ranges[0], ranges[1], board, (uint8_t)nc, (uint8_t)threads, samples, check);
+	}
+	if(check || nr == 0) printf("%s\n", bad ? "FAILED" : "ok");
+	return bad;
+}
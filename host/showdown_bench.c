@@ -0,0 +1,113 @@
+/*
+ * showdown_bench.c
+ *
+ * N-player showdown cost for 2..10 seats: showdown_rank() (board added once, 2 cards per seat)
+ * against building a 7 card array per seat and calling evaluate_best_hand().
+ * Every deal is checked for the same hands, strengths and split-pot groups both ways.
+ * Build from the repo root:
+ *   gcc -O2 -IPokerProject113025/PokerProject113025 -o showdown_bench host/showdown_bench.c \
+ *       PokerProject113025/PokerProject113025/showdown.c \
+ *       PokerProject113025/PokerProject113025/card.c PokerProject113025/PokerProject113025/rank_tables.c
+ *   ./showdown_bench [deals]
+ * Exit status is non zero on any mismatch.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "showdown.h"
+#include "bench_util.h"
+
+#define DEAL_CARDS (5 + 2 * SHOWDOWN_MAX_PLAYERS)
+
+static void per_seat(const Card *d, uint8_t n, ShowdownResult *sr){
+	//The old way: a full 7 card copy and a full evaluation per seat
+	for(uint8_t p = 0; p < n; p++){
+		Card cards[7];
+		cards[0] = d[5 + 2 * p];
+		cards[1] = d[6 + 2 * p];
+		for(uint8_t k = 0; k < 5; k++) cards[2 + k] = d[k];
+		sr->hand[p] = evaluate_best_hand(cards);
+		sr->strength[p] = hand_strength(&sr->hand[p]);
+	}
+	showdown_group(sr, n);
+}
+
+static long check(const Card *d, uint8_t n){
+	ShowdownResult sr;
+	long bad = 0;
+	showdown_rank(d, (const Card (*)[2])&d[5], n, &sr);
+	uint16_t best = 0;
+	for(uint8_t p = 0; p < n; p++){
+		Card cards[7];
+		cards[0] = d[5 + 2 * p];
+		cards[1] = d[6 + 2 * p];
+		for(uint8_t k = 0; k < 5; k++) cards[2 + k] = d[k];
+		HandValue hv = evaluate_best_hand(cards);
+		if(sr.strength[p] != evaluate_hand_strength(cards) || compare_hands(&sr.hand[p], &hv) != 0) bad++;
+		if(sr.strength[p] > best) best = sr.strength[p];
+	}
+	//Groups strictly weaker one to the next, equal inside, seats ascending inside
+	for(uint8_t g = 0; g < sr.groups; g++){
+		for(uint8_t i = sr.groupStart[g]; i < sr.groupStart[g + 1]; i++){
+			if(sr.strength[sr.order[i]] != sr.strength[sr.order[sr.groupStart[g]]]) bad++;
+			if(i > sr.groupStart[g] && sr.order[i] < sr.order[i - 1]) bad++;
+		}
+		if(g > 0 && sr.strength[sr.order[sr.groupStart[g]]] >= sr.strength[sr.order[sr.groupStart[g - 1]]]) bad++;
+	}
+	uint16_t winners = 0;
+	for(uint8_t p = 0; p < n; p++){
+		if(sr.strength[p] == best) winners |= (uint16_t)1 << p;
+	}
+	if(showdown_pot_winners(&sr, (1u << n) - 1) != winners) bad++;
+	//Side pot without seat 0: the best hand among the rest
+	if(n > 1){
+		uint16_t side = 0, sideBest = 0;
+		for(uint8_t p = 1; p < n; p++){
+			if(sr.strength[p] > sideBest) sideBest = sr.strength[p];
+		}
+		for(uint8_t p = 1; p < n; p++){
+			if(sr.strength[p] == sideBest) side |= (uint16_t)1 << p;
+		}
+		if(showdown_pot_winners(&sr, ((1u << n) - 1) & ~1u) != side) bad++;
+	}
+	return bad;
+}
+
+int main(int argc, char **argv){
+	long deals = (argc > 1) ? atol(argv[1]) : 200000;
+	uint32_t seed = 15;
+	long bad = 0;
+	Card *set = malloc(deals * DEAL_CARDS * sizeof(Card));
+	if(!set) return 1;
+	for(long i = 0; i < deals; i++) random_cards(&set[i * DEAL_CARDS], DEAL_CARDS, &seed);
+
+	for(long i = 0; i < deals; i++){
+		for(uint8_t n = 2; n <= SHOWDOWN_MAX_PLAYERS; n++){
+			bad += check(&set[i * DEAL_CARDS], n);
+		}
+	}
+
+	volatile uint32_t sink = 0;
+	printf("seats  showdown_rank  per-seat copy  (ns per showdown)\n");
+	for(uint8_t n = 2; n <= SHOWDOWN_MAX_PLAYERS; n++){
+		ShowdownResult sr;
+		double t0 = now_sec();
+		for(long i = 0; i < deals; i++){
+			const Card *d = &set[i * DEAL_CARDS];
+			showdown_rank(d, (const Card (*)[2])&d[5], n, &sr);
+			sink += sr.order[0];
+		}
+		double tRank = now_sec() - t0;
+
+		t0 = now_sec();
+		for(long i = 0; i < deals; i++){
+			per_seat(&set[i * DEAL_CARDS], n, &sr);
+			sink += sr.order[0];
+		}
+		double tCopy = now_sec() - t0;
+		printf("%5u  %13.0f  %13.0f\n", n, tRank / deals * 1e9, tCopy / deals * 1e9);
+	}
+	printf("%s, %ld mismatches\n", bad ? "FAILED" : "ok", bad);
+	free(set);
+	return bad ? 1 : 0;
+}
@@ -0,0 +1,75 @@
+#!/bin/sh
+# eval_report.sh
+#
+# Per-backend footprint report of the firmware for each hand evaluator (EVAL_BACKEND in card.h).
+# Run from the repo root with the AVR toolchain (avr-gcc, avr-size, avr-objcopy and the
+# AVR-Dx device pack) and a host gcc/g++ on the PATH:
+#   sh tools/eval_report.sh
+#
+# Flash and static RAM: the firmware image itself, built once per backend. EVAL_BACKEND only picks
+# evaluate_best_hand(); showdown, equity and draws go through hand_acc_best(), which stays the
+# suit mask evaluator on every backend but EVAL_CONSTANT, so these are the sizes that ship.
+# Stack and cycles: bench_<backend>.hex is the full firmware built with EVAL_BENCH; flash it
+# and the USART3 report gives stack peak and best/avg/worst cycles over the fixed corpus.
+
+set -e
+MCU=${MCU:-avr128db48}
+SRC=PokerProject113025/PokerProject113025
+OUT=${OUT:-_eval_report}
+CFLAGS="-mmcu=$MCU -Os -std=gnu99 -ffunction-sections -fdata-sections -DF_CPU=16000000UL -I$SRC"
+LDFLAGS="-Wl,--gc-sections"
+
+mkdir -p "$OUT"
+
+# Tables first: regenerate (this also cross-checks them) and stop if the checked in copies drifted
+gcc -O2 -DEVAL_BACKEND=0 -c -o "$OUT/card_ref.o" $SRC/card.c
+g++ -std=c++17 -O2 -I$SRC -o "$OUT/gen_tables" tools/gen_tables.cpp "$OUT/card_ref.o"
+mkdir -p "$OUT/tables"
+"$OUT/gen_tables" "$OUT/tables" > /dev/null
+for f in rank_tables.c eval_tables.h; do
+	if ! cmp -s "$OUT/tables/$f" $SRC/$f; then
+		echo "$SRC/$f is stale, run: $OUT/gen_tables $SRC" >&2
+		exit 1
+	fi
+done
+
+FW_SRC="$SRC/main.c $SRC/card.c $SRC/showdown.c $SRC/draws.c $SRC/percentile.c $SRC/percentile_tables.c
+	$SRC/preflop_matrix.c $SRC/flop_texture.c $SRC/flop_texture_table.c $SRC/equity.c $SRC/rank_tables.c
+	$SRC/uart.c $SRC/uart-avrdx.c"
+
+image_size(){ # prints "flash ram" of an elf
+	avr-size --format=berkeley "$1" | awk 'NR == 2 { print $1 + $2, $2 + $3 }'
+}
+
+check_window(){ # fails if the data read through the 32 KB mapped flash window outgrew it
+	mapped=$(avr-size -A "$1" | awk '$1 == ".rodata" || $1 == ".progmem.mapped" { sum += $2 } END { print sum + 0 }')
+	if [ "$mapped" -gt 32768 ]; then
+		echo "$1: $mapped bytes in the mapped flash window, limit 32768 (move big tables to FLASH_TABLE)" >&2
+		exit 1
+	fi
+}
+
+printf "%-9s %10s %10s\n" backend "flash (B)" "ram (B)"
+for b in 0 1 2 3 4; do
+	case $b in
+		0) name=counting ;;
+		1) name=bitmask ;;
+		2) name=tables ;;
+		3) name=tiny ;;
+		4) name=constant ;;
+	esac
+	avr-gcc $CFLAGS -DEVAL_BACKEND=$b -o "$OUT/$name.elf" $FW_SRC $LDFLAGS
+	check_window "$OUT/$name.elf"
+	set -- $(image_size "$OUT/$name.elf")
+	printf "%-9s %10d %10d\n" $name $1 $2
+
+	avr-gcc $CFLAGS -DEVAL_BACKEND=$b -DEVAL_BENCH -o "$OUT/bench_$name.elf" $FW_SRC $SRC/eval_bench.c $LDFLAGS
+	check_window "$OUT/bench_$name.elf"
+	avr-objcopy -O ihex -R .eeprom "$OUT/bench_$name.elf" "$OUT/bench_$name.hex"
+done
+
+# Omaha showdown cycles (omaha.c) on the default backend
+avr-gcc $CFLAGS -DEVAL_BENCH -DGAME_OMAHA -o "$OUT/bench_omaha.elf" $FW_SRC $SRC/omaha.c $SRC/eval_bench.c $LDFLAGS
+check_window "$OUT/bench_omaha.elf"
+avr-objcopy -O ihex -R .eeprom "$OUT/bench_omaha.elf" "$OUT/bench_omaha.hex"
+echo "Flash $OUT/bench_<backend>.hex (or bench_omaha.hex) and read the USART3 report for stack peak and cycles."
@@ -0,0 +1,183 @@
+/*
+ * gen_flop_texture.c
+ *
+ * Build step that writes flop_texture_table.c for flop_texture.c. Every one of the 22,100
+ * flops is classed with flop_canonical() and its texture worked out directly from the three
+ * cards, split across threads. Before anything is written it checks that
+ *   every flop of a class has the same texture and all 1,755 classes are reached,
+ *   the classes are exactly the suit isomorphism classes of host/hand_index.c,
+ *   flop_canonical() gives the same class for all 6 orders of the cards.
+ * Build and run from the repo root:
+ *   gcc -O2 -pthread -Ihost -IPokerProject113025/PokerProject113025 -o gen_flop_texture tools/gen_flop_texture.c \
+ *       host/hand_index.c PokerProject113025/PokerProject113025/flop_texture.c \
+ *       PokerProject113025/PokerProject113025/card.c PokerProject113025/PokerProject113025/rank_tables.c
+ *   ./gen_flop_texture PokerProject113025/PokerProject113025 [threads]
+ * Exit status is non zero if a check fails, nothing is written then.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "hand_index.h"
+#include "flop_texture.h"
+
+#define NUM_FLOPS 22100
+#define MAX_THREADS 64
+
+//flop_texture.c is linked for flop_canonical(), the table it reads is what this writes
+const uint16_t flopTexture[FLOP_CANONICAL] FLASH_TABLE = {0};
+
+typedef struct{
+	pthread_t thread;
+	const HandIndexer *hi;
+	uint8_t part, parts;
+	uint16_t texture[FLOP_CANONICAL];
+	uint16_t flops[FLOP_CANONICAL]; //Flops seen per class
+	uint32_t suitClass[FLOP_CANONICAL]; //hand_index() of the first flop seen, + 1
+	long bad;
+} Worker;
+
+static uint16_t texture_direct(const uint8_t idx[3]){
+	//From card indices, without sorting: rank counts, suit counts, then windows
+	uint8_t rankCount[15] = {0}, suitCount[4] = {0};
+	for(uint8_t k = 0; k < 3; k++){
+		uint8_t v = idx[k] % 13 + 1;
+		rankCount[card_rank_value(v)]++;
+		suitCount[idx[k] / 13]++;
+	}
+	uint8_t high = 0, low = 15, distinct = 0, maxRank = 0, maxSuit = 0;
+	for(uint8_t v = 2; v <= 14; v++){
+		if(!rankCount[v]) continue;
+		if(v > high) high = v;
+		if(v < low) low = v;
+		distinct++;
+		if(rankCount[v] > maxRank) maxRank = rankCount[v];
+	}
+	for(uint8_t s = 0; s < 4; s++){
+		if(suitCount[s] > maxSuit) maxSuit = suitCount[s];
+	}
+	uint8_t straights = 0;
+	for(uint8_t top = 5; top <= 14; top++){
+		//Window top - 4 .. top, rank 1 is the low Ace
+		uint8_t in = 0;
+		for(uint8_t v = top - 4; v <= top; v++){
+			in += rankCount[card_rank_value(v)] ? 1 : 0;
+		}
+		if(in == distinct) straights++;
+	}
+	uint16_t suits = (maxSuit == 3) ? FLOP_MONOTONE : (maxSuit == 2) ? FLOP_TWO_TONE : FLOP_RAINBOW;
+	uint16_t pairing = (maxRank == 3) ? FLOP_TRIPS : (maxRank == 2) ? FLOP_PAIRED : FLOP_UNPAIRED;
+	return (uint16_t)(high | suits << 4 | pairing << 6 | straights << 8 | (high - low) << 11);
+}
+
+static void *worker_main(void *arg){
+	Worker *w = arg;
+	uint32_t n = 0;
+	uint8_t idx[3];
+	static const uint8_t orders[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+	for(idx[0] = 0; idx[0] < 52; idx[0]++)
+	for(idx[1] = idx[0] + 1; idx[1] < 52; idx[1]++)
+	for(idx[2] = idx[1] + 1; idx[2] < 52; idx[2]++){
+		if(n++ % w->parts != w->part) continue;
+		Card flop[3];
+		for(uint8_t k = 0; k < 3; k++) flop[k] = card_from_index(idx[k]);
+		uint16_t cls = flop_canonical(flop);
+		if(cls >= FLOP_CANONICAL){
+			w->bad++;
+			continue;
+		}
+		for(uint8_t o = 1; o < 6; o++){
+			Card p[3] = {flop[orders[o][0]], flop[orders[o][1]], flop[orders[o][2]]};
+			if(flop_canonical(p) != cls) w->bad++;
+		}
+		uint16_t t = texture_direct(idx);
+		uint32_t sc = (uint32_t)hand_index(w->hi, 0, flop) + 1;
+		if(w->flops[cls] == 0){
+			w->texture[cls] = t;
+			w->suitClass[cls] = sc;
+		}
+		else if(w->texture[cls] != t || w->suitClass[cls] != sc){
+			w->bad++;
+		}
+		w->flops[cls]++;
+	}
+	return NULL;
+}
+
+int main(int argc, char **argv){
+	if(argc < 2){
+		fprintf(stderr, "usage: %s <output dir> [threads]\n", argv[0]);
+		return 1;
+	}
+	int threads = (argc > 2) ? atoi(argv[2]) : 4;
+	if(threads < 1) threads = 1;
+	if(threads > MAX_THREADS) threads = MAX_THREADS;
+
+	HandIndexer hi;
+	uint8_t three[1] = {3};
+	if(hand_indexer_init(&hi, 1, three) != 0) return 1;
+	long bad = (hand_indexer_size(&hi, 0) != FLOP_CANONICAL);
+
+	Worker *w = calloc(threads, sizeof(Worker));
+	if(!w) return 1;
+	for(int t = 0; t < threads; t++){
+		w[t].hi = &hi;
+		w[t].part = (uint8_t)t;
+		w[t].parts = (uint8_t)threads;
+		pthread_create(&w[t].thread, NULL, worker_main, &w[t]);
+	}
+	for(int t = 0; t < threads; t++) pthread_join(w[t].thread, NULL);
+
+	//Merge, classes must agree across workers and no two classes may share a suit class
+	static uint16_t texture[FLOP_CANONICAL];
+	static uint32_t flops[FLOP_CANONICAL], suitClass[FLOP_CANONICAL];
+	static uint8_t suitClassSeen[FLOP_CANONICAL];
+	uint32_t total = 0;
+	for(int t = 0; t < threads; t++){
+		bad += w[t].bad;
+		for(uint16_t c = 0; c < FLOP_CANONICAL; c++){
+			if(!w[t].flops[c]) continue;
+			if(flops[c] && (texture[c] != w[t].texture[c] || suitClass[c] != w[t].suitClass[c])) bad++;
+			texture[c] = w[t].texture[c];
+			suitClass[c] = w[t].suitClass[c];
+			flops[c] += w[t].flops[c];
+			total += w[t].flops[c];
+		}
+	}
+	uint16_t reached = 0;
+	for(uint16_t c = 0; c < FLOP_CANONICAL; c++){
+		if(!flops[c]){
+			bad++;
+			continue;
+		}
+		reached++;
+		if(suitClassSeen[suitClass[c] - 1]++) bad++;
+	}
+	printf("%u flops, %u of %u classes reached, %d threads\n", total, reached, FLOP_CANONICAL, threads);
+	bad += (total != NUM_FLOPS);
+	if(bad){
+		fprintf(stderr, "%ld checks failed, nothing written\n", bad);
+		return 1;
+	}
+
+	char path[512];
+	snprintf(path, sizeof(path), "%s/flop_texture_table.c", argv[1]);
+	FILE *f = fopen(path, "wb");
+	if(!f){
+		perror(path);
+		return 1;
+	}
+	fprintf(f, "/*\r\n * flop_texture_table.c\r\n *\r\n * Generated by tools/gen_flop_texture.c, do not edit.\r\n */ \r\n\r\n");
+	fprintf(f, "#include \"flop_texture.h\"\r\n\r\n");
+	fprintf(f, "const uint16_t flopTexture[FLOP_CANONICAL] FLASH_TABLE = {");
+	for(uint16_t c = 0; c < FLOP_CANONICAL; c++){
+		fprintf(f, "%s%u,", (c % 12) ? " " : "\r\n\t", texture[c]);
+	}
+	fprintf(f, "\r\n};\r\n");
+	fclose(f);
+	printf("classes match hand_index, textures agree within every class, written %s\n", path);
+	free(w);
+	hand_indexer_free(&hi);
+	return 0;
+}
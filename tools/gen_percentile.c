@@ -0,0 +1,215 @@
+/*
+ * gen_percentile.c
+ *
+ * Build step that writes percentile_tables.c for percentile.c:
+ *   percentileStrength  smallest hand strength that beats at least p / 10 % of all 7 card hands
+ *   preflopEquity       equity of each of the 169 starting hand classes against one random hand
+ * Both come from one pass over all 2,598,960 boards. Per board every one of the 1081 holdings
+ * left is ranked and sorted by strength; a sweep in strength order then counts, per holding,
+ * the opponents below and level with it, leaving out the ones that share a card. Each 7 card
+ * hand is seen once per way of splitting it into board + 2, so the 7 card counts are the
+ * board x holding counts / 21, and the category totals are checked against the known ones
+ * before anything is written. About five minutes on one core. Build and run from the repo root:
+ *   gcc -O2 -IPokerProject113025/PokerProject113025 -o gen_percentile tools/gen_percentile.c \
+ *       PokerProject113025/PokerProject113025/card.c PokerProject113025/PokerProject113025/rank_tables.c
+ *   ./gen_percentile PokerProject113025/PokerProject113025
+ * Exit status is non zero if a check fails, nothing is written then.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "percentile.h"
+
+#define NUM_HOLDINGS 1326
+#define BOARD_HOLDINGS 1081 //C(47, 2)
+#define OPPONENTS 990 //C(45, 2), holdings left once board and hero are out
+#define SPLITS 21 //C(7, 2) ways a 7 card hand is board + holding
+
+static const uint64_t expectedTotals[10] = { //Per HandRankType, same as host/enum_bench.c
+	23294460, 58627800, 31433400, 6461620, 6180020, 4047644, 3473184, 224848, 37260, 4324
+};
+
+static uint8_t holdCard[NUM_HOLDINGS][2];
+static uint8_t holdClass[NUM_HOLDINGS];
+static uint64_t wins[NUM_HOLDINGS], ties[NUM_HOLDINGS];
+static uint64_t hist[HAND_STRENGTH_MAX + 1];
+
+static uint8_t class_of(uint8_t a, uint8_t b){
+	//Same layout as preflop_class(), written from card indices: suit * 13 + rank - 1, Ace is rank 1
+	uint8_t ra = (a % 13 + 12) % 13, rb = (b % 13 + 12) % 13; //0 = 2 ... 12 = Ace
+	uint8_t hi = (ra > rb) ? ra : rb, lo = (ra > rb) ? rb : ra;
+	return (a / 13 == b / 13) ? hi * 13 + lo : lo * 13 + hi;
+}
+
+static void sort_by_strength(const uint16_t *key, uint16_t *ids, uint16_t *tmp, uint16_t n){
+	//Two pass radix sort on the 13 bit strength, stable
+	uint16_t count[128];
+	for(uint8_t pass = 0; pass < 2; pass++){
+		uint8_t shift = pass * 7;
+		memset(count, 0, sizeof(count));
+		for(uint16_t i = 0; i < n; i++) count[(key[ids[i]] >> shift) & 127]++;
+		uint16_t sum = 0;
+		for(uint16_t b = 0; b < 128; b++){
+			uint16_t c = count[b];
+			count[b] = sum;
+			sum += c;
+		}
+		for(uint16_t i = 0; i < n; i++) tmp[count[(key[ids[i]] >> shift) & 127]++] = ids[i];
+		memcpy(ids, tmp, n * sizeof(uint16_t));
+	}
+}
+
+static void board_pass(const uint8_t b[5]){
+	uint64_t used = 0;
+	HandAccumulator board;
+	hand_acc_init(&board);
+	for(uint8_t i = 0; i < 5; i++){
+		used |= 1ull << b[i];
+		hand_acc_add(&board, card_from_index(b[i]));
+	}
+
+	static uint16_t strength[NUM_HOLDINGS];
+	uint16_t ids[BOARD_HOLDINGS], tmp[BOARD_HOLDINGS], n = 0;
+	for(uint16_t h = 0; h < NUM_HOLDINGS; h++){
+		if(used & ((1ull << holdCard[h][0]) | (1ull << holdCard[h][1]))) continue;
+		HandAccumulator acc = board;
+		hand_acc_add(&acc, card_from_index(holdCard[h][0]));
+		hand_acc_add(&acc, card_from_index(holdCard[h][1]));
+		HandValue hv = hand_acc_best(&acc);
+		strength[h] = hand_strength(&hv);
+		hist[strength[h]]++;
+		ids[n++] = h;
+	}
+	sort_by_strength(strength, ids, tmp, n);
+
+	//below[c]: holdings with card c already passed (weaker), level[c]: same in the current group
+	uint16_t below = 0, below1[52] = {0};
+	uint16_t i = 0;
+	while(i < n){
+		uint16_t j = i, level1[52] = {0};
+		while(j < n && strength[ids[j]] == strength[ids[i]]){
+			level1[holdCard[ids[j]][0]]++;
+			level1[holdCard[ids[j]][1]]++;
+			j++;
+		}
+		for(uint16_t k = i; k < j; k++){
+			uint8_t c0 = holdCard[ids[k]][0], c1 = holdCard[ids[k]][1];
+			wins[ids[k]] += below - below1[c0] - below1[c1];
+			ties[ids[k]] += (j - i - 1) - (level1[c0] + level1[c1] - 2);
+		}
+		for(uint16_t k = i; k < j; k++){
+			below1[holdCard[ids[k]][0]]++;
+			below1[holdCard[ids[k]][1]]++;
+		}
+		below += j - i;
+		i = j;
+	}
+}
+
+static int write_tables(const char *dir, const uint16_t *steps, const uint16_t *equity){
+	char path[512];
+	snprintf(path, sizeof(path), "%s/percentile_tables.c", dir);
+	FILE *f = fopen(path, "wb");
+	if(!f){
+		perror(path);
+		return 0;
+	}
+	fprintf(f, "/*\r\n * percentile_tables.c\r\n *\r\n * Generated by tools/gen_percentile.c, do not edit.\r\n */ \r\n\r\n");
+	fprintf(f, "#include \"percentile.h\"\r\n\r\n");
+	fprintf(f, "const uint16_t percentileStrength[PERCENTILE_STEPS] RANK_TABLE = {");
+	for(uint16_t p = 0; p < PERCENTILE_STEPS; p++){
+		fprintf(f, "%s%u,", (p % 12) ? " " : "\r\n\t", steps[p]);
+	}
+	fprintf(f, "\r\n};\r\n\r\nconst uint16_t preflopEquity[PREFLOP_CLASSES] RANK_TABLE = { //13 x 13, 0 = 2 ... 12 = Ace: pairs on the diagonal, suited below it, offsuit above");
+	for(uint16_t c = 0; c < PREFLOP_CLASSES; c++){
+		fprintf(f, "%s%u,", (c % 13) ? " " : "\r\n\t", equity[c]);
+	}
+	fprintf(f, "\r\n};\r\n");
+	fclose(f);
+	return 1;
+}
+
+int main(int argc, char **argv){
+	if(argc != 2){
+		fprintf(stderr, "usage: %s <output dir>\n", argv[0]);
+		return 1;
+	}
+	uint16_t n = 0;
+	for(uint8_t a = 0; a < 52; a++){
+		for(uint8_t b = a + 1; b < 52; b++){
+			holdCard[n][0] = a;
+			holdCard[n][1] = b;
+			holdClass[n] = class_of(a, b);
+			n++;
+		}
+	}
+
+	uint8_t b[5];
+	for(b[0] = 0; b[0] < 52; b[0]++)
+	for(b[1] = b[0] + 1; b[1] < 52; b[1]++)
+	for(b[2] = b[1] + 1; b[2] < 52; b[2]++)
+	for(b[3] = b[2] + 1; b[3] < 52; b[3]++)
+	for(b[4] = b[3] + 1; b[4] < 52; b[4]++){
+		board_pass(b);
+	}
+
+	//Category totals of the 7 card hands
+	uint64_t total = 0, cat[10] = {0};
+	long bad = 0;
+	for(uint16_t s = 1; s <= HAND_STRENGTH_MAX; s++){
+		if(hist[s] % SPLITS) bad++;
+		cat[strength_to_type(s)] += hist[s] / SPLITS;
+		total += hist[s] / SPLITS;
+	}
+	for(uint8_t t = 0; t < 10; t++){
+		printf("%-16s %10llu\n", hand_type_to_string((HandRankType)t), (unsigned long long)cat[t]);
+		if(cat[t] != expectedTotals[t]) bad++;
+	}
+
+	//percentileStrength[p]: first strength whose weaker hands reach p / PERCENTILE_STEPS of the total
+	uint16_t steps[PERCENTILE_STEPS];
+	uint64_t weaker = 0;
+	uint16_t p = 0;
+	for(uint16_t s = 1; s <= HAND_STRENGTH_MAX && p < PERCENTILE_STEPS; s++){
+		while(p < PERCENTILE_STEPS && weaker * PERCENTILE_STEPS >= (uint64_t)p * total){
+			steps[p++] = s;
+		}
+		weaker += hist[s] / SPLITS;
+	}
+	while(p < PERCENTILE_STEPS) steps[p++] = HAND_STRENGTH_MAX + 1; //Never reached
+
+	//Equity per class, in 0.01 %, averaged over the holdings in the class
+	uint64_t classWin[PREFLOP_CLASSES] = {0}, classTie[PREFLOP_CLASSES] = {0}, classCount[PREFLOP_CLASSES] = {0};
+	uint64_t allWins = 0, allLosses = 0;
+	const uint64_t perHolding = 2118760ull * OPPONENTS; //C(50, 5) boards x opponents
+	for(uint16_t h = 0; h < NUM_HOLDINGS; h++){
+		uint8_t c = holdClass[h];
+		classWin[c] += wins[h];
+		classTie[c] += ties[h];
+		classCount[c]++;
+		allWins += wins[h];
+		allLosses += perHolding - wins[h] - ties[h];
+	}
+	if(allWins != allLosses) bad++;
+	uint16_t equity[PREFLOP_CLASSES];
+	for(uint8_t c = 0; c < PREFLOP_CLASSES; c++){
+		double e = (classWin[c] + classTie[c] / 2.0) / (classCount[c] * (double)perHolding);
+		equity[c] = (uint16_t)(e * 10000 + 0.5);
+		if(classCount[c] != ((c / 13 == c % 13) ? 6 : (c / 13 > c % 13) ? 4 : 12)) bad++;
+	}
+	if(bad){
+		fprintf(stderr, "%ld checks failed, nothing written\n", bad);
+		return 1;
+	}
+	if(!write_tables(argv[1], steps, equity)){
+		return 1;
+	}
+
+	printf("7 card hands %llu, win counts balance\n", (unsigned long long)total);
+	printf("AA %.2f%%  72o %.2f%%  32o %.2f%% against a random hand\n", equity[class_of(0, 13)] / 100.0,
+		equity[class_of(6, 14)] / 100.0, equity[class_of(2, 14)] / 100.0);
+	printf("percentileStrength %u bytes, preflopEquity %u bytes flash\n",
+		(unsigned)sizeof(steps), (unsigned)sizeof(equity));
+	return 0;
+}
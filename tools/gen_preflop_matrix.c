@@ -0,0 +1,272 @@
+/*
+ * gen_preflop_matrix.c
+ *
+ * Build step that writes preflop_matrix.c for percentile.c: the all-in equity of every
+ * starting hand class against every other, averaged over the suit combos that can meet.
+ * Class against class does not change when the suits of board and both hands are renamed,
+ * so only the 134,459 suit-canonical boards (host/hand_index.c) are visited, each weighted by
+ * how many boards it stands for. Per board the 1081 holdings left are sorted by strength and
+ * one sweep counts, per class pair, the holdings beaten and tied, leaving out pairs that share
+ * a card. The counts are checked to add up to every disjoint combo pair times 1,712,304
+ * boards, and two matchups are checked against equity_exact(), before anything is written.
+ * Build and run from the repo root:
+ *   gcc -O3 -Ihost -IPokerProject113025/PokerProject113025 -o gen_preflop_matrix tools/gen_preflop_matrix.c \
+ *       host/hand_index.c PokerProject113025/PokerProject113025/equity.c \
+ *       PokerProject113025/PokerProject113025/card.c PokerProject113025/PokerProject113025/rank_tables.c
+ *   ./gen_preflop_matrix PokerProject113025/PokerProject113025
+ * Exit status is non zero if a check fails, nothing is written then.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hand_index.h"
+#include "percentile.h"
+#include "equity.h"
+
+#define NUM_HOLDINGS 1326
+#define BOARD_HOLDINGS 1081
+#define NUM_BOARDS 2598960
+#define BOARDS_PER_PAIR 1712304ull //C(48, 5)
+#define MAX_WEIGHTS 8 //Distinct orbit sizes of a board under suit renaming
+
+typedef uint32_t ClassMatrix[PREFLOP_CLASSES][PREFLOP_CLASSES];
+
+static uint8_t holdCard[NUM_HOLDINGS][2];
+static uint8_t holdClass[NUM_HOLDINGS];
+//Per orbit size, so per board counts (at most 12 x 12 per class pair) stay in 32 bits
+static ClassMatrix wins[MAX_WEIGHTS], ties[MAX_WEIGHTS];
+static uint32_t weightValue[MAX_WEIGHTS];
+static uint8_t numWeights = 0;
+
+static uint8_t class_of(uint8_t a, uint8_t b){
+	//Same layout as preflop_class(), from card indices
+	uint8_t ra = (a % 13 + 12) % 13, rb = (b % 13 + 12) % 13;
+	uint8_t hi = (ra > rb) ? ra : rb, lo = (ra > rb) ? rb : ra;
+	return (a / 13 == b / 13) ? hi * 13 + lo : lo * 13 + hi;
+}
+
+static void sort_by_strength(const uint16_t *key, uint16_t *ids, uint16_t *tmp, uint16_t n){
+	//Two pass radix sort on the 13 bit strength, stable
+	uint16_t count[128];
+	for(uint8_t pass = 0; pass < 2; pass++){
+		uint8_t shift = pass * 7;
+		memset(count, 0, sizeof(count));
+		for(uint16_t i = 0; i < n; i++) count[(key[ids[i]] >> shift) & 127]++;
+		uint16_t sum = 0;
+		for(uint16_t b = 0; b < 128; b++){
+			uint16_t c = count[b];
+			count[b] = sum;
+			sum += c;
+		}
+		for(uint16_t i = 0; i < n; i++) tmp[count[(key[ids[i]] >> shift) & 127]++] = ids[i];
+		memcpy(ids, tmp, n * sizeof(uint16_t));
+	}
+}
+
+static void board_pass(const Card board[5], uint8_t w){
+	uint64_t used = 0;
+	HandAccumulator acc0;
+	hand_acc_init(&acc0);
+	for(uint8_t i = 0; i < 5; i++){
+		used |= 1ull << card_index(board[i]);
+		hand_acc_add(&acc0, board[i]);
+	}
+
+	static uint16_t strength[NUM_HOLDINGS];
+	uint16_t ids[BOARD_HOLDINGS], tmp[BOARD_HOLDINGS], n = 0;
+	for(uint16_t h = 0; h < NUM_HOLDINGS; h++){
+		if(used & ((1ull << holdCard[h][0]) | (1ull << holdCard[h][1]))) continue;
+		HandAccumulator acc = acc0;
+		hand_acc_add(&acc, card_from_index(holdCard[h][0]));
+		hand_acc_add(&acc, card_from_index(holdCard[h][1]));
+		HandValue hv = hand_acc_best(&acc);
+		strength[h] = hand_strength(&hv);
+		ids[n++] = h;
+	}
+	sort_by_strength(strength, ids, tmp, n);
+
+	//below[B]: class B holdings already passed (weaker), belowCard[c][B]: those holding card c
+	static uint32_t below[PREFLOP_CLASSES], belowCard[52][PREFLOP_CLASSES];
+	memset(below, 0, sizeof(below));
+	memset(belowCard, 0, sizeof(belowCard));
+	uint16_t i = 0;
+	while(i < n){
+		uint16_t j = i;
+		while(j < n && strength[ids[j]] == strength[ids[i]]) j++;
+		for(uint16_t k = i; k < j; k++){
+			uint16_t h = ids[k];
+			uint32_t *row = wins[w][holdClass[h]];
+			const uint32_t *b0 = belowCard[holdCard[h][0]], *b1 = belowCard[holdCard[h][1]];
+			for(uint8_t b = 0; b < PREFLOP_CLASSES; b++){
+				row[b] += below[b] - b0[b] - b1[b];
+			}
+			for(uint16_t l = k + 1; l < j; l++){
+				uint16_t o = ids[l];
+				if(holdCard[h][0] == holdCard[o][0] || holdCard[h][0] == holdCard[o][1]
+					|| holdCard[h][1] == holdCard[o][0] || holdCard[h][1] == holdCard[o][1]) continue;
+				ties[w][holdClass[h]][holdClass[o]]++;
+				ties[w][holdClass[o]][holdClass[h]]++;
+			}
+		}
+		for(uint16_t k = i; k < j; k++){
+			uint16_t h = ids[k];
+			below[holdClass[h]]++;
+			belowCard[holdCard[h][0]][holdClass[h]]++;
+			belowCard[holdCard[h][1]][holdClass[h]]++;
+		}
+		i = j;
+	}
+}
+
+static long check_exact(uint8_t a, uint8_t b, double got){
+	//Average of equity_exact() over every disjoint combo pair of classes a and b
+	uint64_t win = 0, tie = 0, all = 0;
+	for(uint16_t x = 0; x < NUM_HOLDINGS; x++){
+		if(holdClass[x] != a) continue;
+		for(uint16_t y = 0; y < NUM_HOLDINGS; y++){
+			if(holdClass[y] != b) continue;
+			uint64_t mx = (1ull << holdCard[x][0]) | (1ull << holdCard[x][1]);
+			uint64_t my = (1ull << holdCard[y][0]) | (1ull << holdCard[y][1]);
+			if(mx & my) continue;
+			Card h1[2] = {card_from_index(holdCard[x][0]), card_from_index(holdCard[x][1])};
+			Card h2[2] = {card_from_index(holdCard[y][0]), card_from_index(holdCard[y][1])};
+			EquityResult er;
+			equity_exact(h1, h2, NULL, 0, &er);
+			win += er.win;
+			tie += er.tie;
+			all += er.runouts;
+		}
+	}
+	double want = (win + tie / 2.0) / all;
+	printf("class %3u vs %3u: matrix %.4f, equity_exact %.4f\n", a, b, got, want);
+	return want - got > 1e-9 || got - want > 1e-9;
+}
+
+static int write_matrix(const char *dir, const uint8_t *q){
+	char path[512];
+	snprintf(path, sizeof(path), "%s/preflop_matrix.c", dir);
+	FILE *f = fopen(path, "wb");
+	if(!f){
+		perror(path);
+		return 0;
+	}
+	fprintf(f, "/*\r\n * preflop_matrix.c\r\n *\r\n * Generated by tools/gen_preflop_matrix.c, do not edit.\r\n */ \r\n\r\n");
+	fprintf(f, "#include \"percentile.h\"\r\n\r\n");
+	fprintf(f, "const uint8_t preflopMatrix[PREFLOP_PAIRS] FLASH_TABLE = {");
+	for(uint16_t i = 0; i < PREFLOP_PAIRS; i++){
+		fprintf(f, "%s%u,", (i % 20) ? " " : "\r\n\t", q[i]);
+	}
+	fprintf(f, "\r\n};\r\n");
+	fclose(f);
+	return 1;
+}
+
+int main(int argc, char **argv){
+	if(argc != 2){
+		fprintf(stderr, "usage: %s <output dir>\n", argv[0]);
+		return 1;
+	}
+	uint16_t n = 0;
+	for(uint8_t a = 0; a < 52; a++){
+		for(uint8_t b = a + 1; b < 52; b++){
+			holdCard[n][0] = a;
+			holdCard[n][1] = b;
+			holdClass[n] = class_of(a, b);
+			n++;
+		}
+	}
+
+	//Orbit size of each canonical board = how many of the 2,598,960 boards index to it
+	HandIndexer hi;
+	uint8_t five[1] = {5};
+	if(hand_indexer_init(&hi, 1, five) != 0) return 1;
+	uint64_t numCanon = hand_indexer_size(&hi, 0);
+	uint8_t *orbit = calloc(numCanon, 1);
+	if(!orbit) return 1;
+	uint8_t b[5];
+	for(b[0] = 0; b[0] < 52; b[0]++)
+	for(b[1] = b[0] + 1; b[1] < 52; b[1]++)
+	for(b[2] = b[1] + 1; b[2] < 52; b[2]++)
+	for(b[3] = b[2] + 1; b[3] < 52; b[3]++)
+	for(b[4] = b[3] + 1; b[4] < 52; b[4]++){
+		Card c[5];
+		for(uint8_t k = 0; k < 5; k++) c[k] = card_from_index(b[k]);
+		orbit[hand_index(&hi, 0, c)]++;
+	}
+
+	uint64_t boards = 0;
+	for(uint64_t idx = 0; idx < numCanon; idx++){
+		uint8_t w = 0;
+		while(w < numWeights && weightValue[w] != orbit[idx]) w++;
+		if(w == numWeights){
+			if(numWeights == MAX_WEIGHTS) return 1;
+			weightValue[numWeights++] = orbit[idx];
+		}
+		Card c[5];
+		hand_unindex(&hi, 0, idx, c);
+		board_pass(c, w);
+		boards += orbit[idx];
+	}
+	printf("%llu canonical boards standing for %llu\n", (unsigned long long)numCanon, (unsigned long long)boards);
+	long bad = (boards != NUM_BOARDS);
+
+	//Weighted totals, then every class pair must cover its disjoint combo pairs x all boards
+	static double W[PREFLOP_CLASSES][PREFLOP_CLASSES], T[PREFLOP_CLASSES][PREFLOP_CLASSES];
+	static uint64_t pairs[PREFLOP_CLASSES][PREFLOP_CLASSES];
+	static uint64_t W64[PREFLOP_CLASSES][PREFLOP_CLASSES], T64[PREFLOP_CLASSES][PREFLOP_CLASSES];
+	for(uint16_t x = 0; x < NUM_HOLDINGS; x++){
+		for(uint16_t y = 0; y < NUM_HOLDINGS; y++){
+			if(holdCard[x][0] == holdCard[y][0] || holdCard[x][0] == holdCard[y][1]
+				|| holdCard[x][1] == holdCard[y][0] || holdCard[x][1] == holdCard[y][1]) continue;
+			pairs[holdClass[x]][holdClass[y]]++;
+		}
+	}
+	for(uint8_t a = 0; a < PREFLOP_CLASSES; a++){
+		for(uint8_t c = 0; c < PREFLOP_CLASSES; c++){
+			for(uint8_t w = 0; w < numWeights; w++){
+				W64[a][c] += (uint64_t)weightValue[w] * wins[w][a][c];
+				T64[a][c] += (uint64_t)weightValue[w] * ties[w][a][c];
+			}
+			W[a][c] = (double)W64[a][c];
+			T[a][c] = (double)T64[a][c];
+		}
+	}
+	for(uint8_t a = 0; a < PREFLOP_CLASSES; a++){
+		for(uint8_t c = 0; c < PREFLOP_CLASSES; c++){
+			//Each board counts the pair once from each side: a beats c, c beats a, or a tie
+			if(W64[a][c] + T64[a][c] + W64[c][a] != pairs[a][c] * BOARDS_PER_PAIR || T64[a][c] != T64[c][a]) bad++;
+		}
+	}
+
+	//Upper triangle only, a < c, equity of a in 1/255 steps; c against a is 1 minus it
+	static uint8_t q[PREFLOP_PAIRS];
+	double worst = 0;
+	for(uint8_t c = 1; c < PREFLOP_CLASSES; c++){
+		for(uint8_t a = 0; a < c; a++){
+			double e = (W[a][c] + T[a][c] / 2) / (W[a][c] + T[a][c] + W[c][a]);
+			q[c * (c - 1) / 2 + a] = (uint8_t)(e * 255 + 0.5);
+			double err = q[c * (c - 1) / 2 + a] / 255.0 - e;
+			if(err > worst) worst = err;
+			if(-err > worst) worst = -err;
+		}
+	}
+
+	uint8_t aa = class_of(0, 13), kk = class_of(12, 25), aks = class_of(0, 12), x72 = class_of(6, 14);
+	double eAAKK = (W[aa][kk] + T[aa][kk] / 2) / (W[aa][kk] + T[aa][kk] + W[kk][aa]);
+	double eAKs72 = (W[aks][x72] + T[aks][x72] / 2) / (W[aks][x72] + T[aks][x72] + W[x72][aks]);
+	bad += check_exact(aa, kk, eAAKK);
+	bad += check_exact(aks, x72, eAKs72);
+	if(bad){
+		fprintf(stderr, "%ld checks failed, nothing written\n", bad);
+		return 1;
+	}
+	if(!write_matrix(argv[1], q)){
+		return 1;
+	}
+	printf("counts add up for every class pair, worst rounding %.4f\n", worst);
+	printf("preflopMatrix %u bytes flash\n", (unsigned)sizeof(q));
+	free(orbit);
+	hand_indexer_free(&hi);
+	return 0;
+}
@@ -0,0 +1,289 @@
+/*
+ * gen_tables.cpp
+ *
+ * Build step that writes the evaluator tables for the AVR and host builds:
+ *   rank_tables.c  rankMaskInfo, fiveRankTable and colexBinom (RANK_TABLE)
+ *   eval_tables.h  small tables private to card.c (RANK_TABLE): strengthBase, binom, straightColex
+ * Every table is computed at compile time; static_asserts pin the known counts, and before
+ * anything is written each rank mask entry is cross-checked against the original counting
+ * evaluator in card.c. Build and run from the repo root:
+ *   gcc -O2 -DEVAL_BACKEND=0 -c -o card_ref.o PokerProject113025/PokerProject113025/card.c
+ *   g++ -std=c++17 -O2 -IPokerProject113025/PokerProject113025 -o gen_tables tools/gen_tables.cpp card_ref.o
+ *   ./gen_tables PokerProject113025/PokerProject113025
+ * Exit status is non zero if a check fails, nothing is written then.
+ */
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+
+extern "C" {
+#include "card.h"
+}
+
+constexpr int NUM_MASKS = 8192; //13 bit rank masks, bit 0 = 2 ... bit 12 = Ace
+constexpr int NUM_FIVE = 1277; //5 distinct ranks that are not a straight
+constexpr uint16_t FIVE_NONE = 0x07FF;
+constexpr int COLEX_N = 52, COLEX_K = 8;
+
+constexpr int bit_count(unsigned m){
+	int n = 0;
+	while(m){ m &= m - 1; n++; }
+	return n;
+}
+
+constexpr int straight_high(unsigned m){
+	//Plain scan, kept independent from the shift-and trick in card.c
+	for(int high = 14; high >= 6; high--){
+		unsigned run = 0x1Fu << (high - 6);
+		if((m & run) == run) return high;
+	}
+	if((m & 0x100Fu) == 0x100Fu) return 5; //A-2-3-4-5
+	return 0;
+}
+
+constexpr unsigned top_five(unsigned m){
+	//Keep only the five highest ranks
+	unsigned out = 0;
+	int k = 0;
+	for(int b = 12; b >= 0 && k < 5; b--){
+		if(m & (1u << b)){ out |= 1u << b; k++; }
+	}
+	return out;
+}
+
+constexpr uint64_t choose(int n, int k){
+	if(k < 0 || k > n) return 0;
+	uint64_t r = 1;
+	for(int i = 1; i <= k; i++) r = r * (n - k + i) / i;
+	return r;
+}
+
+struct RankTables{
+	uint16_t info[NUM_MASKS] = {}; //Straight high << 12 | five rank class
+	uint8_t five[NUM_FIVE][5] = {};
+	int classes = 0;
+};
+
+constexpr RankTables make_rank_tables(){
+	//Number the non straight 5 rank sets from weakest to strongest. Sets compare by their
+	//highest rank first, which is the order of the plain integer value of the mask
+	RankTables t;
+	int16_t index[NUM_MASKS] = {};
+	for(unsigned m = 0; m < NUM_MASKS; m++){
+		index[m] = -1;
+		if(bit_count(m) != 5 || straight_high(m)) continue;
+		int k = 0;
+		for(int b = 12; b >= 0; b--){
+			if(m & (1u << b)) t.five[t.classes][k++] = (uint8_t)(b + 2);
+		}
+		index[m] = (int16_t)t.classes++;
+	}
+	for(unsigned m = 0; m < NUM_MASKS; m++){
+		unsigned five = FIVE_NONE;
+		if(bit_count(m) >= 5 && index[top_five(m)] >= 0){
+			five = (unsigned)index[top_five(m)];
+		}
+		t.info[m] = (uint16_t)((straight_high(m) << 12) | five);
+	}
+	return t;
+}
+
+struct SmallTables{
+	uint16_t strengthBase[10] = {};
+	uint16_t binom[13][6] = {};
+	uint16_t straightColex[10] = {};
+	uint32_t colexBinom[COLEX_N][COLEX_K] = {};
+};
+
+constexpr SmallTables make_small_tables(){
+	SmallTables t;
+	//Classes per category, high card up to royal flush, see hand_strength() in card.c
+	const uint16_t classes[10] = {
+		(uint16_t)NUM_FIVE, (uint16_t)(13 * choose(12, 3)), (uint16_t)(choose(13, 2) * 11), (uint16_t)(13 * choose(12, 2)),
+		10, (uint16_t)NUM_FIVE, 13 * 12, 13 * 12, 9, 1
+	};
+	t.strengthBase[0] = 1;
+	for(int i = 1; i < 10; i++) t.strengthBase[i] = t.strengthBase[i - 1] + classes[i - 1];
+	for(int n = 0; n < 13; n++){
+		for(int k = 0; k < 6; k++) t.binom[n][k] = (uint16_t)choose(n, k);
+	}
+	//Colex index of the 5 rank straights, high 5 (wheel) to 14
+	for(int high = 5; high <= 14; high++){
+		unsigned m = (high == 5) ? 0x100Fu : 0x1Fu << (high - 6);
+		uint16_t idx = 0;
+		int i = 1;
+		for(int b = 0; b < 13; b++){
+			if(m & (1u << b)) idx += (uint16_t)choose(b, i++);
+		}
+		t.straightColex[high - 5] = idx;
+	}
+	for(int n = 0; n < COLEX_N; n++){
+		for(int k = 0; k < COLEX_K; k++) t.colexBinom[n][k] = (uint32_t)choose(n, k);
+	}
+	return t;
+}
+
+constexpr RankTables rank = make_rank_tables();
+constexpr SmallTables small = make_small_tables();
+
+static_assert(rank.classes == NUM_FIVE, "five rank classes");
+static_assert(rank.info[0x1F00] >> 12 == 14 && rank.info[0x100F] >> 12 == 5, "broadway and wheel");
+static_assert((rank.info[0x1F80] & FIVE_NONE) == FIVE_NONE, "top five of A-K-Q-J-T-9 is a straight");
+static_assert((rank.info[0x1E80] & FIVE_NONE) == NUM_FIVE - 1, "A-K-Q-J-9 is the best non straight");
+static_assert((rank.info[0x002F] & FIVE_NONE) == 0, "7-5-4-3-2 is the worst");
+static_assert(small.strengthBase[9] == 7462 && small.strengthBase[9] == HAND_STRENGTH_MAX, "7462 classes");
+static_assert(small.straightColex[0] == 792 && small.straightColex[9] == 1286, "wheel and broadway colex");
+static_assert(small.colexBinom[51][7] == 115775100u, "C(51, 7)");
+static_assert(small.colexBinom[51][7] + small.colexBinom[51][6] == 133784560u, "C(52, 7)");
+
+//Cross-check: cards for every rank set of 5 to 7 ranks through evaluate_best_hand_counting()
+static Card make_card(int v, int suit){
+	Card c;
+	c.rank = (uint8_t)(v == 14 ? 1 : v); //Card ranks run 1 (Ace) to 13
+	c.suit = (Suit)suit;
+	return c;
+}
+
+static int check_hand(Card *cards, HandRankType want, const uint8_t *ranks, uint8_t nRanks){
+	HandValue hv = evaluate_best_hand_counting(cards);
+	if(hv.type != want) return 1;
+	for(uint8_t i = 0; i < nRanks; i++){
+		if(hv.ranks[i] != ranks[i]) return 1;
+	}
+	return 0;
+}
+
+static long cross_check(void){
+	long bad = 0;
+	for(unsigned m = 0; m < NUM_MASKS; m++){
+		int n = bit_count(m);
+		if(n < 5 || n > 7) continue;
+		uint16_t info = rank.info[m];
+		int high = info >> 12;
+		unsigned five = info & FIVE_NONE;
+		if(!high && five == FIVE_NONE){ bad++; continue; }
+
+		int vals[7], k = 0;
+		for(int b = 12; b >= 0; b--){
+			if(m & (1u << b)) vals[k++] = b + 2;
+		}
+		uint8_t straightRanks[1] = {(uint8_t)high};
+		const uint8_t *fiveRanks = high ? straightRanks : rank.five[high ? 0 : five];
+		uint8_t nRanks = high ? 1 : 5;
+
+		//Flush: every rank in suit 0, padded with the top ranks in suits 1 and 2 (at most two pair)
+		Card cards[7];
+		for(int i = 0; i < n; i++) cards[i] = make_card(vals[i], 0);
+		for(int i = n; i < 7; i++) cards[i] = make_card(vals[i - n], i - n + 1);
+		HandRankType flushType = !high ? HAND_FLUSH : (high == 14) ? HAND_ROYAL_FLUSH : HAND_STRAIGHT_FLUSH;
+		bad += check_hand(cards, flushType, fiveRanks, nRanks);
+
+		//No flush: suits rotate so no suit gets more than two cards. The padding pairs the top
+		//ranks: 5 ranks become two pair over the third rank, 6 ranks one pair with the next three
+		//as kickers, both read off the table's top five
+		for(int i = 0; i < n; i++) cards[i] = make_card(vals[i], i & 3);
+		for(int i = n; i < 7; i++) cards[i] = make_card(vals[i - n], (i + 1) & 3);
+		if(high){
+			bad += check_hand(cards, HAND_STRAIGHT, straightRanks, 1);
+		}else if(n == 7){
+			bad += check_hand(cards, HAND_HIGH_CARD, fiveRanks, 5);
+		}else if(n == 6){
+			bad += check_hand(cards, HAND_ONE_PAIR, fiveRanks, 4);
+		}else{
+			bad += check_hand(cards, HAND_TWO_PAIR, fiveRanks, 3);
+		}
+	}
+	return bad;
+}
+
+static bool write_file(const std::string &path, const std::string &text){
+	FILE *f = std::fopen(path.c_str(), "wb");
+	if(!f){
+		std::perror(path.c_str());
+		return false;
+	}
+	std::fwrite(text.data(), 1, text.size(), f);
+	std::fclose(f);
+	return true;
+}
+
+static std::string fmt(const char *f, unsigned v){
+	char buf[64];
+	std::snprintf(buf, sizeof(buf), f, v);
+	return buf;
+}
+
+static std::string header(const char *name){
+	return std::string("/*\r\n * ") + name + "\r\n *\r\n * Generated by tools/gen_tables.cpp, do not edit.\r\n */ \r\n\r\n";
+}
+
+static std::string rank_tables_c(void){
+	std::string s = header("rank_tables.c");
+	s += "#include \"rank_tables.h\"\r\n#include \"colex.h\"\r\n\r\n";
+	s += fmt("const uint16_t rankMaskInfo[%u] RANK_TABLE = {", NUM_MASKS);
+	for(int i = 0; i < NUM_MASKS; i++){
+		s += (i % 12) ? " " : "\r\n\t";
+		s += fmt("0x%04X,", rank.info[i]);
+	}
+	s += fmt("\r\n};\r\n\r\nconst uint8_t fiveRankTable[%u][5] RANK_TABLE = {", NUM_FIVE);
+	for(int i = 0; i < NUM_FIVE; i++){
+		s += (i % 6) ? " " : "\r\n\t";
+		s += "{";
+		for(int k = 0; k < 5; k++) s += fmt(k < 4 ? "%u," : "%u", rank.five[i][k]);
+		s += "},";
+	}
+	s += "\r\n};\r\n\r\nconst uint32_t colexBinom[52][COLEX_MAX_K + 1] RANK_TABLE = {";
+	for(int n = 0; n < COLEX_N; n++){
+		s += "\r\n\t{";
+		for(int k = 0; k < COLEX_K; k++) s += fmt(k < COLEX_K - 1 ? "%u, " : "%u", small.colexBinom[n][k]);
+		s += (n < COLEX_N - 1) ? "}," : "}";
+	}
+	s += "\r\n};\r\n";
+	return s;
+}
+
+static std::string eval_tables_h(void){
+	std::string s = header("eval_tables.h");
+	s += "#ifndef EVAL_TABLES_H\r\n#define EVAL_TABLES_H\r\n\r\n#include \"rank_tables.h\" //RANK_TABLE, read with rank_table_word()\r\n\r\n";
+	s += "//First strength value of each HandRankType, high card up to royal flush\r\n";
+	s += "static const uint16_t strengthBase[10] RANK_TABLE = {";
+	for(int i = 0; i < 10; i++) s += fmt(i ? ", %u" : "%u", small.strengthBase[i]);
+	s += "};\r\n\r\nstatic const uint16_t binom[13][6] RANK_TABLE = { //C(n,k) for n < 13, k <= 5";
+	for(int n = 0; n < 13; n++){
+		s += (n % 5) ? "," : (n ? ",\r\n\t" : "\r\n\t");
+		s += "{";
+		for(int k = 0; k < 6; k++) s += fmt(k ? ",%u" : "%u", small.binom[n][k]);
+		s += "}";
+	}
+	s += "\r\n};\r\n\r\n#if EVAL_BACKEND != EVAL_TABLES\r\n";
+	s += "//Colex index of the 5 card straights (high 5..14), these are skipped when ranking 5 distinct ranks\r\n";
+	s += "static const uint16_t straightColex[10] RANK_TABLE = {";
+	for(int i = 0; i < 10; i++) s += fmt(i ? ", %u" : "%u", small.straightColex[i]);
+	s += "};\r\n#endif\r\n\r\n#endif\r\n";
+	return s;
+}
+
+int main(int argc, char **argv){
+	if(argc != 2){
+		std::fprintf(stderr, "usage: %s <output dir>\n", argv[0]);
+		return 1;
+	}
+	long bad = cross_check();
+	if(bad){
+		std::fprintf(stderr, "%ld rank mask entries disagree with evaluate_best_hand_counting()\n", bad);
+		return 1;
+	}
+	std::string dir = argv[1];
+	if(!write_file(dir + "/rank_tables.c", rank_tables_c()) || !write_file(dir + "/eval_tables.h", eval_tables_h())){
+		return 1;
+	}
+
+	unsigned infoBytes = sizeof(rank.info), fiveBytes = sizeof(rank.five), colexBytes = sizeof(small.colexBinom);
+	std::printf("rank masks checked against evaluate_best_hand_counting()\n");
+	std::printf("rankMaskInfo   %6u bytes flash\n", infoBytes);
+	std::printf("fiveRankTable  %6u bytes flash\n", fiveBytes);
+	std::printf("colexBinom     %6u bytes flash\n", colexBytes);
+	std::printf("total          %6u bytes flash, 0 bytes RAM\n", infoBytes + fiveBytes + colexBytes);
+	return 0;
+}